@@ -3,19 +3,28 @@
 layout(location = 0) in vec3 inPosition;
 layout(location = 1) in vec2 inUV;
 
-struct GpuInstanceData {
-    mat4 model;
-    vec4 color;
-    vec4 uv_rect;
-    vec4 params_1;
-    vec4 params_2;
-    vec4 clip_rect;
+// Compact axis-aligned instance (GpuUiInstance in graphics_types.h, 48 bytes)
+struct GpuUiInstance {
+    float x, y, w, h;
+    float z;
+    uint color;     // RGBA8 unorm
+    uint uv_min;    // unorm16x2
+    uint uv_size;   // unorm16x2
+    uint mode_clip; // mode (8 bits) | clip index (24 bits)
+    uint params_a;  // half2
+    uint params_b;  // half2
+    uint slice;     // unorm8x4, pixels / 255
 };
 
-layout(std140, set = 1, binding = 0) readonly buffer InstanceBuffer {
-    GpuInstanceData objects[];
+layout(std430, set = 1, binding = 0) readonly buffer InstanceBuffer {
+    GpuUiInstance objects[];
 } instances;
 
+// Shared clip rects (x, y, w, h), indexed by mode_clip >> 8
+layout(std430, set = 1, binding = 1) readonly buffer ClipBuffer {
+    vec4 rects[];
+} clips;
+
 layout(push_constant) uniform Push {
     mat4 view_proj;
 } pc;
@@ -30,26 +39,43 @@ layout(location = 6) out vec2 fragOrigUV;
 layout(location = 7) out vec4 fragUVRect;
 layout(location = 8) out vec2 fragTargetSize;
 
+const uint MODE_TEXTURED_OR_CURVE = 1u;
+const uint MODE_9_SLICE = 3u;
+
 void main() {
-    GpuInstanceData inst = instances.objects[gl_InstanceIndex];
-    
-    // Transform Position
-    vec4 world_pos = inst.model * vec4(inPosition, 1.0);
+    GpuUiInstance inst = instances.objects[gl_InstanceIndex];
+    uint mode = inst.mode_clip & 0xFFu;
+
+    // Transform Position: unit quad scaled to the rect (no rotation on this path)
+    vec3 size = vec3(inst.w, inst.h, 1.0);
+    vec4 world_pos = vec4(vec3(inst.x, inst.y, inst.z) + inPosition * size, 1.0);
     gl_Position = pc.view_proj * world_pos;
-    
+
     // Pass Data to Fragment
-    fragColor = inst.color;
-    
+    fragColor = unpackUnorm4x8(inst.color);
+
     // UV Calculation
     // inUV is 0..1. Map to uv_rect.
     // uv_rect = (u, v, w, h)
-    fragUV = inst.uv_rect.xy + inUV * inst.uv_rect.zw;
+    vec4 uv_rect = vec4(unpackUnorm2x16(inst.uv_min), unpackUnorm2x16(inst.uv_size));
+    fragUV = uv_rect.xy + inUV * uv_rect.zw;
     fragOrigUV = inUV; // 0..1 for SDF
-    fragUVRect = inst.uv_rect;
-    
-    fragParams = inst.params_1;
-    fragExtra = inst.params_2;
-    fragClipRect = inst.clip_rect;
+    fragUVRect = uv_rect;
+
+    // Params as the fragment shader expects them: x=mode, y=radius, z=border, w=extra
+    vec2 pa = unpackHalf2x16(inst.params_a);
+    vec2 pb = unpackHalf2x16(inst.params_b);
+    fragParams = vec4(float(mode), pa.x, pa.y, pb.x);
+
+    if (mode == MODE_9_SLICE) {
+        fragExtra = unpackUnorm4x8(inst.slice) * 255.0; // Borders (t, r, b, l)
+    } else if (mode == MODE_TEXTURED_OR_CURVE) {
+        fragExtra = uv_rect; // Curve control points (u1, v1, u2, v2)
+    } else {
+        fragExtra = vec4(0.0);
+    }
+
+    fragClipRect = clips.rects[inst.mode_clip >> 8];
     fragWorldPos = world_pos.xyz;
-    fragTargetSize = vec2(inst.model[0][0], inst.model[1][1]); // Extract scale X/Y
-}
\ No newline at end of file
+    fragTargetSize = size.xy;
+}
@@ -0,0 +1,60 @@
+#include "engine/assets/assets.h"
+#include "engine/scene/scene_asset.h"
+#include "engine/graphics/pipeline_loader.h"
+#include "foundation/logger/logger.h"
+
+#include <string.h>
+#include <stdio.h>
+
+// --- Asset Compiler ---
+// Warms the compiled config cache (cache/assets) ahead of time. Paths are relative
+// to the assets root and resolved exactly as the runtime loaders do, so the cache
+// keys match. Run from the directory the application runs from.
+//
+// Usage: AssetCompiler <assets_dir> [--pipeline <path>] <scene.yaml>...
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <assets_dir> [--pipeline <path>] <scene.yaml>...\n", argv[0]);
+        return 1;
+    }
+
+    logger_init(NULL);
+
+    const char* assets_dir = argv[1];
+    int failures = 0;
+    int compiled = 0;
+
+    for (int i = 2; i < argc; ++i) {
+        if (strcmp(argv[i], "--pipeline") == 0 && i + 1 < argc) {
+            const char* pipeline_path = argv[++i];
+            Assets* assets = assets_create(assets_dir);
+            PipelineDefinition def;
+            if (assets && pipeline_loader_load(assets, pipeline_path, &def)) {
+                compiled++;
+            } else {
+                LOG_ERROR("AssetCompiler: Failed to compile pipeline '%s'", pipeline_path);
+                failures++;
+            }
+            assets_destroy(assets);
+            continue;
+        }
+
+        // Same path the asset manager builds for assets_load_scene
+        char full_path[512];
+        snprintf(full_path, sizeof(full_path), "%s/%s", assets_dir, argv[i]);
+
+        SceneAsset* asset = scene_asset_load_from_file(full_path);
+        if (asset) {
+            scene_asset_destroy(asset);
+            compiled++;
+        } else {
+            LOG_ERROR("AssetCompiler: Failed to compile scene '%s'", full_path);
+            failures++;
+        }
+    }
+
+    LOG_INFO("AssetCompiler: %d compiled, %d failed", compiled, failures);
+    logger_shutdown();
+    return failures ? 1 : 0;
+}
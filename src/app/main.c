@@ -45,6 +45,10 @@ int main(int argc, char** argv) {
         .assets_path = config_get_string("assets", "assets"), 
         .ui_path = config_get_string("ui", "assets/ui/editor.yaml"),
         .log_level = log_level,
+        .headless = config_get_bool("headless", false),
+        .max_frames = (uint32_t)config_get_int("frames", 0),
+        .profile = config_get_bool("profile", false),
+        .profile_trace = config_get_string("profile_trace", NULL),
         .on_init = app_on_init, 
         .on_update = app_on_update
     };
@@ -57,6 +61,9 @@ int main(int argc, char** argv) {
     }
 
     logger_init("logs/graphics.log");
+    if (config_get_bool("log_async", true)) {
+        logger_set_async(true);
+    }
 
     Engine* engine = engine_create(&config);
     if (engine) {
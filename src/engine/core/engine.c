@@ -5,6 +5,9 @@
 #include "foundation/meta/reflection.h"
 #include "engine/text/font.h"
 #include "foundation/memory/arena.h"
+#include "foundation/memory/scratch.h"
+#include "foundation/thread/job_system.h"
+#include "foundation/profiler/profiler.h"
 #include "engine/graphics/render_system.h"
 #include "engine/assets/assets.h"
 #include "engine/input/input.h"
@@ -18,6 +21,9 @@
 #include <string.h>
 #include <stdlib.h>
 
+#define ENGINE_FRAME_ARENA_RESERVE ((size_t)1024 * 1024 * 1024) // Address space only
+#define ENGINE_PROFILE_CAPTURE_EVENTS (256u * 1024u) // Events kept for --profile-trace (32 bytes each)
+
 typedef struct Engine {
     // Platform
     PlatformWindow* window;
@@ -30,6 +36,7 @@ typedef struct Engine {
     // Application Data
     void* user_data;
     MemoryArena frame_arena;
+    JobSystem* job_system;
     
     // Features
     EngineFeature features[32];
@@ -80,8 +87,8 @@ Engine* engine_create(const EngineConfig* config) {
     Engine* engine = (Engine*)calloc(1, sizeof(Engine));
     if (!engine) return NULL;
 
-    // Init Frame Arena (16MB)
-    if (!arena_init(&engine->frame_arena, 16 * 1024 * 1024)) {
+    // Init Frame Arena (virtual: pages are committed as the frame actually uses them)
+    if (!arena_init_virtual(&engine->frame_arena, ENGINE_FRAME_ARENA_RESERVE)) {
         LOG_FATAL("Failed to initialize Frame Arena.");
         goto cleanup_engine;
     }
@@ -94,23 +101,46 @@ Engine* engine_create(const EngineConfig* config) {
     // 1. Logger
     logger_set_console_level(config->log_level);
     LOG_INFO("Engine Initializing...");
-    
-    // 2. Platform & Window
-    if (!platform_layer_init()) {
-        LOG_FATAL("Failed to initialize platform layer.");
+
+    // Profiler (before the job system, so the main thread is the first trace track)
+    if (config->profile || config->profile_trace) {
+#ifdef PROFILER_ENABLED
+        if (profiler_init() && config->profile_trace) {
+            profiler_capture_start(ENGINE_PROFILE_CAPTURE_EVENTS);
+        }
+#else
+        LOG_WARN("Engine: Profiling requested, but the profiler is compiled out (ENABLE_PROFILER=OFF)");
+#endif
+    }
+
+    // Job System (main thread participates as worker 0)
+    engine->job_system = job_system_create(0);
+    if (!engine->job_system) {
+        LOG_FATAL("Failed to initialize JobSystem.");
         goto cleanup_frame_arena;
     }
+    LOG_INFO("Engine: Job system running on %u threads", job_system_thread_count(engine->job_system));
     
-    engine->window = platform_create_window(config->width, config->height, config->title);
-    if (!engine->window) {
-        LOG_FATAL("Failed to create window.");
-        goto cleanup_platform;
+    // 2. Platform & Window
+    if (config->headless) {
+        LOG_INFO("Engine: Headless mode (%dx%d, null renderer)", config->width, config->height);
+    } else {
+        if (!platform_layer_init()) {
+            LOG_FATAL("Failed to initialize platform layer.");
+            goto cleanup_jobs;
+        }
+
+        engine->window = platform_create_window(config->width, config->height, config->title);
+        if (!engine->window) {
+            LOG_FATAL("Failed to create window.");
+            goto cleanup_platform;
+        }
+
+        // Callbacks
+        platform_set_window_user_pointer(engine->window, engine);
+        // Note: Input callbacks are registered by input_system_init
+        platform_set_framebuffer_size_callback(engine->window, on_framebuffer_size, engine);
     }
-    
-    // Callbacks
-    platform_set_window_user_pointer(engine->window, engine);
-    // Note: Input callbacks are registered by input_system_init
-    platform_set_framebuffer_size_callback(engine->window, on_framebuffer_size, engine);
 
     // 3. Input System
     engine->input_system = input_system_create(engine->window);
@@ -129,7 +159,10 @@ Engine* engine_create(const EngineConfig* config) {
     // 5. Render System
     RenderSystemConfig rs_config = {
         .window = engine->window,
-        .backend_type = "vulkan"
+        .backend_type = config->headless ? "null" : "vulkan",
+        .width = config->width,
+        .height = config->height,
+        .jobs = engine->job_system
     };
     engine->render_system = render_system_create(&rs_config);
     if (!engine->render_system) {
@@ -171,7 +204,6 @@ Engine* engine_create(const EngineConfig* config) {
                          snprintf(path, sizeof(path), "logs/screenshots/%s", entry.name);
                          platform_remove_file(path);
                      }
-                     free(entry.name);
                  }
                  platform_dir_close(dir);
              }
@@ -189,7 +221,10 @@ cleanup_window:
     platform_destroy_window(engine->window);
 cleanup_platform:
     platform_layer_shutdown();
+cleanup_jobs:
+    job_system_destroy(engine->job_system);
 cleanup_frame_arena:
+    profiler_shutdown();
     arena_destroy(&engine->frame_arena);
 cleanup_engine:
     free(engine);
@@ -203,8 +238,15 @@ void engine_run(Engine* engine) {
     
     RenderSystem* rs = engine->render_system;
     engine->last_time = platform_get_time_ms() / 1000.0;
+    double start_time = engine->last_time;
     
-    while (engine->running && !platform_window_should_close(engine->window)) {
+    uint32_t frame = 0;
+    while (engine->running) {
+        if (engine->window && platform_window_should_close(engine->window)) break;
+        if (engine->config.max_frames > 0 && frame >= engine->config.max_frames) break;
+        frame++;
+        PROFILE_BEGIN("frame");
+
         double now = platform_get_time_ms() / 1000.0;
         engine->dt = (float)(now - engine->last_time);
         engine->last_time = now;
@@ -224,6 +266,7 @@ void engine_run(Engine* engine) {
         render_system_begin_frame(rs, now);
         
         // Input Update
+        PROFILE_BEGIN("input");
         input_system_update(engine->input_system);
         
         // Input Poll (Triggers callbacks)
@@ -231,13 +274,16 @@ void engine_run(Engine* engine) {
 
         // GPU Input Sync (Branch B)
         {
-            PlatformWindowSize size = platform_get_framebuffer_size(engine->window);
+            int width = 0, height = 0;
+            engine_get_framebuffer_size(engine, &width, &height);
             GpuInputState gpu_input = {0};
-            gpu_input_update(&gpu_input, engine->input_system, (float)now, engine->dt, (float)size.width, (float)size.height);
+            gpu_input_update(&gpu_input, engine->input_system, (float)now, engine->dt, (float)width, (float)height);
             render_system_update_gpu_input(rs, &gpu_input);
         }
+        PROFILE_END();
 
         // Application Update Hook (App updates Graph, UI Layout, etc.)
+        PROFILE_BEGIN("update");
         if (engine->on_update) {
             engine->on_update(engine);
         }
@@ -247,12 +293,15 @@ void engine_run(Engine* engine) {
             EngineFeature* f = &engine->features[i];
             if (f->on_update) f->on_update(f, engine);
         }
+        PROFILE_END();
 
         // Features Extract
+        PROFILE_BEGIN("extract");
         for (int i = 0; i < engine->feature_count; ++i) {
             EngineFeature* f = &engine->features[i];
             if (f->on_extract) f->on_extract(f, engine);
         }
+        PROFILE_END();
 
         // Extract UI to Render Batches
         ui_renderer_extract(render_system_get_scene(rs), rs);
@@ -261,7 +310,25 @@ void engine_run(Engine* engine) {
         render_system_update(rs);
 
         // Draw
+        PROFILE_BEGIN("render_system_draw");
         render_system_draw(rs);
+        PROFILE_END();
+
+        PROFILE_END(); // frame
+        PROFILE_FRAME_END();
+    }
+
+    if (frame > 0) {
+        double total_ms = (platform_get_time_ms() / 1000.0 - start_time) * 1000.0;
+        LOG_INFO("Engine Loop Finished: %u frames in %.1f ms (%.3f ms/frame)", frame, total_ms, total_ms / frame);
+    }
+
+    if (profiler_is_active()) {
+        profiler_log_summary();
+        if (engine->config.profile_trace) {
+            profiler_capture_stop();
+            profiler_write_chrome_trace(engine->config.profile_trace);
+        }
     }
 }
 
@@ -275,6 +342,7 @@ void engine_destroy(Engine* engine) {
     }
     
     ui_system_shutdown();
+    ui_renderer_shutdown();
     render_system_destroy(engine->render_system);
     input_system_destroy(engine->input_system);
     assets_destroy(engine->assets);
@@ -283,7 +351,10 @@ void engine_destroy(Engine* engine) {
         platform_destroy_window(engine->window);
     }
     platform_layer_shutdown();
+    job_system_destroy(engine->job_system);
+    profiler_shutdown(); // After every thread that records scopes has stopped
     arena_destroy(&engine->frame_arena);
+    scratch_thread_shutdown();
     free(engine);
 }
 
@@ -309,6 +380,10 @@ MemoryArena* engine_get_frame_arena(Engine* engine) {
     return engine ? &engine->frame_arena : NULL;
 }
 
+JobSystem* engine_get_job_system(Engine* engine) {
+    return engine ? engine->job_system : NULL;
+}
+
 const EngineConfig* engine_get_config(const Engine* engine) {
     return engine ? &engine->config : NULL;
 }
@@ -321,6 +396,20 @@ void engine_set_user_data(Engine* engine, void* user_data) {
     if (engine) engine->user_data = user_data;
 }
 
+void engine_get_framebuffer_size(const Engine* engine, int* out_width, int* out_height) {
+    int width = 0, height = 0;
+    if (engine && engine->window) {
+        PlatformWindowSize size = platform_get_framebuffer_size(engine->window);
+        width = size.width;
+        height = size.height;
+    } else if (engine) {
+        width = engine->config.width;
+        height = engine->config.height;
+    }
+    if (out_width) *out_width = width;
+    if (out_height) *out_height = height;
+}
+
 float engine_get_dt(const Engine* engine) {
     return engine ? engine->dt : 0.0f;
 }
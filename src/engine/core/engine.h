@@ -2,6 +2,7 @@
 #define ENGINE_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 // Forward Declarations (C11 allows redefinition of typedefs)
 typedef struct RenderSystem RenderSystem;
@@ -9,6 +10,7 @@ typedef struct Assets Assets;
 typedef struct PlatformWindow PlatformWindow;
 typedef struct InputSystem InputSystem;
 typedef struct MemoryArena MemoryArena;
+typedef struct JobSystem JobSystem;
 
 typedef struct Engine Engine;
 
@@ -21,6 +23,16 @@ typedef struct EngineConfig {
     int log_level;
     double screenshot_interval;
 
+    // Headless: no window or platform layer, renders through the "null" backend at
+    // width x height. Lets engine_run be benchmarked and tested without a GPU.
+    bool headless;
+    uint32_t max_frames; // engine_run returns after this many frames (0 = no limit)
+
+    // Frame profiler (needs ENABLE_PROFILER): per-scope statistics are logged when
+    // engine_run returns, and the frames are written as a Chrome trace if a path is set.
+    bool profile;
+    const char* profile_trace;
+
     // Application Callbacks
     void (*on_init)(Engine* engine);
     void (*on_update)(Engine* engine);
@@ -59,11 +71,15 @@ InputSystem* engine_get_input_system(Engine* engine);
 Assets* engine_get_assets(Engine* engine);
 PlatformWindow* engine_get_window(Engine* engine);
 MemoryArena* engine_get_frame_arena(Engine* engine);
+JobSystem* engine_get_job_system(Engine* engine);
 const EngineConfig* engine_get_config(const Engine* engine);
 
 void* engine_get_user_data(const Engine* engine);
 void engine_set_user_data(Engine* engine, void* user_data);
 
+// Framebuffer size in pixels (the configured size when headless)
+void engine_get_framebuffer_size(const Engine* engine, int* out_width, int* out_height);
+
 float engine_get_dt(const Engine* engine);
 bool engine_is_running(const Engine* engine);
 
@@ -178,6 +178,10 @@ void compute_graph_execute(ComputeGraph* graph, RenderSystem* sys) {
     RendererBackend* backend = render_system_get_backend(sys);
     if (!backend || !backend->compute_dispatch) return;
 
+    // Batching backends order the passes with barriers and submit the graph once
+    bool batched = backend->compute_begin && backend->compute_end;
+    if (batched) backend->compute_begin(backend);
+
     for (size_t i = 0; i < graph->pass_count; ++i) {
         ComputePass* pass = graph->passes[i];
         
@@ -217,8 +221,10 @@ void compute_graph_execute(ComputeGraph* graph, RenderSystem* sys) {
         // 3. Barrier
         // TODO: More granular barriers based on dependency analysis?
         // For now, global barrier between passes is safe and simple.
-        if (backend->compute_wait) {
+        if (!batched && backend->compute_wait) {
             backend->compute_wait(backend);
         }
     }
+
+    if (batched) backend->compute_end(backend);
 }
@@ -0,0 +1,30 @@
+#ifndef CPU_COMPUTE_H
+#define CPU_COMPUTE_H
+
+#include <stdint.h>
+#include "engine/graphics/gpu_input.h"
+
+// --- CPU Compute Kernels ---
+// Compute work for backends without a GPU (the null backend). A kernel shades rows of an
+// RGBA8 image the way its compute shader would shade the storage image at Set 0 binding 0.
+// The backend clips the image to the dispatch extent (groups * local size), splits it
+// into row ranges and runs them on worker threads.
+
+typedef struct CpuComputeImage {
+    uint8_t* pixels;  // RGBA8, row-major
+    uint32_t width;
+    uint32_t height;
+    uint32_t stride;  // Bytes per row
+} CpuComputeImage;
+
+typedef struct CpuComputeKernel {
+    // Shades rows [row_begin, row_end) of 'target'. Runs concurrently for disjoint row
+    // ranges. 'input' is the buffer bound to slot 1 (the GpuInputState), NULL if unbound.
+    void (*run_rows)(const void* program, const GpuInputState* input, const CpuComputeImage* target,
+                     uint32_t row_begin, uint32_t row_end);
+    void (*destroy)(void* program); // Called when the pipeline is destroyed
+    void* program;
+    uint32_t local_size_x, local_size_y; // Invocations per work group, as in the shader
+} CpuComputeKernel;
+
+#endif // CPU_COMPUTE_H
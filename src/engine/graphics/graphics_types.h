@@ -5,6 +5,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include "foundation/math/math_types.h"
+#include "foundation/string/string_id.h"
 
 // =================================================================================================
 // [ENUMS]
@@ -76,6 +77,26 @@ typedef struct DescriptorLayoutDef {
     DescriptorBindingDef bindings[16];
 } DescriptorLayoutDef;
 
+// =================================================================================================
+// [SHADER DIAGNOSTICS]
+// =================================================================================================
+
+#define SHADER_MAX_DIAGNOSTICS 16
+
+typedef struct ShaderDiagnostic {
+    uint32_t line;   // 1-based source line, 0 if the message has none
+    bool is_error;   // Otherwise a warning
+    char message[192];
+} ShaderDiagnostic;
+
+// Compiler messages in source order. Counts include messages beyond SHADER_MAX_DIAGNOSTICS.
+typedef struct ShaderDiagnostics {
+    uint32_t error_count;
+    uint32_t warning_count;
+    uint32_t count; // Entries in 'items'
+    ShaderDiagnostic items[SHADER_MAX_DIAGNOSTICS];
+} ShaderDiagnostics;
+
 
 // =================================================================================================
 // [RENDER COMMANDS]
@@ -182,7 +203,8 @@ typedef struct RenderCommandList {
 
 
 // GPU Instance Data Layout (std140/std430 compatible)
-// Used for UI and Sprite rendering
+// Full transform path (128 bytes), for instances that need rotation. Axis-aligned
+// UI quads use GpuUiInstance.
 typedef struct GpuInstanceData {
     Mat4 model;
     Vec4 color;
@@ -192,11 +214,32 @@ typedef struct GpuInstanceData {
     Vec4 clip_rect;
 } GpuInstanceData;
 
+// Compact UI instance (48 bytes, std430, scalars only so the array stride is 48).
+// Packed fields match GLSL unpackUnorm4x8 / unpackUnorm2x16 / unpackHalf2x16.
+typedef struct GpuUiInstance {
+    float x, y, w, h;      // Screen rect (pixels, full precision)
+    float z;               // Depth
+    uint32_t color;        // RGBA8 unorm
+    uint32_t uv_min;       // unorm16x2 atlas UV origin (curves: start point)
+    uint32_t uv_size;      // unorm16x2 atlas UV size (curves: end point)
+    uint32_t mode_clip;    // Primitive type (low 8 bits) | clip table index (high 24 bits)
+    uint32_t params_a;     // half2: radius (curve flag), border / thickness / 9-slice texture width
+    uint32_t params_b;     // half2: 9-slice texture height or curve aspect, unused
+    uint32_t slice;        // unorm8x4: 9-slice borders in pixels (top, right, bottom, left)
+} GpuUiInstance;
+
 
 // =================================================================================================
 // [RENDER BATCH]
 // =================================================================================================
 
+// Draw layers (RenderBatch.layer_id). A draw list executes in ascending layer order;
+// within a layer batches are regrouped by pipeline and bindings (render_sort.h), so
+// painter's order between different pipelines needs different layers.
+#define RENDER_LAYER_WORLD          32u  // Scene geometry (default for meshes)
+#define RENDER_LAYER_WORLD_OVERLAY  48u  // Lines and wires over scene geometry
+#define RENDER_LAYER_UI            128u  // UI instances
+
 // Represents a 3D draw call or compute dispatch
 typedef struct RenderBatch {
     // Pipeline / Shader
@@ -229,11 +272,12 @@ typedef struct RenderBatch {
     size_t instance_buffer_size;
 
     // Sorting
-    float sort_key; // Distance to camera or layer index
-    uint32_t layer_id;
+    float sort_key; // Distance to camera (orders batches of equal layer and state)
+    uint32_t layer_id; // RENDER_LAYER_*
 
-    // Pipeline Tagging
-    char draw_list[32]; 
+    // Pipeline Tagging: interned draw list name, e.g. STR_ID("UIBatches") (0 = untagged).
+    // The Scene buckets batches by this id at push time.
+    StringId draw_list_id;
 } RenderBatch;
 
 #endif // GRAPHICS_TYPES_H
@@ -0,0 +1,433 @@
+#include "engine/graphics/internal/backend/null/null_renderer.h"
+#include "engine/graphics/internal/stream_internal.h"
+#include "foundation/logger/logger.h"
+#include "foundation/thread/job_system.h"
+#include "foundation/profiler/profiler.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define NULL_MAX_PIPELINES 64
+#define NULL_MAX_TEXTURES 64
+#define NULL_MAX_BINDINGS 16
+#define NULL_INPUT_SLOT 1 // GpuInputState, as bound by compute_graph_execute
+
+typedef struct NullBuffer {
+    void* data;
+    size_t size;
+} NullBuffer;
+
+typedef struct NullTexture {
+    bool active;
+    uint32_t width, height, format;
+} NullTexture;
+
+typedef struct NullRendererState {
+    bool compute_pipelines[NULL_MAX_PIPELINES];  // Index = handle - 1
+    CpuComputeKernel kernels[NULL_MAX_PIPELINES]; // run_rows == NULL for SPIR-V pipelines
+    bool graphics_pipelines[NULL_MAX_PIPELINES];
+    NullTexture textures[NULL_MAX_TEXTURES];
+
+    Stream* compute_bindings[NULL_MAX_BINDINGS];
+    uint8_t* compute_target;  // RGBA8, NULL_COMPUTE_TARGET_SIZE squared, allocated on first use
+    JobSystem* jobs;          // From RenderBackendInit, not owned (NULL = serial)
+
+    RenderCommandList recorded; // Last submitted frame
+    NullRendererStats stats;
+} NullRendererState;
+
+static uint32_t alloc_slot(bool* slots, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        if (!slots[i]) {
+            slots[i] = true;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+static bool free_slot(bool* slots, uint32_t count, uint32_t handle) {
+    if (handle == 0 || handle > count || !slots[handle - 1]) return false;
+    slots[handle - 1] = false;
+    return true;
+}
+
+// --- Lifecycle ---
+
+static bool null_init(RendererBackend* backend, const RenderBackendInit* init) {
+    NullRendererState* state = (NullRendererState*)backend->state;
+    state->jobs = init ? init->jobs : NULL;
+    LOG_INFO("Null renderer: initialized (no GPU, commands are counted only)");
+    return true;
+}
+
+static void null_cleanup(RendererBackend* backend) {
+    if (!backend) return;
+    NullRendererState* state = (NullRendererState*)backend->state;
+    if (state) {
+        if (state->stats.live_buffers > 0) {
+            LOG_WARN("Null renderer: %u buffers still alive at shutdown", state->stats.live_buffers);
+        }
+        for (uint32_t i = 0; i < NULL_MAX_PIPELINES; ++i) {
+            CpuComputeKernel* kernel = &state->kernels[i];
+            if (kernel->destroy) kernel->destroy(kernel->program);
+        }
+        free(state->compute_target);
+        free(state->recorded.commands);
+        free(state);
+    }
+    free(backend);
+}
+
+// --- Core Loop ---
+
+static void null_submit_commands(RendererBackend* backend, const RenderCommandList* commands) {
+    NullRendererState* state = (NullRendererState*)backend->state;
+    state->stats.frames++;
+    state->recorded.count = 0;
+    if (!commands) return;
+
+    if (commands->count > state->recorded.capacity) {
+        RenderCommand* grown = realloc(state->recorded.commands, commands->count * sizeof(RenderCommand));
+        if (!grown) return;
+        state->recorded.commands = grown;
+        state->recorded.capacity = commands->count;
+    }
+    memcpy(state->recorded.commands, commands->commands, commands->count * sizeof(RenderCommand));
+    state->recorded.count = commands->count;
+
+    for (uint32_t i = 0; i < commands->count; ++i) {
+        const RenderCommand* cmd = &commands->commands[i];
+        state->stats.commands++;
+        if ((uint32_t)cmd->type <= RENDER_CMD_END_PASS) state->stats.command_counts[cmd->type]++;
+        switch (cmd->type) {
+            case RENDER_CMD_DRAW:
+                state->stats.draws++;
+                state->stats.instances += cmd->draw.instance_count;
+                break;
+            case RENDER_CMD_DRAW_INDEXED:
+                state->stats.draws++;
+                state->stats.instances += cmd->draw_indexed.instance_count;
+                break;
+            case RENDER_CMD_DRAW_INDIRECT:
+                state->stats.draws += cmd->draw_indirect.draw_count;
+                break;
+            case RENDER_CMD_UPDATE_BUFFER:
+                state->stats.bytes_uploaded += cmd->update_buffer.size;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+static void null_update_viewport(RendererBackend* backend, int width, int height) {
+    NullRendererState* state = (NullRendererState*)backend->state;
+    state->stats.width = width > 0 ? (uint32_t)width : 0;
+    state->stats.height = height > 0 ? (uint32_t)height : 0;
+}
+
+static void null_request_screenshot(RendererBackend* backend, const char* filepath) {
+    (void)backend;
+    LOG_DEBUG("Null renderer: screenshot '%s' skipped (nothing is rendered)", filepath ? filepath : "");
+}
+
+// --- Compute ---
+
+static uint32_t null_compute_pipeline_create(RendererBackend* backend, const void* spirv_code, size_t size, const DescriptorLayoutDef* layouts, uint32_t layout_count) {
+    (void)layouts;
+    (void)layout_count;
+    NullRendererState* state = (NullRendererState*)backend->state;
+    if (!spirv_code || size == 0) return 0;
+    uint32_t handle = alloc_slot(state->compute_pipelines, NULL_MAX_PIPELINES);
+    if (handle) state->stats.live_pipelines++;
+    return handle;
+}
+
+static uint32_t null_compute_pipeline_create_cpu(RendererBackend* backend, const CpuComputeKernel* kernel) {
+    NullRendererState* state = (NullRendererState*)backend->state;
+    if (!kernel || !kernel->run_rows) return 0;
+    uint32_t handle = alloc_slot(state->compute_pipelines, NULL_MAX_PIPELINES);
+    if (!handle) return 0;
+    state->kernels[handle - 1] = *kernel;
+    state->stats.live_pipelines++;
+    return handle;
+}
+
+static void null_compute_pipeline_destroy(RendererBackend* backend, uint32_t pipeline_id) {
+    NullRendererState* state = (NullRendererState*)backend->state;
+    if (!free_slot(state->compute_pipelines, NULL_MAX_PIPELINES, pipeline_id)) return;
+    CpuComputeKernel* kernel = &state->kernels[pipeline_id - 1];
+    if (kernel->destroy) kernel->destroy(kernel->program);
+    memset(kernel, 0, sizeof(*kernel));
+    state->stats.live_pipelines--;
+}
+
+typedef struct CpuDispatch {
+    const CpuComputeKernel* kernel;
+    const GpuInputState* input;
+    CpuComputeImage target;
+} CpuDispatch;
+
+static void run_kernel_rows(void* user_data, uint32_t begin, uint32_t end) {
+    const CpuDispatch* dispatch = (const CpuDispatch*)user_data;
+    PROFILE_BEGIN("cpu_kernel_rows");
+    dispatch->kernel->run_rows(dispatch->kernel->program, dispatch->input, &dispatch->target, begin, end);
+    PROFILE_END();
+}
+
+static uint32_t dispatch_extent(uint32_t groups, uint32_t local_size) {
+    uint64_t extent = (uint64_t)groups * (local_size > 0 ? local_size : 1);
+    return extent < NULL_COMPUTE_TARGET_SIZE ? (uint32_t)extent : NULL_COMPUTE_TARGET_SIZE;
+}
+
+static void null_compute_dispatch(RendererBackend* backend, uint32_t pipeline_id, uint32_t group_x, uint32_t group_y, uint32_t group_z, void* push_constants, size_t push_constants_size) {
+    (void)group_z;
+    (void)push_constants;
+    (void)push_constants_size;
+    NullRendererState* state = (NullRendererState*)backend->state;
+    state->stats.compute_dispatches++;
+
+    if (pipeline_id == 0 || pipeline_id > NULL_MAX_PIPELINES || !state->compute_pipelines[pipeline_id - 1]) return;
+    const CpuComputeKernel* kernel = &state->kernels[pipeline_id - 1];
+    if (!kernel->run_rows) return;
+
+    if (!state->compute_target) {
+        state->compute_target = calloc((size_t)NULL_COMPUTE_TARGET_SIZE * NULL_COMPUTE_TARGET_SIZE, 4);
+        if (!state->compute_target) return;
+    }
+
+    CpuDispatch dispatch = {
+        .kernel = kernel,
+        .target = {
+            .pixels = state->compute_target,
+            .width = dispatch_extent(group_x, kernel->local_size_x),
+            .height = dispatch_extent(group_y, kernel->local_size_y),
+            .stride = NULL_COMPUTE_TARGET_SIZE * 4
+        }
+    };
+    Stream* input = state->compute_bindings[NULL_INPUT_SLOT];
+    NullBuffer* input_buffer = input ? (NullBuffer*)input->buffer_handle : NULL;
+    if (input_buffer && input_buffer->size >= sizeof(GpuInputState)) dispatch.input = (const GpuInputState*)input_buffer->data;
+
+    // Without a job system parallel_for runs every row on this thread
+    PROFILE_BEGIN("null_cpu_dispatch");
+    job_system_parallel_for(state->jobs, dispatch.target.height, 0, run_kernel_rows, &dispatch);
+    PROFILE_END();
+    state->stats.cpu_dispatches++;
+    state->stats.cpu_pixels += (uint64_t)dispatch.target.width * dispatch.target.height;
+}
+
+static void null_compute_wait(RendererBackend* backend) {
+    (void)backend;
+}
+
+// --- Buffers (CPU memory) ---
+
+static bool null_buffer_create(RendererBackend* backend, Stream* stream) {
+    NullRendererState* state = (NullRendererState*)backend->state;
+    NullBuffer* buffer = calloc(1, sizeof(NullBuffer));
+    if (!buffer) return false;
+    buffer->size = stream->total_size;
+    buffer->data = calloc(1, buffer->size > 0 ? buffer->size : 1);
+    if (!buffer->data) {
+        free(buffer);
+        stream->buffer_handle = NULL;
+        return false;
+    }
+    stream->buffer_handle = buffer;
+    state->stats.live_buffers++;
+    return true;
+}
+
+static void null_buffer_destroy(RendererBackend* backend, Stream* stream) {
+    NullRendererState* state = (NullRendererState*)backend->state;
+    NullBuffer* buffer = (NullBuffer*)stream->buffer_handle;
+    if (!buffer) return;
+    for (uint32_t i = 0; i < NULL_MAX_BINDINGS; ++i) {
+        if (state->compute_bindings[i] == stream) state->compute_bindings[i] = NULL;
+    }
+    free(buffer->data);
+    free(buffer);
+    stream->buffer_handle = NULL;
+    state->stats.live_buffers--;
+}
+
+static void* null_buffer_map(RendererBackend* backend, Stream* stream) {
+    (void)backend;
+    NullBuffer* buffer = (NullBuffer*)stream->buffer_handle;
+    return buffer ? buffer->data : NULL;
+}
+
+static void null_buffer_unmap(RendererBackend* backend, Stream* stream) {
+    (void)backend;
+    (void)stream;
+}
+
+static bool null_buffer_upload(RendererBackend* backend, Stream* stream, const void* data, size_t size, size_t offset) {
+    NullRendererState* state = (NullRendererState*)backend->state;
+    NullBuffer* buffer = (NullBuffer*)stream->buffer_handle;
+    if (!buffer || !data || offset > buffer->size || size > buffer->size - offset) return false;
+    memcpy((char*)buffer->data + offset, data, size);
+    state->stats.bytes_uploaded += size;
+    return true;
+}
+
+static bool null_buffer_read(RendererBackend* backend, Stream* stream, void* dst, size_t size, size_t offset) {
+    (void)backend;
+    NullBuffer* buffer = (NullBuffer*)stream->buffer_handle;
+    if (!buffer || !dst || offset > buffer->size || size > buffer->size - offset) return false;
+    memcpy(dst, (const char*)buffer->data + offset, size);
+    return true;
+}
+
+static void null_compute_bind_buffer(RendererBackend* backend, Stream* stream, uint32_t slot) {
+    NullRendererState* state = (NullRendererState*)backend->state;
+    if (slot < NULL_MAX_BINDINGS) state->compute_bindings[slot] = stream;
+}
+
+// --- Graphics ---
+
+static uint32_t null_graphics_pipeline_create(RendererBackend* backend, const void* vert_code, size_t vert_size, const void* frag_code, size_t frag_size, const DescriptorLayoutDef* layouts, uint32_t layout_count, uint32_t flags) {
+    (void)layouts;
+    (void)layout_count;
+    (void)flags;
+    NullRendererState* state = (NullRendererState*)backend->state;
+    if (!vert_code || vert_size == 0 || !frag_code || frag_size == 0) return 0;
+    uint32_t handle = alloc_slot(state->graphics_pipelines, NULL_MAX_PIPELINES);
+    if (handle) state->stats.live_pipelines++;
+    return handle;
+}
+
+static void null_graphics_pipeline_destroy(RendererBackend* backend, uint32_t pipeline_id) {
+    NullRendererState* state = (NullRendererState*)backend->state;
+    if (free_slot(state->graphics_pipelines, NULL_MAX_PIPELINES, pipeline_id)) state->stats.live_pipelines--;
+}
+
+static void null_graphics_bind_buffer(RendererBackend* backend, Stream* stream, uint32_t slot) {
+    (void)backend;
+    (void)stream;
+    (void)slot;
+}
+
+static void null_graphics_draw(RendererBackend* backend, uint32_t pipeline_id, uint32_t vertex_count, uint32_t instance_count) {
+    (void)pipeline_id;
+    (void)vertex_count;
+    NullRendererState* state = (NullRendererState*)backend->state;
+    state->stats.draws++;
+    state->stats.instances += instance_count;
+}
+
+// --- Textures (metadata only) ---
+
+static uint32_t null_texture_create(RendererBackend* backend, uint32_t width, uint32_t height, uint32_t format) {
+    NullRendererState* state = (NullRendererState*)backend->state;
+    for (uint32_t i = 0; i < NULL_MAX_TEXTURES; ++i) {
+        NullTexture* tex = &state->textures[i];
+        if (tex->active) continue;
+        *tex = (NullTexture){ .active = true, .width = width, .height = height, .format = format };
+        state->stats.live_textures++;
+        return i + 1;
+    }
+    LOG_ERROR("Null renderer: texture pool exhausted");
+    return 0;
+}
+
+static NullTexture* get_texture(NullRendererState* state, uint32_t handle) {
+    if (handle == 0 || handle > NULL_MAX_TEXTURES || !state->textures[handle - 1].active) return NULL;
+    return &state->textures[handle - 1];
+}
+
+static void null_texture_destroy(RendererBackend* backend, uint32_t handle) {
+    NullRendererState* state = (NullRendererState*)backend->state;
+    NullTexture* tex = get_texture(state, handle);
+    if (!tex) return;
+    tex->active = false;
+    state->stats.live_textures--;
+}
+
+static void null_texture_resize(RendererBackend* backend, uint32_t handle, uint32_t width, uint32_t height) {
+    NullTexture* tex = get_texture((NullRendererState*)backend->state, handle);
+    if (!tex) return;
+    tex->width = width;
+    tex->height = height;
+}
+
+static void* null_texture_get_descriptor(RendererBackend* backend, uint32_t handle) {
+    // Any stable non-NULL pointer: callers only pass it back in commands
+    return get_texture((NullRendererState*)backend->state, handle);
+}
+
+// --- Public ---
+
+RendererBackend* null_renderer_backend(void) {
+    RendererBackend* backend = (RendererBackend*)calloc(1, sizeof(RendererBackend));
+    if (!backend) return NULL;
+
+    NullRendererState* state = (NullRendererState*)calloc(1, sizeof(NullRendererState));
+    if (!state) {
+        free(backend);
+        return NULL;
+    }
+
+    backend->id = "null";
+    backend->state = state;
+    backend->init = null_init;
+    backend->cleanup = null_cleanup;
+    backend->submit_commands = null_submit_commands;
+    backend->update_viewport = null_update_viewport;
+    backend->request_screenshot = null_request_screenshot;
+
+    // Compute (no compile_shader: runtime GLSL is not supported, graphs run as CPU kernels)
+    backend->compute_pipeline_create = null_compute_pipeline_create;
+    backend->compute_pipeline_create_cpu = null_compute_pipeline_create_cpu;
+    backend->compute_pipeline_destroy = null_compute_pipeline_destroy;
+    backend->compute_dispatch = null_compute_dispatch;
+    backend->compute_wait = null_compute_wait;
+
+    // Buffer
+    backend->buffer_create = null_buffer_create;
+    backend->buffer_destroy = null_buffer_destroy;
+    backend->buffer_map = null_buffer_map;
+    backend->buffer_unmap = null_buffer_unmap;
+    backend->buffer_upload = null_buffer_upload;
+    backend->buffer_read = null_buffer_read;
+    backend->compute_bind_buffer = null_compute_bind_buffer;
+
+    // Graphics
+    backend->graphics_pipeline_create = null_graphics_pipeline_create;
+    backend->graphics_pipeline_destroy = null_graphics_pipeline_destroy;
+    backend->graphics_bind_buffer = null_graphics_bind_buffer;
+    backend->graphics_draw = null_graphics_draw;
+
+    backend->texture_create = null_texture_create;
+    backend->texture_destroy = null_texture_destroy;
+    backend->texture_resize = null_texture_resize;
+    backend->texture_get_descriptor = null_texture_get_descriptor;
+
+    return backend;
+}
+
+bool null_renderer_get_stats(const RendererBackend* backend, NullRendererStats* out) {
+    if (!backend || !out || !backend->id || strcmp(backend->id, "null") != 0) return false;
+    *out = ((const NullRendererState*)backend->state)->stats;
+    return true;
+}
+
+const RenderCommandList* null_renderer_last_commands(const RendererBackend* backend) {
+    if (!backend || !backend->id || strcmp(backend->id, "null") != 0) return NULL;
+    return &((const NullRendererState*)backend->state)->recorded;
+}
+
+bool null_renderer_get_compute_target(const RendererBackend* backend, CpuComputeImage* out) {
+    if (!backend || !out || !backend->id || strcmp(backend->id, "null") != 0) return false;
+    const NullRendererState* state = (const NullRendererState*)backend->state;
+    if (!state->compute_target) return false;
+    *out = (CpuComputeImage){
+        .pixels = state->compute_target,
+        .width = NULL_COMPUTE_TARGET_SIZE,
+        .height = NULL_COMPUTE_TARGET_SIZE,
+        .stride = NULL_COMPUTE_TARGET_SIZE * 4
+    };
+    return true;
+}
@@ -0,0 +1,44 @@
+#ifndef NULL_RENDERER_H
+#define NULL_RENDERER_H
+
+#include "engine/graphics/internal/backend/renderer_backend.h"
+#include "engine/graphics/cpu_compute.h"
+
+// --- Null Backend ("null") ---
+// Implements the whole RendererBackend vtable without a GPU or window. Buffers live in
+// CPU memory (uploads, maps and reads work) and command lists are copied and counted
+// instead of executed. Compute pipelines created from CPU kernels (cpu_compute.h) run
+// across worker threads into a CPU compute target; SPIR-V dispatches are no-ops. Used by
+// the headless engine mode to measure CPU-side frame cost and to run the frame loop in CI.
+
+// Same size as the Vulkan backend's compute target
+#define NULL_COMPUTE_TARGET_SIZE 512
+
+typedef struct NullRendererStats {
+    uint64_t frames;             // submit_commands calls
+    uint64_t commands;           // Recorded commands of every type
+    uint64_t command_counts[RENDER_CMD_END_PASS + 1]; // Per RenderCommandType
+    uint64_t draws;              // Draw commands plus graphics_draw calls
+    uint64_t instances;
+    uint64_t compute_dispatches;
+    uint64_t cpu_dispatches;     // Dispatches that ran a CPU kernel
+    uint64_t cpu_pixels;         // Pixels those dispatches covered
+    uint64_t bytes_uploaded;
+    uint32_t live_buffers;
+    uint32_t live_pipelines;     // Compute + graphics
+    uint32_t live_textures;
+    uint32_t width, height;      // Last viewport
+} NullRendererStats;
+
+RendererBackend* null_renderer_backend(void);
+
+// Returns false if 'backend' is not a null backend.
+bool null_renderer_get_stats(const RendererBackend* backend, NullRendererStats* out);
+
+// The command list of the last submit_commands call (copied, so it outlives the frame).
+const RenderCommandList* null_renderer_last_commands(const RendererBackend* backend);
+
+// The RGBA8 image CPU kernels write to. False before the first CPU dispatch.
+bool null_renderer_get_compute_target(const RendererBackend* backend, CpuComputeImage* out);
+
+#endif // NULL_RENDERER_H
@@ -3,26 +3,34 @@
 #include <stdlib.h>
 
 #define MAX_BACKENDS 8
-static RendererBackend* registry[MAX_BACKENDS] = {0};
+
+typedef struct {
+    const char* id;
+    RendererBackendFactory factory;
+} RendererBackendEntry;
+
+static RendererBackendEntry registry[MAX_BACKENDS] = {0};
 static int registry_count = 0;
 
-bool renderer_backend_register(RendererBackend* backend) {
-    if (!backend || registry_count >= MAX_BACKENDS) return false;
-    registry[registry_count++] = backend;
+bool renderer_backend_register(const char* id, RendererBackendFactory factory) {
+    if (!id || !factory) return false;
+    for (int i = 0; i < registry_count; ++i) {
+        if (strcmp(registry[i].id, id) == 0) {
+            registry[i].factory = factory;
+            return true;
+        }
+    }
+    if (registry_count >= MAX_BACKENDS) return false;
+    registry[registry_count++] = (RendererBackendEntry){ id, factory };
     return true;
 }
 
-RendererBackend* renderer_backend_get(const char* id) {
+RendererBackend* renderer_backend_create(const char* id) {
     if (!id) return NULL;
     for (int i = 0; i < registry_count; ++i) {
-        if (strcmp(registry[i]->id, id) == 0) {
-            return registry[i];
+        if (strcmp(registry[i].id, id) == 0) {
+            return registry[i].factory();
         }
     }
     return NULL;
 }
-
-RendererBackend* renderer_backend_default(void) {
-    if (registry_count > 0) return registry[0];
-    return NULL;
-}
@@ -12,6 +12,8 @@ typedef struct PlatformSurface PlatformSurface;
 typedef struct Scene Scene;
 typedef struct Font Font;
 typedef struct Stream Stream;
+typedef struct CpuComputeKernel CpuComputeKernel;
+typedef struct JobSystem JobSystem;
 
 // Backend Initialization Parameters
 typedef struct RenderBackendInit {
@@ -29,6 +31,8 @@ typedef struct RenderBackendInit {
         const void* data;
         size_t size;
     } frag_shader;
+
+    JobSystem* jobs; // Engine worker pool for CPU-side backend work (NULL = calling thread)
 } RenderBackendInit;
 
 // The Abstract Renderer Interface (V-Table)
@@ -41,6 +45,10 @@ typedef struct RendererBackend {
     void (*cleanup)(struct RendererBackend* backend);
 
     // Core Loop
+    // Optional: Blocks until the GPU is done with the next frame slot and returns its index
+    // in [0, RENDER_FRAMES_IN_FLIGHT); the following submit_commands uses the same slot.
+    // Backends without frames in flight leave it NULL.
+    uint32_t (*begin_frame)(struct RendererBackend* backend);
     void (*submit_commands)(struct RendererBackend* backend, const RenderCommandList* commands);
     void (*update_viewport)(struct RendererBackend* backend, int width, int height);
 
@@ -54,6 +62,11 @@ typedef struct RendererBackend {
     // 'layouts': Array of descriptor set layouts. 'layout_count': Number of sets.
     uint32_t (*compute_pipeline_create)(struct RendererBackend* backend, const void* spirv_code, size_t size, const DescriptorLayoutDef* layouts, uint32_t layout_count);
     
+    // Optional: Create a compute pipeline that runs 'kernel' on the CPU (cpu_compute.h).
+    // Returns a handle > 0 on success; the backend then owns the kernel and destroys it
+    // with the pipeline. On failure the caller keeps it.
+    uint32_t (*compute_pipeline_create_cpu)(struct RendererBackend* backend, const CpuComputeKernel* kernel);
+
     // Destroy a compute pipeline.
     void (*compute_pipeline_destroy)(struct RendererBackend* backend, uint32_t pipeline_id);
     
@@ -67,10 +80,19 @@ typedef struct RendererBackend {
     // Sync: Wait for compute to finish (memory barrier).
     void (*compute_wait)(struct RendererBackend* backend);
 
+    // Optional: Batch dispatches. Dispatches between begin and end are recorded with
+    // barriers between them and submitted once at the outermost end; calls nest.
+    // Buffer reads and compute_wait inside a batch submit what was recorded so far.
+    void (*compute_begin)(struct RendererBackend* backend);
+    void (*compute_end)(struct RendererBackend* backend);
+
     // Optional: Compile high-level shader source to bytecode
     // Returns true on success. Allocates out_spv (caller must free).
     // stage: "compute", "vertex", "fragment"
-    bool (*compile_shader)(struct RendererBackend* backend, const char* source, size_t size, const char* stage, void** out_spv, size_t* out_spv_size);
+    // Compiler errors/warnings go to out_diagnostics (may be NULL). Must be callable
+    // from several threads at once.
+    bool (*compile_shader)(struct RendererBackend* backend, const char* source, size_t size, const char* stage,
+                           void** out_spv, size_t* out_spv_size, ShaderDiagnostics* out_diagnostics);
 
     // --- Buffer Management (SSBO / Vertex) ---
     // Create a GPU buffer. type: 0=SSBO/Vertex, 1=Staging/Transfer.
@@ -118,8 +140,11 @@ typedef struct RendererBackend {
 } RendererBackend;
 
 // Registry / Factory
-bool renderer_backend_register(RendererBackend* backend);
-RendererBackend* renderer_backend_get(const char* id);
-RendererBackend* renderer_backend_default(void);
+// Backends register a factory per id; every render system creates its own instance,
+// which its cleanup frees. Registering an id again replaces its factory.
+typedef RendererBackend* (*RendererBackendFactory)(void);
+
+bool renderer_backend_register(const char* id, RendererBackendFactory factory);
+RendererBackend* renderer_backend_create(const char* id);
 
 #endif // RENDERER_BACKEND_H
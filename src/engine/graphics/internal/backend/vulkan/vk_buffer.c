@@ -1,5 +1,8 @@
 #include "vk_buffer.h"
 #include "vk_utils.h"
+#include "vk_memory.h"
+#include "vk_staging.h"
+#include "vk_descriptor_cache.h"
 #include "foundation/logger/logger.h"
 #include <string.h>
 
@@ -9,7 +12,7 @@ bool vk_buffer_create(VulkanRendererState* state, VkDeviceSize size, VkBufferUsa
     out_buffer->memory_props = props;
     out_buffer->mapped_data = NULL;
     out_buffer->buffer = VK_NULL_HANDLE;
-    out_buffer->memory = VK_NULL_HANDLE;
+    memset(&out_buffer->allocation, 0, sizeof(out_buffer->allocation));
 
     VkBufferCreateInfo bci = { 
         .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO, 
@@ -23,61 +26,42 @@ bool vk_buffer_create(VulkanRendererState* state, VkDeviceSize size, VkBufferUsa
         return false;
     }
 
-    VkMemoryRequirements mr; 
-    vkGetBufferMemoryRequirements(state->device, out_buffer->buffer, &mr);
-    
-    VkMemoryAllocateInfo mai = { 
-        .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, 
-        .allocationSize = mr.size, 
-        .memoryTypeIndex = find_mem_type(state->physical_device, mr.memoryTypeBits, props) 
-    };
-    
-    res = vkAllocateMemory(state->device, &mai, NULL, &out_buffer->memory);
-    if (res != VK_SUCCESS) {
-        LOG_ERROR("vkAllocateMemory failed: %d", res);
+    // Sub-allocated from a shared block instead of one vkAllocateMemory per buffer
+    if (!vk_memory_bind_buffer(state, out_buffer->buffer, props, &out_buffer->allocation)) {
         vkDestroyBuffer(state->device, out_buffer->buffer, NULL);
         out_buffer->buffer = VK_NULL_HANDLE;
         return false;
     }
 
-    vkBindBufferMemory(state->device, out_buffer->buffer, out_buffer->memory, 0);
+    out_buffer->mapped_data = out_buffer->allocation.mapped;
     return true;
 }
 
 void vk_buffer_destroy(VulkanRendererState* state, VkBufferWrapper* buffer) {
     if (buffer->buffer) {
+        vk_staging_cancel(state, buffer->buffer);
+        vk_descriptor_cache_forget_buffer(state, buffer->buffer);
         vkDestroyBuffer(state->device, buffer->buffer, NULL);
         buffer->buffer = VK_NULL_HANDLE;
     }
-    if (buffer->memory) {
-        vkFreeMemory(state->device, buffer->memory, NULL);
-        buffer->memory = VK_NULL_HANDLE;
-    }
+    vk_memory_free(state, &buffer->allocation);
     buffer->mapped_data = NULL;
     buffer->size = 0;
 }
 
 void* vk_buffer_map(VulkanRendererState* state, VkBufferWrapper* buffer) {
-    if (buffer->mapped_data) return buffer->mapped_data;
-    
+    (void)state;
     // We can only map HOST_VISIBLE memory
-    if (!(buffer->memory_props & (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))) {
+    if (!buffer->mapped_data) {
         LOG_ERROR("Attempting to map non-host-visible buffer");
         return NULL;
     }
-
-    VkResult res = vkMapMemory(state->device, buffer->memory, 0, VK_WHOLE_SIZE, 0, &buffer->mapped_data);
-    if (res != VK_SUCCESS) {
-        LOG_ERROR("vkMapMemory failed: %d", res);
-        return NULL;
-    }
     return buffer->mapped_data;
 }
 
 void vk_buffer_unmap(VulkanRendererState* state, VkBufferWrapper* buffer) {
     if (buffer->mapped_data) {
-        vkUnmapMemory(state->device, buffer->memory);
-        buffer->mapped_data = NULL;
+        vk_memory_flush(state, &buffer->allocation, 0, buffer->size);
     }
 }
 
@@ -88,44 +72,17 @@ bool vk_buffer_upload(VulkanRendererState* state, VkBufferWrapper* buffer, const
         return false;
     }
 
-    // Direct copy if Host Visible
+    // Direct copy if Host Visible (the block is persistently mapped)
     if (buffer->memory_props & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
         void* ptr = vk_buffer_map(state, buffer);
         if (!ptr) return false;
         
         memcpy((uint8_t*)ptr + offset, data, size);
-        
-        if (!(buffer->memory_props & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) {
-             VkMappedMemoryRange range = { 
-                 .sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, 
-                 .memory = buffer->memory, 
-                 .offset = offset, 
-                 .size = size 
-             };
-             vkFlushMappedMemoryRanges(state->device, 1, &range);
-        }
-        vk_buffer_unmap(state, buffer);
+        vk_memory_flush(state, &buffer->allocation, offset, size);
         return true;
     } else {
-        // Staging Buffer for Device Local memory
-        VkBufferWrapper staging;
-        if (!vk_buffer_create(state, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, &staging)) {
-            return false;
-        }
-        
-        void* ptr = vk_buffer_map(state, &staging);
-        if (ptr) {
-            memcpy(ptr, data, size);
-            vk_buffer_unmap(state, &staging);
-
-            VkCommandBuffer cb = vk_begin_single_time_commands(state);
-            VkBufferCopy copy = { .srcOffset = 0, .dstOffset = offset, .size = size };
-            vkCmdCopyBuffer(cb, staging.buffer, buffer->buffer, 1, &copy);
-            vk_end_single_time_commands(state, cb);
-        }
-
-        vk_buffer_destroy(state, &staging);
-        return ptr != NULL;
+        // Device Local: queued on the frame's staging ring, copied by the next submit
+        return vk_staging_upload(state, buffer, data, size, offset);
     }
 }
 
@@ -138,18 +95,8 @@ bool vk_buffer_read(VulkanRendererState* state, VkBufferWrapper* buffer, void* d
         void* ptr = vk_buffer_map(state, buffer);
         if (!ptr) return false;
 
-        if (!(buffer->memory_props & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) {
-             VkMappedMemoryRange range = { 
-                 .sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, 
-                 .memory = buffer->memory, 
-                 .offset = offset, 
-                 .size = size 
-             };
-             vkInvalidateMappedMemoryRanges(state->device, 1, &range);
-        }
-        
+        vk_memory_invalidate(state, &buffer->allocation, offset, size);
         memcpy(dst, (uint8_t*)ptr + offset, size);
-        vk_buffer_unmap(state, buffer);
         return true;
     } else {
         // Staging Buffer
@@ -159,6 +106,7 @@ bool vk_buffer_read(VulkanRendererState* state, VkBufferWrapper* buffer, void* d
         }
 
         VkCommandBuffer cb = vk_begin_single_time_commands(state);
+        vk_staging_record(state, cb, VK_NULL_HANDLE); // Pending uploads land before the readback
         VkBufferCopy copy = { .srcOffset = offset, .dstOffset = 0, .size = size };
         vkCmdCopyBuffer(cb, buffer->buffer, staging.buffer, 1, &copy);
         
@@ -179,8 +127,8 @@ bool vk_buffer_read(VulkanRendererState* state, VkBufferWrapper* buffer, void* d
 
         void* ptr = vk_buffer_map(state, &staging);
         if (ptr) {
+            vk_memory_invalidate(state, &staging.allocation, 0, size);
             memcpy(dst, ptr, size);
-            vk_buffer_unmap(state, &staging);
         }
         
         vk_buffer_destroy(state, &staging);
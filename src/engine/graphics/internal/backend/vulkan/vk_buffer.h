@@ -6,11 +6,11 @@
 // Unified Buffer wrapper
 typedef struct VkBufferWrapper {
     VkBuffer buffer;
-    VkDeviceMemory memory;
+    GpuAllocation allocation; // Placement inside a shared device memory block
     VkDeviceSize size;
     VkBufferUsageFlags usage;
     VkMemoryPropertyFlags memory_props;
-    void* mapped_data; // NULL if not mapped
+    void* mapped_data; // Persistent mapping for host-visible buffers, NULL otherwise
 } VkBufferWrapper;
 
 // Creates a buffer on the GPU.
@@ -21,14 +21,14 @@ bool vk_buffer_create(VulkanRendererState* state, VkDeviceSize size, VkBufferUsa
 // Destroys the buffer.
 void vk_buffer_destroy(VulkanRendererState* state, VkBufferWrapper* buffer);
 
-// Maps memory (if host visible). Returns pointer.
+// Returns the persistent mapping (if host visible).
 void* vk_buffer_map(VulkanRendererState* state, VkBufferWrapper* buffer);
 
-// Unmaps memory.
+// Host-visible blocks stay mapped for their lifetime; this only flushes non-coherent memory.
 void vk_buffer_unmap(VulkanRendererState* state, VkBufferWrapper* buffer);
 
 // Uploads data to the buffer.
-// If buffer is HOST_VISIBLE, maps and copies.
+// If buffer is HOST_VISIBLE, copies through the persistent mapping.
 // If DEVICE_LOCAL, uses a staging buffer.
 bool vk_buffer_upload(VulkanRendererState* state, VkBufferWrapper* buffer, const void* data, VkDeviceSize size, VkDeviceSize offset);
 
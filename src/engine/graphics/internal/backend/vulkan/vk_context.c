@@ -3,6 +3,7 @@
 #include "foundation/logger/logger.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 static void log_gpu_info(VkPhysicalDevice dev) {
     VkPhysicalDeviceProperties props;
@@ -29,6 +30,23 @@ static void log_gpu_info(VkPhysicalDevice dev) {
            VK_VERSION_PATCH(props.apiVersion));
 }
 
+static bool has_device_extension(VkPhysicalDevice dev, const char* name) {
+    uint32_t count = 0;
+    vkEnumerateDeviceExtensionProperties(dev, NULL, &count, NULL);
+    if (count == 0) return false;
+
+    VkExtensionProperties* props = malloc(sizeof(VkExtensionProperties) * count);
+    if (!props) return false;
+    vkEnumerateDeviceExtensionProperties(dev, NULL, &count, props);
+
+    bool found = false;
+    for (uint32_t i = 0; i < count && !found; ++i) {
+        found = strcmp(props[i].extensionName, name) == 0;
+    }
+    free(props);
+    return found;
+}
+
 void vk_create_instance(VulkanRendererState* state) {
     VkApplicationInfo ai = { .sType = VK_STRUCTURE_TYPE_APPLICATION_INFO, .pApplicationName = "vk_gui", .apiVersion = VK_API_VERSION_1_0 };
     VkInstanceCreateInfo ici = { .sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO, .pApplicationInfo = &ai };
@@ -100,13 +118,23 @@ void vk_pick_physical_and_create_device(VulkanRendererState* state) {
 
     float prio = 1.0f;
     VkDeviceQueueCreateInfo qci = { .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO, .queueFamilyIndex = state->graphics_family, .queueCount = 1, .pQueuePriorities = &prio };
-    const char* dev_ext[] = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
-    VkDeviceCreateInfo dci = { .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO, .queueCreateInfoCount = 1, .pQueueCreateInfos = &qci, .enabledExtensionCount = 1, .ppEnabledExtensionNames = dev_ext };
+    const char* dev_ext[2] = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+    uint32_t dev_ext_count = 1;
+    bool push_descriptor = has_device_extension(state->physical_device, VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+    if (push_descriptor) dev_ext[dev_ext_count++] = VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME;
+    VkDeviceCreateInfo dci = { .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO, .queueCreateInfoCount = 1, .pQueueCreateInfos = &qci, .enabledExtensionCount = dev_ext_count, .ppEnabledExtensionNames = dev_ext };
     
     state->res = vkCreateDevice(state->physical_device, &dci, NULL, &state->device);
     if (state->res != VK_SUCCESS) fatal_vk("vkCreateDevice", state->res);
     
     vkGetDeviceQueue(state->device, state->graphics_family, 0, &state->queue);
+
+    // Compute storage buffers are pushed straight into the command buffer when available
+    state->cmd_push_descriptor_set = NULL;
+    if (push_descriptor) {
+        state->cmd_push_descriptor_set = (PFN_vkCmdPushDescriptorSetKHR)vkGetDeviceProcAddr(state->device, "vkCmdPushDescriptorSetKHR");
+    }
+    LOG_DEBUG("VK_KHR_push_descriptor: %s", state->cmd_push_descriptor_set ? "enabled" : "unavailable");
 }
 
 void vk_recreate_instance_and_surface(VulkanRendererState* state) {
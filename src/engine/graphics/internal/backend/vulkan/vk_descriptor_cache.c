@@ -0,0 +1,192 @@
+#include "vk_descriptor_cache.h"
+#include "foundation/logger/logger.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Open addressing at <= 50% load: the table is twice the pool size
+#define CACHE_TABLE_SIZE (VK_DESCRIPTOR_CACHE_MAX_SETS * 2)
+
+// Keys are compared bytewise, so they are always fully zeroed before being filled
+typedef struct {
+    VkPipelineLayout layout;
+    VkBuffer buffers[MAX_COMPUTE_BINDINGS];
+} DescriptorCacheKey;
+
+struct DescriptorCacheEntry {
+    bool used;
+    DescriptorCacheKey key;
+    VkDescriptorSet set;
+};
+
+static uint32_t hash_key(const DescriptorCacheKey* key) {
+    // FNV-1a over the raw handles
+    const uint8_t* bytes = (const uint8_t*)key;
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < sizeof(*key); ++i) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static struct DescriptorCacheEntry* find_slot(VulkanRendererState* state, const DescriptorCacheKey* key) {
+    uint32_t index = hash_key(key) & (CACHE_TABLE_SIZE - 1);
+    for (;;) {
+        struct DescriptorCacheEntry* entry = &state->descriptor_cache[index];
+        if (!entry->used || memcmp(&entry->key, key, sizeof(*key)) == 0) return entry;
+        index = (index + 1) & (CACHE_TABLE_SIZE - 1);
+    }
+}
+
+bool vk_descriptor_cache_init(VulkanRendererState* state) {
+    state->descriptor_cache = calloc(CACHE_TABLE_SIZE, sizeof(struct DescriptorCacheEntry));
+    if (!state->descriptor_cache) return false;
+
+    VkDescriptorPoolSize size = { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_DESCRIPTOR_CACHE_MAX_SETS * MAX_COMPUTE_BINDINGS };
+    VkDescriptorPoolCreateInfo dpci = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+        .maxSets = VK_DESCRIPTOR_CACHE_MAX_SETS,
+        .poolSizeCount = 1,
+        .pPoolSizes = &size
+    };
+    if (vkCreateDescriptorPool(state->device, &dpci, NULL, &state->descriptor_cache_pool) != VK_SUCCESS) {
+        LOG_ERROR("Failed to create compute descriptor cache pool");
+        free(state->descriptor_cache);
+        state->descriptor_cache = NULL;
+        return false;
+    }
+    state->descriptor_cache_count = 0;
+    state->descriptor_cache_sets = 0;
+    return true;
+}
+
+void vk_descriptor_cache_destroy(VulkanRendererState* state) {
+    if (state->descriptor_cache_pool) {
+        vkDestroyDescriptorPool(state->device, state->descriptor_cache_pool, NULL);
+        state->descriptor_cache_pool = VK_NULL_HANDLE;
+    }
+    free(state->descriptor_cache);
+    state->descriptor_cache = NULL;
+    state->descriptor_cache_count = 0;
+    state->descriptor_cache_sets = 0;
+}
+
+VkDescriptorSet vk_descriptor_cache_get(VulkanRendererState* state, VkPipelineLayout layout, VkDescriptorSetLayout set_layout,
+                                        uint32_t binding_mask, const VkBuffer buffers[MAX_COMPUTE_BINDINGS]) {
+    if (!state->descriptor_cache) return VK_NULL_HANDLE;
+
+    DescriptorCacheKey key;
+    memset(&key, 0, sizeof(key));
+    key.layout = layout;
+    for (int i = 0; i < MAX_COMPUTE_BINDINGS; ++i) {
+        if (binding_mask & (1u << i)) key.buffers[i] = buffers[i];
+    }
+
+    struct DescriptorCacheEntry* entry = find_slot(state, &key);
+    if (entry->used) return entry->set;
+
+    if (state->descriptor_cache_sets >= VK_DESCRIPTOR_CACHE_MAX_SETS) return VK_NULL_HANDLE;
+
+    VkDescriptorSetAllocateInfo dsai = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+        .descriptorPool = state->descriptor_cache_pool,
+        .descriptorSetCount = 1,
+        .pSetLayouts = &set_layout
+    };
+    VkDescriptorSet set = VK_NULL_HANDLE;
+    if (vkAllocateDescriptorSets(state->device, &dsai, &set) != VK_SUCCESS) return VK_NULL_HANDLE;
+    state->descriptor_cache_sets++;
+
+    VkWriteDescriptorSet writes[MAX_COMPUTE_BINDINGS];
+    VkDescriptorBufferInfo dbis[MAX_COMPUTE_BINDINGS];
+    uint32_t write_count = 0;
+    for (uint32_t i = 0; i < MAX_COMPUTE_BINDINGS; ++i) {
+        if (!key.buffers[i]) continue;
+        dbis[write_count] = (VkDescriptorBufferInfo){ .buffer = key.buffers[i], .offset = 0, .range = VK_WHOLE_SIZE };
+        writes[write_count] = (VkWriteDescriptorSet){
+            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .dstSet = set,
+            .dstBinding = i,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+            .pBufferInfo = &dbis[write_count]
+        };
+        write_count++;
+    }
+    if (write_count > 0) {
+        vkUpdateDescriptorSets(state->device, write_count, writes, 0, NULL);
+    }
+
+    entry->used = true;
+    entry->key = key;
+    entry->set = set;
+    state->descriptor_cache_count++;
+    return set;
+}
+
+void vk_descriptor_cache_reset(VulkanRendererState* state) {
+    if (!state->descriptor_cache) return;
+    if (state->descriptor_cache_sets > 0) {
+        vkResetDescriptorPool(state->device, state->descriptor_cache_pool, 0);
+        LOG_TRACE("Descriptor cache: reset (%u sets, %u live)", state->descriptor_cache_sets, state->descriptor_cache_count);
+    }
+    memset(state->descriptor_cache, 0, CACHE_TABLE_SIZE * sizeof(struct DescriptorCacheEntry));
+    state->descriptor_cache_count = 0;
+    state->descriptor_cache_sets = 0;
+}
+
+void vk_descriptor_cache_trim(VulkanRendererState* state) {
+    // Leaves a quarter of the pool for the keys one batch can introduce
+    if (state->descriptor_cache_sets >= VK_DESCRIPTOR_CACHE_MAX_SETS * 3 / 4) {
+        vk_descriptor_cache_reset(state);
+    }
+}
+
+// Removes matching entries and re-inserts the rest (deletion breaks probe chains)
+static void forget_where(VulkanRendererState* state, bool (*match)(const DescriptorCacheKey*, const void*), const void* object) {
+    if (!state->descriptor_cache || state->descriptor_cache_count == 0) return;
+
+    struct DescriptorCacheEntry* kept = malloc(state->descriptor_cache_count * sizeof(struct DescriptorCacheEntry));
+    if (!kept) {
+        // Losing the whole table is safe; its sets are reclaimed at the next reset
+        memset(state->descriptor_cache, 0, CACHE_TABLE_SIZE * sizeof(struct DescriptorCacheEntry));
+        state->descriptor_cache_count = 0;
+        return;
+    }
+
+    uint32_t kept_count = 0;
+    for (uint32_t i = 0; i < CACHE_TABLE_SIZE; ++i) {
+        struct DescriptorCacheEntry* entry = &state->descriptor_cache[i];
+        if (entry->used && !match(&entry->key, object)) kept[kept_count++] = *entry;
+    }
+    if (kept_count != state->descriptor_cache_count) {
+        memset(state->descriptor_cache, 0, CACHE_TABLE_SIZE * sizeof(struct DescriptorCacheEntry));
+        for (uint32_t i = 0; i < kept_count; ++i) {
+            *find_slot(state, &kept[i].key) = kept[i];
+        }
+        state->descriptor_cache_count = kept_count;
+    }
+    free(kept);
+}
+
+static bool key_has_buffer(const DescriptorCacheKey* key, const void* object) {
+    VkBuffer buffer = *(const VkBuffer*)object;
+    for (int i = 0; i < MAX_COMPUTE_BINDINGS; ++i) {
+        if (key->buffers[i] == buffer) return true;
+    }
+    return false;
+}
+
+static bool key_has_layout(const DescriptorCacheKey* key, const void* object) {
+    return key->layout == *(const VkPipelineLayout*)object;
+}
+
+void vk_descriptor_cache_forget_buffer(VulkanRendererState* state, VkBuffer buffer) {
+    if (!buffer) return;
+    forget_where(state, key_has_buffer, &buffer);
+}
+
+void vk_descriptor_cache_forget_layout(VulkanRendererState* state, VkPipelineLayout layout) {
+    if (!layout) return;
+    forget_where(state, key_has_layout, &layout);
+}
@@ -0,0 +1,37 @@
+#ifndef VK_DESCRIPTOR_CACHE_H
+#define VK_DESCRIPTOR_CACHE_H
+
+#include "vk_types.h"
+
+// --- Compute Descriptor Cache ---
+// Storage-buffer sets (Set 1) for compute dispatches, keyed by (pipeline layout, bound
+// buffers). A set is written once when its key first appears and re-bound afterwards,
+// so steady-state dispatches do no vkUpdateDescriptorSets at all.
+//
+// Sets come from one dedicated pool that is only reset while no compute work is in
+// flight (vk_descriptor_cache_trim / _reset). Devices with VK_KHR_push_descriptor do
+// not use the cache for pipelines whose Set 1 is a push descriptor set.
+
+#define VK_DESCRIPTOR_CACHE_MAX_SETS 256
+
+bool vk_descriptor_cache_init(VulkanRendererState* state);
+void vk_descriptor_cache_destroy(VulkanRendererState* state);
+
+// Returns the set holding 'buffers' (VK_NULL_HANDLE = unused binding) for 'layout'.
+// 'binding_mask' selects the bindings that exist in 'set_layout'.
+// Returns VK_NULL_HANDLE when the pool is exhausted; reset it once the GPU is idle and retry.
+VkDescriptorSet vk_descriptor_cache_get(VulkanRendererState* state, VkPipelineLayout layout, VkDescriptorSetLayout set_layout,
+                                        uint32_t binding_mask, const VkBuffer buffers[MAX_COMPUTE_BINDINGS]);
+
+// Resets the pool if it is mostly used up. Call only while no compute work is in flight.
+void vk_descriptor_cache_trim(VulkanRendererState* state);
+
+// Drops every set unconditionally. Same requirements as trim.
+void vk_descriptor_cache_reset(VulkanRendererState* state);
+
+// Drops entries that reference an object about to be destroyed, so a recycled handle
+// never hits a stale set. Their sets are reclaimed at the next reset.
+void vk_descriptor_cache_forget_buffer(VulkanRendererState* state, VkBuffer buffer);
+void vk_descriptor_cache_forget_layout(VulkanRendererState* state, VkPipelineLayout layout);
+
+#endif // VK_DESCRIPTOR_CACHE_H
@@ -0,0 +1,181 @@
+#include "vk_memory.h"
+#include "vk_utils.h"
+#include "foundation/logger/logger.h"
+#include <string.h>
+
+// VkDeviceMemory is a pointer on 64-bit targets and a uint64_t elsewhere
+static uint64_t memory_to_u64(VkDeviceMemory memory) {
+#if VK_USE_64_BIT_PTR_DEFINES == 1
+    return (uint64_t)(uintptr_t)memory;
+#else
+    return (uint64_t)memory;
+#endif
+}
+
+static VkDeviceMemory memory_from_u64(uint64_t memory) {
+#if VK_USE_64_BIT_PTR_DEFINES == 1
+    return (VkDeviceMemory)(uintptr_t)memory;
+#else
+    return (VkDeviceMemory)memory;
+#endif
+}
+
+// --- Heap ---
+
+static bool heap_allocate(void* user, uint32_t memory_type, uint64_t size, uint64_t* out_memory, void** out_mapped) {
+    VulkanRendererState* state = (VulkanRendererState*)user;
+    VkMemoryAllocateInfo mai = {
+        .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+        .allocationSize = size,
+        .memoryTypeIndex = memory_type
+    };
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkResult res = vkAllocateMemory(state->device, &mai, NULL, &memory);
+    if (res != VK_SUCCESS) {
+        LOG_ERROR("vkAllocateMemory failed: %d (type %u, %llu bytes)", res, memory_type, (unsigned long long)size);
+        return false;
+    }
+
+    // Host-visible blocks are mapped once and stay mapped until freed
+    *out_mapped = NULL;
+    if (state->memory_props.memoryTypes[memory_type].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+        res = vkMapMemory(state->device, memory, 0, VK_WHOLE_SIZE, 0, out_mapped);
+        if (res != VK_SUCCESS) {
+            LOG_ERROR("vkMapMemory failed: %d", res);
+            vkFreeMemory(state->device, memory, NULL);
+            return false;
+        }
+    }
+    *out_memory = memory_to_u64(memory);
+    return true;
+}
+
+static void heap_free(void* user, uint32_t memory_type, uint64_t memory) {
+    (void)memory_type;
+    VulkanRendererState* state = (VulkanRendererState*)user;
+    // Freeing implicitly unmaps
+    vkFreeMemory(state->device, memory_from_u64(memory), NULL);
+}
+
+// --- Helpers ---
+
+static bool is_non_coherent(const VulkanRendererState* state, uint32_t memory_type) {
+    VkMemoryPropertyFlags flags = state->memory_props.memoryTypes[memory_type].propertyFlags;
+    return (flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) && !(flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+}
+
+// Non-coherent ranges are flushed in nonCoherentAtomSize units, so allocations there
+// start and end on atom boundaries and never share an atom with a neighbour.
+static void fit_requirements(const VulkanRendererState* state, uint32_t memory_type, VkMemoryRequirements* mr) {
+    if (!is_non_coherent(state, memory_type)) return;
+    VkDeviceSize atom = state->non_coherent_atom_size;
+    if (mr->alignment < atom) mr->alignment = atom;
+    mr->size = (mr->size + atom - 1) & ~(atom - 1);
+}
+
+// --- API ---
+
+bool vk_memory_init(VulkanRendererState* state) {
+    vkGetPhysicalDeviceMemoryProperties(state->physical_device, &state->memory_props);
+
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(state->physical_device, &props);
+    state->non_coherent_atom_size = props.limits.nonCoherentAtomSize ? props.limits.nonCoherentAtomSize : 1;
+
+    GpuAllocatorConfig config = {
+        .heap = { .user = state, .allocate = heap_allocate, .free = heap_free },
+        .block_size = GPU_ALLOCATOR_DEFAULT_BLOCK_SIZE,
+    };
+    state->gpu_allocator = gpu_allocator_create(&config);
+    if (!state->gpu_allocator) {
+        LOG_ERROR("Failed to create GPU memory allocator");
+        return false;
+    }
+    LOG_DEBUG("GPU memory allocator: %u memory types, bufferImageGranularity %llu",
+              state->memory_props.memoryTypeCount, (unsigned long long)props.limits.bufferImageGranularity);
+    return true;
+}
+
+void vk_memory_shutdown(VulkanRendererState* state) {
+    if (!state->gpu_allocator) return;
+    GpuAllocatorStats stats = gpu_allocator_get_stats(state->gpu_allocator);
+    if (stats.allocation_count > 0) {
+        LOG_WARN("GPU memory allocator shut down with %u live allocations", stats.allocation_count);
+    }
+    gpu_allocator_destroy(state->gpu_allocator);
+    state->gpu_allocator = NULL;
+}
+
+bool vk_memory_bind_buffer(VulkanRendererState* state, VkBuffer buffer, VkMemoryPropertyFlags props, GpuAllocation* out) {
+    VkMemoryRequirements mr;
+    vkGetBufferMemoryRequirements(state->device, buffer, &mr);
+    uint32_t type = find_mem_type(state->physical_device, mr.memoryTypeBits, props);
+    fit_requirements(state, type, &mr);
+
+    if (!gpu_allocator_alloc(state->gpu_allocator, type, mr.size, mr.alignment, GPU_RESOURCE_LINEAR, out)) {
+        return false;
+    }
+    VkResult res = vkBindBufferMemory(state->device, buffer, vk_memory_handle(out), out->offset);
+    if (res != VK_SUCCESS) {
+        LOG_ERROR("vkBindBufferMemory failed: %d", res);
+        vk_memory_free(state, out);
+        return false;
+    }
+    return true;
+}
+
+bool vk_memory_bind_image(VulkanRendererState* state, VkImage image, VkMemoryPropertyFlags props, GpuAllocation* out) {
+    VkMemoryRequirements mr;
+    vkGetImageMemoryRequirements(state->device, image, &mr);
+    uint32_t type = find_mem_type(state->physical_device, mr.memoryTypeBits, props);
+    fit_requirements(state, type, &mr);
+
+    // All images in this backend use optimal tiling
+    if (!gpu_allocator_alloc(state->gpu_allocator, type, mr.size, mr.alignment, GPU_RESOURCE_OPTIMAL, out)) {
+        return false;
+    }
+    VkResult res = vkBindImageMemory(state->device, image, vk_memory_handle(out), out->offset);
+    if (res != VK_SUCCESS) {
+        LOG_ERROR("vkBindImageMemory failed: %d", res);
+        vk_memory_free(state, out);
+        return false;
+    }
+    return true;
+}
+
+void vk_memory_free(VulkanRendererState* state, GpuAllocation* allocation) {
+    if (!allocation || !allocation->memory) return;
+    gpu_allocator_free(state->gpu_allocator, allocation);
+    memset(allocation, 0, sizeof(*allocation));
+}
+
+VkDeviceMemory vk_memory_handle(const GpuAllocation* allocation) {
+    return memory_from_u64(allocation->memory);
+}
+
+static VkMappedMemoryRange atom_range(const VulkanRendererState* state, const GpuAllocation* allocation, VkDeviceSize offset, VkDeviceSize size) {
+    // The allocation itself is atom aligned (fit_requirements), so rounding stays inside it
+    VkDeviceSize atom = state->non_coherent_atom_size;
+    VkDeviceSize begin = offset & ~(atom - 1);
+    VkDeviceSize end = (offset + size + atom - 1) & ~(atom - 1);
+    if (end > allocation->size) end = allocation->size;
+    VkMappedMemoryRange range = {
+        .sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+        .memory = vk_memory_handle(allocation),
+        .offset = allocation->offset + begin,
+        .size = end - begin
+    };
+    return range;
+}
+
+void vk_memory_flush(VulkanRendererState* state, const GpuAllocation* allocation, VkDeviceSize offset, VkDeviceSize size) {
+    if (!is_non_coherent(state, allocation->memory_type)) return;
+    VkMappedMemoryRange range = atom_range(state, allocation, offset, size);
+    vkFlushMappedMemoryRanges(state->device, 1, &range);
+}
+
+void vk_memory_invalidate(VulkanRendererState* state, const GpuAllocation* allocation, VkDeviceSize offset, VkDeviceSize size) {
+    if (!is_non_coherent(state, allocation->memory_type)) return;
+    VkMappedMemoryRange range = atom_range(state, allocation, offset, size);
+    vkInvalidateMappedMemoryRanges(state->device, 1, &range);
+}
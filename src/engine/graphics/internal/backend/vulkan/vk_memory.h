@@ -0,0 +1,32 @@
+#ifndef VK_MEMORY_H
+#define VK_MEMORY_H
+
+#include "vk_types.h"
+
+// --- Device Memory ---
+// Thin Vulkan front-end over GpuAllocator. Blocks come from vkAllocateMemory and
+// host-visible blocks stay mapped for their whole lifetime, so every allocation in
+// them carries a valid CPU pointer.
+
+// Creates the sub-allocator. Call once the logical device exists.
+bool vk_memory_init(VulkanRendererState* state);
+
+// Returns every block to the driver. Call after all resources are destroyed.
+void vk_memory_shutdown(VulkanRendererState* state);
+
+// Allocates memory for the resource and binds it.
+bool vk_memory_bind_buffer(VulkanRendererState* state, VkBuffer buffer, VkMemoryPropertyFlags props, GpuAllocation* out);
+bool vk_memory_bind_image(VulkanRendererState* state, VkImage image, VkMemoryPropertyFlags props, GpuAllocation* out);
+
+// Releases a placed allocation and zeroes it. Safe on zeroed allocations.
+void vk_memory_free(VulkanRendererState* state, GpuAllocation* allocation);
+
+VkDeviceMemory vk_memory_handle(const GpuAllocation* allocation);
+
+// Makes CPU writes visible to the device (no-op for coherent memory). Range is relative to the allocation.
+void vk_memory_flush(VulkanRendererState* state, const GpuAllocation* allocation, VkDeviceSize offset, VkDeviceSize size);
+
+// Makes device writes visible to the CPU (no-op for coherent memory).
+void vk_memory_invalidate(VulkanRendererState* state, const GpuAllocation* allocation, VkDeviceSize offset, VkDeviceSize size);
+
+#endif // VK_MEMORY_H
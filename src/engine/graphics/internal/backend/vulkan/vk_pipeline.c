@@ -25,7 +25,7 @@ static VkShaderModule create_shader_module(VulkanRendererState* state, const uin
     return mod;
 }
 
-static VkDescriptorSetLayout vk_create_layout_from_def(VulkanRendererState* state, const DescriptorLayoutDef* def) {
+static VkDescriptorSetLayout vk_create_layout_from_def(VulkanRendererState* state, const DescriptorLayoutDef* def, VkDescriptorSetLayoutCreateFlags flags) {
     if (!def || def->binding_count == 0) {
         // Empty layout
         VkDescriptorSetLayoutCreateInfo lci = { .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
@@ -54,6 +54,7 @@ static VkDescriptorSetLayout vk_create_layout_from_def(VulkanRendererState* stat
 
     VkDescriptorSetLayoutCreateInfo lci = { 
         .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, 
+        .flags = flags,
         .bindingCount = def->binding_count, 
         .pBindings = bindings 
     };
@@ -100,7 +101,7 @@ void vk_create_descriptor_layout(VulkanRendererState* state) {
     if (state->res != VK_SUCCESS) fatal_vk("vkCreateDescriptorSetLayout (Compute)", state->res);
 }
 
-VkResult vk_create_compute_pipeline_shader(VulkanRendererState* state, const uint32_t* code, size_t size, const DescriptorLayoutDef* layouts, uint32_t layout_count, VkPipeline* out_pipeline, VkPipelineLayout* out_layout, VkDescriptorSetLayout* out_set_layouts) {
+VkResult vk_create_compute_pipeline_shader(VulkanRendererState* state, const uint32_t* code, size_t size, const DescriptorLayoutDef* layouts, uint32_t layout_count, uint32_t push_descriptor_set, VkPipeline* out_pipeline, VkPipelineLayout* out_layout, VkDescriptorSetLayout* out_set_layouts) {
     // 1. Create Shader Module
     VkShaderModuleCreateInfo ci = { 
         .sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
@@ -116,7 +117,8 @@ VkResult vk_create_compute_pipeline_shader(VulkanRendererState* state, const uin
     uint32_t vk_layout_count = 0;
     
     for (uint32_t i = 0; i < layout_count && i < 8; ++i) {
-        vk_layouts[i] = vk_create_layout_from_def(state, &layouts[i]);
+        VkDescriptorSetLayoutCreateFlags flags = (i == push_descriptor_set) ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0;
+        vk_layouts[i] = vk_create_layout_from_def(state, &layouts[i], flags);
         if (vk_layouts[i] == VK_NULL_HANDLE) {
             vkDestroyShaderModule(state->device, mod, NULL);
             // Cleanup already created
@@ -253,7 +255,7 @@ VkResult vk_create_graphics_pipeline_shader(VulkanRendererState* state, const ui
     uint32_t vk_layout_count = 0;
     
     for (uint32_t i = 0; i < layout_count && i < 8; ++i) {
-        vk_layouts[i] = vk_create_layout_from_def(state, &layouts[i]);
+        vk_layouts[i] = vk_create_layout_from_def(state, &layouts[i], 0);
         if (vk_layouts[i] == VK_NULL_HANDLE) {
             vkDestroyShaderModule(state->device, vs, NULL);
             vkDestroyShaderModule(state->device, fs, NULL);
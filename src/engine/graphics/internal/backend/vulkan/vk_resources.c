@@ -2,6 +2,7 @@
 #include "vk_swapchain.h"
 #include "vk_utils.h"
 #include "vk_buffer.h"
+#include "vk_memory.h"
 #include "foundation/logger/logger.h"
 #include "engine/text/font.h" // Include Font Module
 #include <stdlib.h>
@@ -62,16 +63,13 @@ bool vk_create_vertex_buffer(VulkanRendererState* state, FrameResources *frame,
         vkDestroyBuffer(state->device, frame->vertex_buffer, NULL);
         frame->vertex_buffer = VK_NULL_HANDLE;
     }
-    if (frame->vertex_memory) {
-        vkFreeMemory(state->device, frame->vertex_memory, NULL);
-        frame->vertex_memory = VK_NULL_HANDLE;
-        frame->vertex_capacity = 0;
-    }
+    vk_memory_free(state, &frame->vertex_allocation);
+    frame->vertex_capacity = 0;
 
     VkBufferWrapper wrapper = {0};
     if (vk_buffer_create(state, bytes, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &wrapper)) {
         frame->vertex_buffer = wrapper.buffer;
-        frame->vertex_memory = wrapper.memory;
+        frame->vertex_allocation = wrapper.allocation;
         frame->vertex_capacity = bytes;
         return true;
     } else {
@@ -93,11 +91,9 @@ void vk_create_font_texture(VulkanRendererState* state) {
     VkImageCreateInfo ici = { .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO, .imageType = VK_IMAGE_TYPE_2D, .format = VK_FORMAT_R8_UNORM, .extent = { (uint32_t)width, (uint32_t)height, 1 }, .mipLevels = 1, .arrayLayers = 1, .samples = VK_SAMPLE_COUNT_1_BIT, .tiling = VK_IMAGE_TILING_OPTIMAL, .usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, .sharingMode = VK_SHARING_MODE_EXCLUSIVE, .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED }; 
     state->res = vkCreateImage(state->device, &ici, NULL, &state->font_image);
     if (state->res != VK_SUCCESS) fatal_vk("vkCreateImage", state->res);
-    VkMemoryRequirements mr; vkGetImageMemoryRequirements(state->device, state->font_image, &mr);
-    VkMemoryAllocateInfo mai = { .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, .allocationSize = mr.size, .memoryTypeIndex = find_mem_type(state->physical_device, mr.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) };
-    state->res = vkAllocateMemory(state->device, &mai, NULL, &state->font_image_mem);
-    if (state->res != VK_SUCCESS) fatal_vk("vkAllocateMemory", state->res);
-    vkBindImageMemory(state->device, state->font_image, state->font_image_mem, 0);
+    if (!vk_memory_bind_image(state, state->font_image, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &state->font_image_allocation)) {
+        LOG_FATAL("Failed to allocate font image memory");
+    }
 
     VkBufferWrapper staging = {0};
     if (!vk_buffer_create(state, width * height, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, &staging)) {
@@ -108,7 +104,6 @@ void vk_create_font_texture(VulkanRendererState* state) {
     void* mapped = vk_buffer_map(state, &staging);
     if (mapped) {
         memcpy(mapped, pixels, width * height);
-        vk_buffer_unmap(state, &staging);
     }
 
     vk_transition_image_layout(state, state->font_image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
@@ -177,7 +172,7 @@ void vk_ensure_compute_target(VulkanRendererState* state, int width, int height)
     // Cleanup old
     if (state->compute_target_view) { vkDestroyImageView(state->device, state->compute_target_view, NULL); state->compute_target_view = VK_NULL_HANDLE; }
     if (state->compute_target_image) { vkDestroyImage(state->device, state->compute_target_image, NULL); state->compute_target_image = VK_NULL_HANDLE; }
-    if (state->compute_target_memory) { vkFreeMemory(state->device, state->compute_target_memory, NULL); state->compute_target_memory = VK_NULL_HANDLE; }
+    vk_memory_free(state, &state->compute_target_allocation);
 
     if (width <= 0 || height <= 0) return;
 
@@ -201,11 +196,9 @@ void vk_ensure_compute_target(VulkanRendererState* state, int width, int height)
     state->res = vkCreateImage(state->device, &ici, NULL, &state->compute_target_image);
     if (state->res != VK_SUCCESS) fatal_vk("vkCreateImage (compute)", state->res);
 
-    VkMemoryRequirements mr; vkGetImageMemoryRequirements(state->device, state->compute_target_image, &mr);
-    VkMemoryAllocateInfo mai = { .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, .allocationSize = mr.size, .memoryTypeIndex = find_mem_type(state->physical_device, mr.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) };
-    state->res = vkAllocateMemory(state->device, &mai, NULL, &state->compute_target_memory);
-    if (state->res != VK_SUCCESS) fatal_vk("vkAllocateMemory (compute)", state->res);
-    vkBindImageMemory(state->device, state->compute_target_image, state->compute_target_memory, 0);
+    if (!vk_memory_bind_image(state, state->compute_target_image, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &state->compute_target_allocation)) {
+        LOG_FATAL("Failed to allocate compute target memory");
+    }
 
     // Create View
     VkImageViewCreateInfo ivci = { 
@@ -266,7 +259,7 @@ void vk_destroy_device_resources(VulkanRendererState* state) {
     if (state->font_sampler) { vkDestroySampler(state->device, state->font_sampler, NULL); state->font_sampler = VK_NULL_HANDLE; }
     if (state->font_image_view) { vkDestroyImageView(state->device, state->font_image_view, NULL); state->font_image_view = VK_NULL_HANDLE; }
     if (state->font_image) { vkDestroyImage(state->device, state->font_image, NULL); state->font_image = VK_NULL_HANDLE; }
-    if (state->font_image_mem) { vkFreeMemory(state->device, state->font_image_mem, NULL); state->font_image_mem = VK_NULL_HANDLE; }
+    vk_memory_free(state, &state->font_image_allocation);
     
     // Unified Resources (Quad)
     if (state->unit_quad_buffer) { vk_buffer_destroy(state, state->unit_quad_buffer); free(state->unit_quad_buffer); state->unit_quad_buffer = NULL; }
@@ -275,11 +268,11 @@ void vk_destroy_device_resources(VulkanRendererState* state) {
     // Cleanup Compute
     if (state->compute_target_view) { vkDestroyImageView(state->device, state->compute_target_view, NULL); state->compute_target_view = VK_NULL_HANDLE; }
     if (state->compute_target_image) { vkDestroyImage(state->device, state->compute_target_image, NULL); state->compute_target_image = VK_NULL_HANDLE; }
-    if (state->compute_target_memory) { vkFreeMemory(state->device, state->compute_target_memory, NULL); state->compute_target_memory = VK_NULL_HANDLE; }
+    vk_memory_free(state, &state->compute_target_allocation);
     
     for (size_t i = 0; i < 2; ++i) {
         if (state->frame_resources[i].vertex_buffer) { vkDestroyBuffer(state->device, state->frame_resources[i].vertex_buffer, NULL); state->frame_resources[i].vertex_buffer = VK_NULL_HANDLE; }
-        if (state->frame_resources[i].vertex_memory) { vkFreeMemory(state->device, state->frame_resources[i].vertex_memory, NULL); state->frame_resources[i].vertex_memory = VK_NULL_HANDLE; }
+        vk_memory_free(state, &state->frame_resources[i].vertex_allocation);
         state->frame_resources[i].vertex_capacity = 0;
         state->frame_resources[i].vertex_count = 0;
         state->frame_resources[i].stage = FRAME_AVAILABLE;
@@ -288,6 +281,16 @@ void vk_destroy_device_resources(VulkanRendererState* state) {
     if (state->sem_img_avail) { vkDestroySemaphore(state->device, state->sem_img_avail, NULL); state->sem_img_avail = VK_NULL_HANDLE; }
     if (state->sem_render_done) { vkDestroySemaphore(state->device, state->sem_render_done, NULL); state->sem_render_done = VK_NULL_HANDLE; }
 
+    // Cleanup Dynamic Textures
+    for (int i = 0; i < MAX_DYNAMIC_TEXTURES; ++i) {
+        if (!state->textures[i].active) continue;
+        if (state->textures[i].view) vkDestroyImageView(state->device, state->textures[i].view, NULL);
+        if (state->textures[i].image) vkDestroyImage(state->device, state->textures[i].image, NULL);
+        if (state->textures[i].sampler) vkDestroySampler(state->device, state->textures[i].sampler, NULL);
+        vk_memory_free(state, &state->textures[i].allocation);
+        memset(&state->textures[i], 0, sizeof(state->textures[i]));
+    }
+
     // Cleanup Dynamic Pipelines
     for (int i = 0; i < MAX_COMPUTE_PIPELINES; ++i) {
         if (state->compute_pipelines[i].active) {
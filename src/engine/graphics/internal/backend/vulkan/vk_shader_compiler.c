@@ -0,0 +1,175 @@
+#include "vk_shader_compiler.h"
+#include "engine/graphics/shader_cache.h"
+#include "foundation/platform/fs.h"
+#include "foundation/logger/logger.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAS_SHADERC
+#include <shaderc/shaderc.h>
+#endif
+
+struct VkShaderCompiler {
+#ifdef HAS_SHADERC
+    shaderc_compiler_t shaderc; // NULL = glslc fallback
+#else
+    int unused;
+#endif
+};
+
+static const char* const KNOWN_STAGES[] = { "compute", "vertex", "fragment" };
+
+static bool is_known_stage(const char* stage) {
+    for (size_t i = 0; i < sizeof(KNOWN_STAGES) / sizeof(KNOWN_STAGES[0]); ++i) {
+        if (strcmp(stage, KNOWN_STAGES[i]) == 0) return true;
+    }
+    return false;
+}
+
+static void log_failure(const ShaderDiagnostics* diagnostics, const char* stage) {
+    LOG_ERROR("Vulkan: %s shader compilation failed (%u errors, %u warnings)",
+              stage, diagnostics->error_count, diagnostics->warning_count);
+    for (uint32_t i = 0; i < diagnostics->count; ++i) {
+        const ShaderDiagnostic* d = &diagnostics->items[i];
+        if (d->is_error) LOG_ERROR("  line %u: %s", d->line, d->message);
+    }
+}
+
+// --- shaderc (in memory) ---
+
+#ifdef HAS_SHADERC
+static bool compile_shaderc(VkShaderCompiler* compiler, const char* source, size_t size, const char* stage,
+                            void** out_spv, size_t* out_spv_size, ShaderDiagnostics* diagnostics) {
+    shaderc_shader_kind kind = shaderc_glsl_compute_shader;
+    if (strcmp(stage, "vertex") == 0) kind = shaderc_glsl_vertex_shader;
+    else if (strcmp(stage, "fragment") == 0) kind = shaderc_glsl_fragment_shader;
+
+    // The compiler handle is only read here, so concurrent compiles share it
+    shaderc_compilation_result_t result = shaderc_compile_into_spv(compiler->shaderc, source, size, kind, stage, "main", NULL);
+    if (!result) return false;
+
+    const char* messages = shaderc_result_get_error_message(result);
+    if (messages) shader_diagnostics_parse(messages, diagnostics);
+
+    bool ok = shaderc_result_get_compilation_status(result) == shaderc_compilation_status_success;
+    if (ok) {
+        size_t length = shaderc_result_get_length(result);
+        void* code = malloc(length);
+        if (code) {
+            memcpy(code, shaderc_result_get_bytes(result), length);
+            *out_spv = code;
+            *out_spv_size = length;
+        } else {
+            ok = false;
+        }
+    }
+    shaderc_result_release(result);
+    return ok;
+}
+#endif
+
+// --- glslc (fallback) ---
+
+static bool compile_glslc(const char* source, size_t size, const char* stage,
+                          void** out_spv, size_t* out_spv_size, ShaderDiagnostics* diagnostics) {
+    // Unique names per compile, so concurrent compiles never share files
+    static atomic_uint counter;
+    unsigned id = atomic_fetch_add(&counter, 1);
+
+    platform_mkdir("logs");
+    char tmp_src[64], tmp_spv[64], tmp_log[64];
+    snprintf(tmp_src, sizeof(tmp_src), "logs/tmp_compile_%u.glsl", id);
+    snprintf(tmp_spv, sizeof(tmp_spv), "logs/tmp_compile_%u.spv", id);
+    snprintf(tmp_log, sizeof(tmp_log), "logs/tmp_compile_%u.log", id);
+
+    if (!fs_write_bin(tmp_src, source, size)) {
+        LOG_ERROR("Vulkan: Failed to write %s", tmp_src);
+        return false;
+    }
+
+    char cmd[320];
+    snprintf(cmd, sizeof(cmd), "glslc -fshader-stage=%s %s -o %s 2> %s", stage, tmp_src, tmp_spv, tmp_log);
+    int res = system(cmd);
+
+    char* messages = fs_read_text(NULL, tmp_log);
+    if (messages) {
+        shader_diagnostics_parse(messages, diagnostics);
+        free(messages);
+    }
+
+    bool ok = false;
+    if (res == 0) {
+        size_t sz = 0;
+        void* code = fs_read_bin(NULL, tmp_spv, &sz);
+        if (code) {
+            *out_spv = code;
+            *out_spv_size = sz;
+            ok = true;
+        }
+    } else if (diagnostics->error_count == 0) {
+        LOG_ERROR("Vulkan: '%s' failed with %d (is glslc on PATH?)", cmd, res);
+    }
+
+    platform_remove_file(tmp_src);
+    platform_remove_file(tmp_spv);
+    platform_remove_file(tmp_log);
+    return ok;
+}
+
+// --- API ---
+
+VkShaderCompiler* vk_shader_compiler_create(void) {
+    VkShaderCompiler* compiler = calloc(1, sizeof(VkShaderCompiler));
+    if (!compiler) return NULL;
+#ifdef HAS_SHADERC
+    compiler->shaderc = shaderc_compiler_initialize();
+    if (compiler->shaderc) {
+        LOG_INFO("Vulkan: Runtime shaders compile in-process (shaderc)");
+    } else {
+        LOG_WARN("Vulkan: shaderc failed to initialize, falling back to glslc");
+    }
+#else
+    LOG_INFO("Vulkan: Runtime shaders compile through glslc");
+#endif
+    return compiler;
+}
+
+void vk_shader_compiler_destroy(VkShaderCompiler* compiler) {
+    if (!compiler) return;
+#ifdef HAS_SHADERC
+    if (compiler->shaderc) shaderc_compiler_release(compiler->shaderc);
+#endif
+    free(compiler);
+}
+
+bool vk_shader_compiler_compile(VkShaderCompiler* compiler, const char* source, size_t size, const char* stage,
+                                void** out_spv, size_t* out_spv_size, ShaderDiagnostics* diagnostics) {
+    if (!source || !stage || !out_spv || !out_spv_size) return false;
+    // 'stage' ends up on a command line
+    if (!is_known_stage(stage)) {
+        LOG_ERROR("Vulkan: Unknown shader stage '%s'", stage);
+        return false;
+    }
+
+    ShaderDiagnostics local;
+    if (!diagnostics) {
+        memset(&local, 0, sizeof(local));
+        diagnostics = &local;
+    }
+
+    bool ok;
+#ifdef HAS_SHADERC
+    if (compiler && compiler->shaderc) {
+        ok = compile_shaderc(compiler, source, size, stage, out_spv, out_spv_size, diagnostics);
+    } else
+#endif
+    {
+        (void)compiler;
+        ok = compile_glslc(source, size, stage, out_spv, out_spv_size, diagnostics);
+    }
+
+    if (!ok) log_failure(diagnostics, stage);
+    return ok;
+}
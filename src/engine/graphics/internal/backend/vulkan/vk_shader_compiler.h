@@ -0,0 +1,24 @@
+#ifndef VK_SHADER_COMPILER_H
+#define VK_SHADER_COMPILER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "engine/graphics/graphics_types.h"
+
+// --- Runtime Shader Compiler ---
+// GLSL -> SPIR-V behind the backend's compile_shader slot. Builds with HAS_SHADERC
+// compile in memory through libshaderc; otherwise (or if shaderc fails to initialize)
+// glslc runs on per-compile temp files. Both paths are safe to call from several
+// threads at once, which is what lets the shader cache compile in parallel.
+
+typedef struct VkShaderCompiler VkShaderCompiler;
+
+VkShaderCompiler* vk_shader_compiler_create(void);
+void vk_shader_compiler_destroy(VkShaderCompiler* compiler);
+
+// stage: "compute", "vertex", "fragment". Allocates *out_spv (caller frees).
+// Compiler messages go to 'diagnostics' (may be NULL) and, for failures, the log.
+bool vk_shader_compiler_compile(VkShaderCompiler* compiler, const char* source, size_t size, const char* stage,
+                                void** out_spv, size_t* out_spv_size, ShaderDiagnostics* diagnostics);
+
+#endif // VK_SHADER_COMPILER_H
@@ -0,0 +1,242 @@
+#include "vk_staging.h"
+#include "vk_buffer.h"
+#include "vk_utils.h"
+#include "engine/graphics/render_system.h"
+#include "foundation/logger/logger.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define STAGING_ALIGNMENT 16
+
+static VkDeviceSize align_up(VkDeviceSize value, VkDeviceSize alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Waits until the GPU is done with the current slot's chunks and rewinds them
+static void staging_open(VulkanRendererState* state) {
+    uint32_t slot = state->current_frame_cursor;
+    FrameResources* frame = &state->frame_resources[slot];
+
+    if (state->fences) {
+        vkWaitForFences(state->device, 1, &state->fences[slot], VK_TRUE, UINT64_MAX);
+    }
+    if (frame->staging_extra_fence) {
+        vkWaitForFences(state->device, 1, &frame->staging_extra_fence, VK_TRUE, UINT64_MAX);
+        frame->staging_extra_fence = VK_NULL_HANDLE;
+    }
+    for (uint32_t i = 0; i < frame->staging_chunk_count; ++i) {
+        frame->staging_chunks[i].used = 0;
+    }
+    state->staging_slot = slot;
+    state->staging_open = true;
+}
+
+static StagingChunk* staging_reserve(VulkanRendererState* state, FrameResources* frame, VkDeviceSize size, VkDeviceSize* out_offset) {
+    for (uint32_t i = 0; i < frame->staging_chunk_count; ++i) {
+        StagingChunk* chunk = &frame->staging_chunks[i];
+        VkDeviceSize offset = align_up(chunk->used, STAGING_ALIGNMENT);
+        if (offset + size <= chunk->buffer->size) {
+            *out_offset = offset;
+            return chunk;
+        }
+    }
+
+    // Chunks are kept across frames, so this only happens while the ring warms up
+    StagingChunk* chunks = realloc(frame->staging_chunks, (frame->staging_chunk_count + 1) * sizeof(StagingChunk));
+    if (!chunks) return NULL;
+    frame->staging_chunks = chunks;
+
+    struct VkBufferWrapper* buffer = calloc(1, sizeof(struct VkBufferWrapper));
+    if (!buffer) return NULL;
+    VkDeviceSize chunk_size = align_up(size, VK_STAGING_CHUNK_SIZE);
+    if (!vk_buffer_create(state, chunk_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, buffer)) {
+        free(buffer);
+        return NULL;
+    }
+    LOG_DEBUG("Staging: slot %u grew to %u chunks (+%llu bytes)", state->staging_slot,
+              frame->staging_chunk_count + 1, (unsigned long long)chunk_size);
+
+    StagingChunk* chunk = &frame->staging_chunks[frame->staging_chunk_count++];
+    chunk->buffer = buffer;
+    chunk->used = 0;
+    *out_offset = 0;
+    return chunk;
+}
+
+static bool staging_push_copy(VulkanRendererState* state, VkBuffer src, VkBuffer dst, VkBufferCopy region) {
+    // Consecutive uploads to the same range of one chunk and buffer extend the last region
+    if (state->staging_copy_count > 0) {
+        size_t last = state->staging_copy_count - 1;
+        VkBufferCopy* prev = &state->staging_regions[last];
+        if (state->staging_copies[last].src == src && state->staging_copies[last].dst == dst &&
+            prev->srcOffset + prev->size == region.srcOffset && prev->dstOffset + prev->size == region.dstOffset) {
+            prev->size += region.size;
+            return true;
+        }
+    }
+
+    if (state->staging_copy_count == state->staging_copy_capacity) {
+        size_t new_cap = state->staging_copy_capacity ? state->staging_copy_capacity * 2 : 64;
+        StagingCopy* copies = realloc(state->staging_copies, new_cap * sizeof(StagingCopy));
+        if (!copies) return false;
+        state->staging_copies = copies;
+        VkBufferCopy* regions = realloc(state->staging_regions, new_cap * sizeof(VkBufferCopy));
+        if (!regions) return false;
+        state->staging_regions = regions;
+        state->staging_copy_capacity = new_cap;
+    }
+    state->staging_copies[state->staging_copy_count] = (StagingCopy){ .src = src, .dst = dst };
+    state->staging_regions[state->staging_copy_count] = region;
+    state->staging_copy_count++;
+    return true;
+}
+
+bool vk_staging_upload(VulkanRendererState* state, struct VkBufferWrapper* dst, const void* data, VkDeviceSize size, VkDeviceSize offset) {
+    if (size == 0) return true;
+    if (!state->staging_open) staging_open(state);
+
+    FrameResources* frame = &state->frame_resources[state->staging_slot];
+    VkDeviceSize src_offset = 0;
+    StagingChunk* chunk = staging_reserve(state, frame, size, &src_offset);
+    if (!chunk) {
+        LOG_ERROR("Staging: Failed to reserve %llu bytes", (unsigned long long)size);
+        return false;
+    }
+
+    memcpy((uint8_t*)chunk->buffer->mapped_data + src_offset, data, size);
+    chunk->used = src_offset + size;
+
+    VkBufferCopy region = { .srcOffset = src_offset, .dstOffset = offset, .size = size };
+    return staging_push_copy(state, chunk->buffer->buffer, dst->buffer, region);
+}
+
+static bool regions_overlap(const VkBufferCopy* a, const VkBufferCopy* b) {
+    return a->dstOffset < b->dstOffset + b->size && b->dstOffset < a->dstOffset + a->size;
+}
+
+static void record_run(VulkanRendererState* state, VkCommandBuffer cmd, size_t first, size_t end) {
+    if (end <= first) return;
+    vkCmdCopyBuffer(cmd, state->staging_copies[first].src, state->staging_copies[first].dst,
+                    (uint32_t)(end - first), &state->staging_regions[first]);
+}
+
+void vk_staging_record(VulkanRendererState* state, VkCommandBuffer cmd, VkFence fence) {
+    if (state->staging_copy_count == 0) return;
+
+    // Earlier submissions may still read or write the destinations (WAR / WAW)
+    VkMemoryBarrier before = {
+        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT
+    };
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &before, 0, NULL, 0, NULL);
+
+    // One vkCmdCopyBuffer per run of copies sharing source chunk and destination.
+    // Regions of one call must not overlap, and a rewrite of bytes copied earlier in
+    // this batch needs a transfer barrier first.
+    VkMemoryBarrier rewrite = {
+        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT
+    };
+    size_t run = 0;
+    size_t batch = 0;
+    for (size_t i = 0; i < state->staging_copy_count; ++i) {
+        bool overlaps = false;
+        for (size_t j = batch; j < i && !overlaps; ++j) {
+            overlaps = state->staging_copies[j].dst == state->staging_copies[i].dst &&
+                       regions_overlap(&state->staging_regions[j], &state->staging_regions[i]);
+        }
+        bool same_run = state->staging_copies[i].src == state->staging_copies[run].src &&
+                        state->staging_copies[i].dst == state->staging_copies[run].dst;
+        if (i > run && (overlaps || !same_run)) {
+            record_run(state, cmd, run, i);
+            run = i;
+        }
+        if (overlaps) {
+            vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &rewrite, 0, NULL, 0, NULL);
+            batch = i;
+        }
+    }
+    record_run(state, cmd, run, state->staging_copy_count);
+
+    VkMemoryBarrier after = {
+        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_UNIFORM_READ_BIT |
+                         VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_READ_BIT
+    };
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+                         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT |
+                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         0, 1, &after, 0, NULL, 0, NULL);
+
+    state->staging_copy_count = 0;
+
+    // Anything but the slot's own frame fence must also be waited on before reuse
+    if (state->staging_open && fence != VK_NULL_HANDLE &&
+        (!state->fences || fence != state->fences[state->staging_slot])) {
+        state->frame_resources[state->staging_slot].staging_extra_fence = fence;
+    }
+}
+
+void vk_staging_submit_pending(VulkanRendererState* state) {
+    if (state->staging_copy_count > 0) {
+        VkCommandBuffer cb = vk_begin_single_time_commands(state);
+        vk_staging_record(state, cb, VK_NULL_HANDLE);
+        vk_end_single_time_commands(state, cb); // Waits for the queue to drain
+    }
+    // Every slot is idle now; the next upload re-opens whatever slot is current
+    for (int i = 0; i < RENDER_FRAMES_IN_FLIGHT; ++i) {
+        state->frame_resources[i].staging_extra_fence = VK_NULL_HANDLE;
+    }
+    state->staging_open = false;
+}
+
+void vk_staging_cancel(VulkanRendererState* state, VkBuffer dst) {
+    size_t kept = 0;
+    for (size_t i = 0; i < state->staging_copy_count; ++i) {
+        if (state->staging_copies[i].dst == dst) continue;
+        state->staging_copies[kept] = state->staging_copies[i];
+        state->staging_regions[kept] = state->staging_regions[i];
+        kept++;
+    }
+    state->staging_copy_count = kept;
+}
+
+void vk_staging_begin_frame(VulkanRendererState* state) {
+    if (!state->staging_open) staging_open(state);
+}
+
+void vk_staging_end_frame(VulkanRendererState* state) {
+    // Copies queued after the frame was recorded read from this slot's chunks, which the
+    // next slot's fence does not cover. Does not happen in the normal frame flow.
+    if (state->staging_copy_count > 0) {
+        LOG_WARN("Staging: %zu uploads arrived after the frame was recorded", state->staging_copy_count);
+        vk_staging_submit_pending(state);
+    }
+    state->staging_open = false;
+}
+
+void vk_staging_destroy(VulkanRendererState* state) {
+    for (int i = 0; i < RENDER_FRAMES_IN_FLIGHT; ++i) {
+        FrameResources* frame = &state->frame_resources[i];
+        for (uint32_t c = 0; c < frame->staging_chunk_count; ++c) {
+            vk_buffer_destroy(state, frame->staging_chunks[c].buffer);
+            free(frame->staging_chunks[c].buffer);
+        }
+        free(frame->staging_chunks);
+        frame->staging_chunks = NULL;
+        frame->staging_chunk_count = 0;
+        frame->staging_extra_fence = VK_NULL_HANDLE;
+    }
+    free(state->staging_copies);
+    free(state->staging_regions);
+    state->staging_copies = NULL;
+    state->staging_regions = NULL;
+    state->staging_copy_count = 0;
+    state->staging_copy_capacity = 0;
+    state->staging_open = false;
+}
@@ -0,0 +1,40 @@
+#ifndef VK_STAGING_H
+#define VK_STAGING_H
+
+#include "vk_types.h"
+
+struct VkBufferWrapper;
+
+// --- Staging Ring ---
+// Uploads to device-local buffers are copied into persistently mapped staging chunks
+// owned by the current frame slot and queued as copy regions. The queue is recorded
+// into the next command buffer the backend submits (the frame, a compute dispatch or
+// a readback), so uploads cost a memcpy: no fences, no buffers, no submits.
+//
+// A slot's chunks are reused once its frame fence has signaled. The first upload of a
+// frame waits on that fence, which submit_commands would wait on anyway.
+
+#define VK_STAGING_CHUNK_SIZE ((VkDeviceSize)4 * 1024 * 1024)
+
+// Copies 'data' into staging memory and queues a copy to dst at 'offset'.
+bool vk_staging_upload(VulkanRendererState* state, struct VkBufferWrapper* dst, const void* data, VkDeviceSize size, VkDeviceSize offset);
+
+// Records all queued copies into 'cmd' with the barriers around them. Must be outside a render pass.
+// 'fence' signals when 'cmd' completes (VK_NULL_HANDLE if the caller waits for it).
+void vk_staging_record(VulkanRendererState* state, VkCommandBuffer cmd, VkFence fence);
+
+// Submits queued copies on a one-shot command buffer and waits (resize, shutdown).
+void vk_staging_submit_pending(VulkanRendererState* state);
+
+// Drops queued copies into a buffer that is being destroyed.
+void vk_staging_cancel(VulkanRendererState* state, VkBuffer dst);
+
+// Opens the current slot if no upload has yet. Call once its frame fence has been waited on.
+void vk_staging_begin_frame(VulkanRendererState* state);
+
+// Called when the frame cursor advances; the next upload opens the new slot.
+void vk_staging_end_frame(VulkanRendererState* state);
+
+void vk_staging_destroy(VulkanRendererState* state);
+
+#endif // VK_STAGING_H
@@ -1,5 +1,6 @@
 #include "vk_swapchain.h"
 #include "vk_utils.h"
+#include "vk_memory.h"
 #include "foundation/logger/logger.h"
 #include <stdlib.h>
 
@@ -205,10 +206,7 @@ void vk_destroy_depth_resources(VulkanRendererState* state) {
         vkDestroyImage(state->device, state->depth_image, NULL);
         state->depth_image = VK_NULL_HANDLE;
     }
-    if (state->depth_memory) {
-        vkFreeMemory(state->device, state->depth_memory, NULL);
-        state->depth_memory = VK_NULL_HANDLE;
-    }
+    vk_memory_free(state, &state->depth_allocation);
 }
 
 void vk_create_depth_resources(VulkanRendererState* state) {
@@ -236,20 +234,9 @@ void vk_create_depth_resources(VulkanRendererState* state) {
     state->res = vkCreateImage(state->device, &image_info, NULL, &state->depth_image);
     if (state->res != VK_SUCCESS) fatal_vk("vkCreateImage (depth)", state->res);
 
-    VkMemoryRequirements mem_req;
-    vkGetImageMemoryRequirements(state->device, state->depth_image, &mem_req);
-    VkMemoryAllocateInfo alloc_info = { .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, .allocationSize = mem_req.size };
-    VkPhysicalDeviceMemoryProperties mem_props; vkGetPhysicalDeviceMemoryProperties(state->physical_device, &mem_props);
-    uint32_t mem_type = UINT32_MAX;
-    for (uint32_t i = 0; i < mem_props.memoryTypeCount; i++) {
-        if ((mem_req.memoryTypeBits & (1u << i)) && (mem_props.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)) {
-            mem_type = i; break; }
+    if (!vk_memory_bind_image(state, state->depth_image, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &state->depth_allocation)) {
+        LOG_FATAL("No suitable memory for depth buffer");
     }
-    if (mem_type == UINT32_MAX) LOG_FATAL("No suitable memory type for depth buffer");
-    alloc_info.memoryTypeIndex = mem_type;
-    state->res = vkAllocateMemory(state->device, &alloc_info, NULL, &state->depth_memory);
-    if (state->res != VK_SUCCESS) fatal_vk("vkAllocateMemory (depth)", state->res);
-    vkBindImageMemory(state->device, state->depth_image, state->depth_memory, 0);
 
     VkImageViewCreateInfo view_info = {
         .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
@@ -337,7 +324,6 @@ void vk_create_cmds_and_sync(VulkanRendererState* state) {
             state->image_frame_owner[i] = -1;
         }
     }
-    state->current_frame_cursor = 0;
 }
 
 void vk_cleanup_swapchain(VulkanRendererState* state, bool keep_swapchain_handle) {
@@ -8,9 +8,12 @@
 #include "foundation/math/coordinate_systems.h"
 #include "foundation/platform/platform.h"
 #include "engine/graphics/internal/backend/vulkan/vulkan_renderer.h"
+#include "engine/graphics/internal/gpu_allocator.h"
 
 typedef struct Font Font;
 struct VkBufferWrapper; // Forward declaration
+struct DescriptorCacheEntry; // vk_descriptor_cache.c
+struct VkShaderCompiler; // vk_shader_compiler.c
 
 typedef struct { float viewport[2]; } ViewConstants;
 
@@ -25,10 +28,21 @@ typedef struct {
     size_t vertex_capacity;
 } FrameCpuArena;
 
+// Persistently mapped staging memory of one frame slot (vk_staging.h)
+typedef struct {
+    struct VkBufferWrapper* buffer;
+    VkDeviceSize used;
+} StagingChunk;
+
+typedef struct {
+    VkBuffer src;
+    VkBuffer dst;
+} StagingCopy;
+
 typedef struct {
     FrameCpuArena cpu;
     VkBuffer vertex_buffer;
-    VkDeviceMemory vertex_memory;
+    GpuAllocation vertex_allocation;
     VkDeviceSize vertex_capacity;
     size_t vertex_count;
     FrameStage stage;
@@ -37,6 +51,11 @@ typedef struct {
     // Per-Frame Instance Buffer (Dynamic) removed
     
     VkDescriptorPool frame_descriptor_pool; // For dynamic custom draws
+
+    // Staging Ring
+    StagingChunk* staging_chunks;
+    uint32_t staging_chunk_count;
+    VkFence staging_extra_fence; // Set when a compute submit consumed this slot's staging
 } FrameResources;
 
 typedef struct VulkanRendererState {
@@ -46,6 +65,12 @@ typedef struct VulkanRendererState {
     VkPhysicalDevice physical_device;
     VkDevice device;
     uint32_t graphics_family;
+
+    // Device Memory (vk_memory.h)
+    GpuAllocator* gpu_allocator;
+    VkPhysicalDeviceMemoryProperties memory_props;
+    VkDeviceSize non_coherent_atom_size;
+
     VkQueue queue;
     VkSurfaceKHR surface;
     VkSwapchainKHR swapchain;
@@ -79,13 +104,21 @@ typedef struct VulkanRendererState {
     VkFence* fences;
     FrameResources frame_resources[2];
     uint32_t current_frame_cursor;
+
+    // Queued staging copies (parallel arrays, flushed into the next submit)
+    StagingCopy* staging_copies;
+    VkBufferCopy* staging_regions;
+    size_t staging_copy_count;
+    size_t staging_copy_capacity;
+    uint32_t staging_slot;
+    bool staging_open;
     int* image_frame_owner;
     VkImage depth_image;
-    VkDeviceMemory depth_memory;
+    GpuAllocation depth_allocation;
     VkImageView depth_image_view;
     VkFormat depth_format;
     VkImage font_image;
-    VkDeviceMemory font_image_mem;
+    GpuAllocation font_image_allocation;
     VkImageView font_image_view;
     VkSampler font_sampler;
     VkDescriptorSetLayout descriptor_layout;
@@ -107,7 +140,7 @@ typedef struct VulkanRendererState {
 
     // Compute Target (Visualization)
     VkImage compute_target_image;
-    VkDeviceMemory compute_target_memory;
+    GpuAllocation compute_target_allocation;
     VkImageView compute_target_view;
     VkDescriptorSet compute_target_descriptor; // Set 2 (Sampling)
     VkDescriptorSet compute_write_descriptor;  // Set 0 (Compute Writing)
@@ -119,6 +152,11 @@ typedef struct VulkanRendererState {
     VkFence compute_fence;
     VkCommandBuffer compute_cmd;
 
+    // Compute Batching: dispatches between compute_begin/end share compute_cmd and one submit
+    uint32_t compute_batch_depth;
+    bool compute_recording;
+    VkPipeline compute_bound_pipeline; // Last pipeline bound in the open batch
+
     // --- Compute Pipeline Pool ---
 #define MAX_COMPUTE_PIPELINES 32
     struct {
@@ -127,6 +165,8 @@ typedef struct VulkanRendererState {
         VkPipelineLayout layout;
         VkDescriptorSetLayout set_layouts[4];
         uint32_t set_layout_count;
+        uint32_t ssbo_binding_mask; // Storage-buffer bindings declared in Set 1
+        bool push_descriptors;      // Set 1 was created as a push descriptor set
     } compute_pipelines[MAX_COMPUTE_PIPELINES];
 
 #define MAX_COMPUTE_BINDINGS 16
@@ -135,7 +175,18 @@ typedef struct VulkanRendererState {
     } compute_bindings[MAX_COMPUTE_BINDINGS];
     
     VkDescriptorSetLayout compute_ssbo_layout; // Layout for Set 1 (Buffers)
-    VkDescriptorSet compute_ssbo_descriptor;   // Set 1 Instance (For legacy Compute Dispatch)
+
+    // Set 1 descriptors for compute dispatch (vk_descriptor_cache.h)
+    VkDescriptorPool descriptor_cache_pool;
+    struct DescriptorCacheEntry* descriptor_cache;
+    uint32_t descriptor_cache_count; // Live entries
+    uint32_t descriptor_cache_sets;  // Sets allocated since the last pool reset
+
+    // VK_KHR_push_descriptor (NULL when the device lacks it)
+    PFN_vkCmdPushDescriptorSetKHR cmd_push_descriptor_set;
+
+    // Runtime GLSL compiler for compile_shader (vk_shader_compiler.h)
+    struct VkShaderCompiler* shader_compiler;
 
     // --- Graphics Pipeline Pool ---
 #define MAX_GRAPHICS_PIPELINES 32
@@ -160,7 +211,7 @@ typedef struct VulkanRendererState {
         uint32_t format; // 0=RGBA8, 1=RGBA16F, 2=D32
         
         VkImage image;
-        VkDeviceMemory memory;
+        GpuAllocation allocation;
         VkImageView view;
         VkSampler sampler;
         
@@ -7,8 +7,13 @@
 #include "engine/graphics/internal/backend/vulkan/vk_resources.h"
 #include "engine/graphics/internal/backend/vulkan/vk_utils.h"
 #include "engine/graphics/internal/backend/vulkan/vk_buffer.h"
+#include "engine/graphics/internal/backend/vulkan/vk_memory.h"
+#include "engine/graphics/internal/backend/vulkan/vk_staging.h"
+#include "engine/graphics/internal/backend/vulkan/vk_descriptor_cache.h"
+#include "engine/graphics/internal/backend/vulkan/vk_shader_compiler.h"
 #include "engine/graphics/internal/primitives.h"
 #include "engine/graphics/internal/stream_internal.h"
+#include "engine/graphics/render_system.h"
 #include "engine/text/font.h"
 
 #include "foundation/logger/logger.h"
@@ -17,6 +22,7 @@
 #include "foundation/math/coordinate_systems.h"
 #include "foundation/image/image.h"
 #include "foundation/thread/thread.h"
+#include "foundation/profiler/profiler.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -62,6 +68,26 @@ static void vulkan_renderer_request_screenshot(RendererBackend* backend, const c
 
 // --- COMPUTE SUBSYSTEM ---
 
+// Set 1 holds the storage buffers bound with compute_bind_buffer
+#define COMPUTE_SSBO_SET 1
+
+static uint32_t ssbo_binding_mask(const DescriptorLayoutDef* def) {
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < def->binding_count && i < 16; ++i) {
+        const DescriptorBindingDef* b = &def->bindings[i];
+        if (b->descriptor_type == 1 && b->descriptor_count == 1 && b->binding < MAX_COMPUTE_BINDINGS) {
+            mask |= 1u << b->binding;
+        }
+    }
+    return mask;
+}
+
+static uint32_t bit_count(uint32_t v) {
+    uint32_t n = 0;
+    for (; v; v &= v - 1) n++;
+    return n;
+}
+
 static uint32_t vulkan_compute_pipeline_create(RendererBackend* backend, const void* spirv_code, size_t size, const DescriptorLayoutDef* layouts, uint32_t layout_count) {
     VulkanRendererState* state = (VulkanRendererState*)backend->state;
     
@@ -79,12 +105,23 @@ static uint32_t vulkan_compute_pipeline_create(RendererBackend* backend, const v
         return 0;
     }
     
+    // Set 1 becomes a push descriptor set when it holds nothing but single storage buffers
+    // (maxPushDescriptors is at least 32, above MAX_COMPUTE_BINDINGS)
+    uint32_t mask = 0;
+    bool push = false;
+    if (layout_count > COMPUTE_SSBO_SET) {
+        const DescriptorLayoutDef* def = &layouts[COMPUTE_SSBO_SET];
+        mask = ssbo_binding_mask(def);
+        push = state->cmd_push_descriptor_set && mask != 0 && bit_count(mask) == def->binding_count;
+    }
+
     VkPipeline pipeline;
     VkPipelineLayout layout;
     VkDescriptorSetLayout set_layouts[4] = {0};
     
     // Convert void* to uint32_t* (assume 4-byte aligned and size is bytes)
-    VkResult res = vk_create_compute_pipeline_shader(state, (const uint32_t*)spirv_code, size, layouts, layout_count, &pipeline, &layout, set_layouts);
+    VkResult res = vk_create_compute_pipeline_shader(state, (const uint32_t*)spirv_code, size, layouts, layout_count,
+                                                     push ? COMPUTE_SSBO_SET : UINT32_MAX, &pipeline, &layout, set_layouts);
     
     if (res != VK_SUCCESS) {
         LOG_ERROR("Failed to create compute pipeline: %d", res);
@@ -94,6 +131,8 @@ static uint32_t vulkan_compute_pipeline_create(RendererBackend* backend, const v
     state->compute_pipelines[slot].active = true;
     state->compute_pipelines[slot].pipeline = pipeline;
     state->compute_pipelines[slot].layout = layout;
+    state->compute_pipelines[slot].ssbo_binding_mask = mask;
+    state->compute_pipelines[slot].push_descriptors = push;
     
     // Store layouts for cleanup
     state->compute_pipelines[slot].set_layout_count = 0;
@@ -105,100 +144,206 @@ static uint32_t vulkan_compute_pipeline_create(RendererBackend* backend, const v
     return (uint32_t)(slot + 1);
 }
 
+// --- Compute Batching ---
+// Dispatches record into compute_cmd. Outside compute_begin/end every dispatch is its own
+// batch; inside, all of them share one command buffer, one submit and one fence.
+
+// compute_cmd lives in the swapchain command pool and is reallocated with it
+static void compute_allocate_cmd(VulkanRendererState* state) {
+    VkCommandBufferAllocateInfo cbai = { 
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, 
+        .commandPool = state->cmdpool, 
+        .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY, 
+        .commandBufferCount = 1 
+    };
+    if (vkAllocateCommandBuffers(state->device, &cbai, &state->compute_cmd) != VK_SUCCESS) {
+        LOG_ERROR("Failed to allocate compute cmd");
+    }
+}
+
+static bool compute_open(VulkanRendererState* state) {
+    // The previous batch must retire before compute_cmd and the cached sets are reused
+    PROFILE_BEGIN("vk_wait_compute_fence");
+    vkWaitForFences(state->device, 1, &state->compute_fence, VK_TRUE, UINT64_MAX);
+    PROFILE_END();
+    vk_descriptor_cache_trim(state);
+
+    vkResetCommandBuffer(state->compute_cmd, 0);
+    VkCommandBufferBeginInfo begin_info = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+    };
+    if (vkBeginCommandBuffer(state->compute_cmd, &begin_info) != VK_SUCCESS) {
+        LOG_ERROR("Failed to begin compute cmd");
+        return false;
+    }
+    state->compute_recording = true;
+    state->compute_bound_pipeline = VK_NULL_HANDLE;
+    return true;
+}
+
+static void compute_close(VulkanRendererState* state) {
+    if (!state->compute_recording) return;
+    state->compute_recording = false;
+    vkEndCommandBuffer(state->compute_cmd);
+
+    // Reset only now, so waits issued while recording never block on an unsubmitted fence
+    vkResetFences(state->device, 1, &state->compute_fence);
+    VkSubmitInfo submit_info = {
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &state->compute_cmd
+    };
+    if (vkQueueSubmit(state->queue, 1, &submit_info, state->compute_fence) != VK_SUCCESS) {
+        LOG_ERROR("Failed to submit compute queue");
+        vkQueueSubmit(state->queue, 0, NULL, state->compute_fence); // Keep the fence signalable
+    }
+}
+
+// Submits the open batch and waits, so the CPU can touch (or destroy) what it references
+static void compute_flush(VulkanRendererState* state) {
+    if (!state->compute_recording) return;
+    compute_close(state);
+    vkWaitForFences(state->device, 1, &state->compute_fence, VK_TRUE, UINT64_MAX);
+    compute_open(state);
+}
+
+static void vulkan_compute_begin(RendererBackend* backend) {
+    VulkanRendererState* state = (VulkanRendererState*)backend->state;
+    // Opened lazily by the first dispatch, so an empty batch submits nothing
+    state->compute_batch_depth++;
+}
+
+static void vulkan_compute_end(RendererBackend* backend) {
+    VulkanRendererState* state = (VulkanRendererState*)backend->state;
+    if (state->compute_batch_depth == 0) return;
+    if (--state->compute_batch_depth == 0) {
+        compute_close(state);
+    }
+}
+
 static void vulkan_compute_pipeline_destroy(RendererBackend* backend, uint32_t pipeline_id) {
     VulkanRendererState* state = (VulkanRendererState*)backend->state;
     if (pipeline_id == 0 || pipeline_id > MAX_COMPUTE_PIPELINES) return;
     
     int idx = (int)pipeline_id - 1;
     if (state->compute_pipelines[idx].active) {
+        compute_flush(state);
+        vkWaitForFences(state->device, 1, &state->compute_fence, VK_TRUE, UINT64_MAX);
+        if (state->compute_bound_pipeline == state->compute_pipelines[idx].pipeline) {
+            state->compute_bound_pipeline = VK_NULL_HANDLE;
+        }
+
+        vk_descriptor_cache_forget_layout(state, state->compute_pipelines[idx].layout);
         vkDestroyPipeline(state->device, state->compute_pipelines[idx].pipeline, NULL);
         vkDestroyPipelineLayout(state->device, state->compute_pipelines[idx].layout, NULL);
+        for (uint32_t j = 0; j < state->compute_pipelines[idx].set_layout_count; ++j) {
+            vkDestroyDescriptorSetLayout(state->device, state->compute_pipelines[idx].set_layouts[j], NULL);
+        }
+        state->compute_pipelines[idx].set_layout_count = 0;
         state->compute_pipelines[idx].active = false;
     }
 }
 
-static void vulkan_compute_dispatch(RendererBackend* backend, uint32_t pipeline_id, uint32_t group_x, uint32_t group_y, uint32_t group_z, void* push_constants, size_t push_constants_size) {
-    VulkanRendererState* state = (VulkanRendererState*)backend->state;
-    if (pipeline_id == 0 || pipeline_id > MAX_COMPUTE_PIPELINES) return;
-    
-    int idx = (int)pipeline_id - 1;
-    if (!state->compute_pipelines[idx].active) return;
-    
-    VkPipeline pipeline = state->compute_pipelines[idx].pipeline;
+// Resolves the bound buffers into Set 1: pushed when the pipeline allows it, otherwise a
+// cached set. Returns VK_NULL_HANDLE for pushed or empty sets.
+static VkDescriptorSet compute_acquire_ssbo_set(VulkanRendererState* state, int idx, VkBuffer buffers[MAX_COMPUTE_BINDINGS]) {
+    uint32_t mask = state->compute_pipelines[idx].ssbo_binding_mask;
+    for (int i = 0; i < MAX_COMPUTE_BINDINGS; ++i) {
+        VkBufferWrapper* wrapper = state->compute_bindings[i].buffer;
+        buffers[i] = ((mask & (1u << i)) && wrapper) ? wrapper->buffer : VK_NULL_HANDLE;
+    }
+    if (mask == 0 || state->compute_pipelines[idx].push_descriptors) return VK_NULL_HANDLE;
+
     VkPipelineLayout layout = state->compute_pipelines[idx].layout;
-    
-    // --- Update SSBO Descriptors (Set 1) ---
-    // Identify active bindings and update the descriptor set on-the-fly.
-    // In production, we should cache these or use Push Descriptors.
+    VkDescriptorSetLayout set_layout = state->compute_pipelines[idx].set_layouts[COMPUTE_SSBO_SET];
+    VkDescriptorSet set = vk_descriptor_cache_get(state, layout, set_layout, mask, buffers);
+    if (!set) {
+        // Pool exhausted by this batch: retire the recorded work, then start over
+        LOG_DEBUG("Compute: descriptor cache full, flushing batch");
+        compute_flush(state);
+        vk_descriptor_cache_reset(state);
+        set = vk_descriptor_cache_get(state, layout, set_layout, mask, buffers);
+    }
+    return set;
+}
+
+static void compute_push_ssbos(VulkanRendererState* state, VkPipelineLayout layout, const VkBuffer buffers[MAX_COMPUTE_BINDINGS]) {
     VkWriteDescriptorSet writes[MAX_COMPUTE_BINDINGS];
     VkDescriptorBufferInfo dbis[MAX_COMPUTE_BINDINGS];
     uint32_t write_count = 0;
 
-    for (int i = 0; i < MAX_COMPUTE_BINDINGS; ++i) {
-        if (state->compute_bindings[i].buffer) {
-            dbis[write_count].buffer = state->compute_bindings[i].buffer->buffer;
-            dbis[write_count].offset = 0;
-            dbis[write_count].range = VK_WHOLE_SIZE;
-
-            writes[write_count].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-            writes[write_count].pNext = NULL;
-            writes[write_count].dstSet = state->compute_ssbo_descriptor;
-            writes[write_count].dstBinding = i;
-            writes[write_count].dstArrayElement = 0;
-            writes[write_count].descriptorCount = 1;
-            writes[write_count].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-            writes[write_count].pImageInfo = NULL;
-            writes[write_count].pBufferInfo = &dbis[write_count];
-            writes[write_count].pTexelBufferView = NULL;
-            
-            write_count++;
-        }
+    for (uint32_t i = 0; i < MAX_COMPUTE_BINDINGS; ++i) {
+        if (!buffers[i]) continue;
+        dbis[write_count] = (VkDescriptorBufferInfo){ .buffer = buffers[i], .offset = 0, .range = VK_WHOLE_SIZE };
+        writes[write_count] = (VkWriteDescriptorSet){
+            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .dstBinding = i,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+            .pBufferInfo = &dbis[write_count]
+        };
+        write_count++;
     }
-    
     if (write_count > 0) {
-        vkUpdateDescriptorSets(state->device, write_count, writes, 0, NULL);
+        state->cmd_push_descriptor_set(state->compute_cmd, VK_PIPELINE_BIND_POINT_COMPUTE, layout, COMPUTE_SSBO_SET, write_count, writes);
     }
+}
+
+static void vulkan_compute_dispatch(RendererBackend* backend, uint32_t pipeline_id, uint32_t group_x, uint32_t group_y, uint32_t group_z, void* push_constants, size_t push_constants_size) {
+    VulkanRendererState* state = (VulkanRendererState*)backend->state;
+    if (pipeline_id == 0 || pipeline_id > MAX_COMPUTE_PIPELINES) return;
     
-    // Use the dedicated compute command buffer
-    vkWaitForFences(state->device, 1, &state->compute_fence, VK_TRUE, UINT64_MAX);
-    vkResetFences(state->device, 1, &state->compute_fence);
-    
-    vkResetCommandBuffer(state->compute_cmd, 0);
-    
-    VkCommandBufferBeginInfo begin_info = { .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
-    if (vkBeginCommandBuffer(state->compute_cmd, &begin_info) != VK_SUCCESS) {
-        LOG_ERROR("Failed to begin compute cmd");
-        return;
-    }
+    int idx = (int)pipeline_id - 1;
+    if (!state->compute_pipelines[idx].active) return;
     
-    // Bind Pipeline
-    vkCmdBindPipeline(state->compute_cmd, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+    VkPipeline pipeline = state->compute_pipelines[idx].pipeline;
+    VkPipelineLayout layout = state->compute_pipelines[idx].layout;
+
+    if (!state->compute_recording && !compute_open(state)) return;
+
+    // --- SSBO Descriptors (Set 1) ---
+    // Resolved first: running out of cached sets restarts the command buffer
+    VkBuffer buffers[MAX_COMPUTE_BINDINGS];
+    VkDescriptorSet ssbo_set = compute_acquire_ssbo_set(state, idx, buffers);
+    if (!state->compute_recording) return;
+    VkCommandBuffer cmd = state->compute_cmd;
+
+    // Uploads queued so far must land before the dispatch reads them
+    vk_staging_record(state, cmd, state->compute_fence);
     
-    // Bind Descriptor Set 0 (Write Target)
-    if (state->compute_write_descriptor) {
-        vkCmdBindDescriptorSets(state->compute_cmd, VK_PIPELINE_BIND_POINT_COMPUTE, layout, 0, 1, &state->compute_write_descriptor, 0, NULL);
+    // Bind Pipeline and Descriptor Set 0 (Write Target); both persist across the batch
+    if (state->compute_bound_pipeline != pipeline) {
+        vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+        if (state->compute_write_descriptor) {
+            vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, layout, 0, 1, &state->compute_write_descriptor, 0, NULL);
+        }
+        state->compute_bound_pipeline = pipeline;
     }
 
     // Bind Descriptor Set 1 (SSBOs)
-    if (state->compute_ssbo_descriptor) {
-        vkCmdBindDescriptorSets(state->compute_cmd, VK_PIPELINE_BIND_POINT_COMPUTE, layout, 1, 1, &state->compute_ssbo_descriptor, 0, NULL);
+    if (state->compute_pipelines[idx].push_descriptors) {
+        compute_push_ssbos(state, layout, buffers);
+    } else if (ssbo_set) {
+        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, layout, COMPUTE_SSBO_SET, 1, &ssbo_set, 0, NULL);
     }
     
     // Push Constants
     if (push_constants && push_constants_size > 0) {
-        vkCmdPushConstants(state->compute_cmd, layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, (uint32_t)push_constants_size, push_constants);
+        vkCmdPushConstants(cmd, layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, (uint32_t)push_constants_size, push_constants);
     }
     
     // Dispatch
-    vkCmdDispatch(state->compute_cmd, group_x, group_y, group_z);
+    vkCmdDispatch(cmd, group_x, group_y, group_z);
     
-    // Barrier (Global Memory + Image)
+    // Barrier (Global Memory + Image). Orders this pass before the next one in the batch
+    // (read-after-write and write-after-write) and before the graphics frame.
     VkImageMemoryBarrier barrier = {
         .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
         .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
         .newLayout = VK_IMAGE_LAYOUT_GENERAL,
         .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
-        .dstAccessMask = VK_ACCESS_SHADER_READ_BIT,
+        .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
         .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
         .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
         .image = state->compute_target_image,
@@ -208,76 +353,37 @@ static void vulkan_compute_dispatch(RendererBackend* backend, uint32_t pipeline_
     VkMemoryBarrier mem_barrier = {
         .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
         .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
-        .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_HOST_READ_BIT
+        .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT |
+                         VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_HOST_READ_BIT
     };
     
-    vkCmdPipelineBarrier(state->compute_cmd, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &mem_barrier, 0, NULL, 1, &barrier);
-    
-    vkEndCommandBuffer(state->compute_cmd);
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT | VK_PIPELINE_STAGE_HOST_BIT,
+                         0, 1, &mem_barrier, 0, NULL, 1, &barrier);
     
-    // Submit
-    VkSubmitInfo submit_info = {
-        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-        .commandBufferCount = 1,
-        .pCommandBuffers = &state->compute_cmd
-    };
-    
-    if (vkQueueSubmit(state->queue, 1, &submit_info, state->compute_fence) != VK_SUCCESS) {
-        LOG_ERROR("Failed to submit compute queue");
+    if (state->compute_batch_depth == 0) {
+        compute_close(state);
     }
 }
 
 static void vulkan_compute_wait(RendererBackend* backend) {
     VulkanRendererState* state = (VulkanRendererState*)backend->state;
+    // Inside a batch this submits what was recorded so far
+    compute_flush(state);
     vkWaitForFences(state->device, 1, &state->compute_fence, VK_TRUE, UINT64_MAX);
 }
 
-static bool vulkan_compile_shader(RendererBackend* backend, const char* source, size_t size, const char* stage, void** out_spv, size_t* out_spv_size) {
-    (void)backend;
-    
-    LOG_INFO("Vulkan Compile: Start. Size: %zu", size);
-
-    // 1. Ensure logs dir exists
-    platform_mkdir("logs");
-    
-    // 2. Write source to temp file
-    const char* tmp_src = "logs/tmp_compile.glsl";
-    const char* tmp_spv = "logs/tmp_compile.spv";
-    
-    LOG_INFO("Vulkan Compile: Writing source to %s", tmp_src);
-    FILE* f = fopen(tmp_src, "w");
-    if (!f) {
-        LOG_ERROR("Failed to open tmp file");
-        return false;
-    }
-    fwrite(source, 1, size, f);
-    fclose(f);
-    
-    // 3. Construct Command
-    char cmd[512];
-    snprintf(cmd, sizeof(cmd), "glslc -fshader-stage=%s %s -o %s", stage, tmp_src, tmp_spv);
-    
-    // 4. Run
-    LOG_INFO("Vulkan Compile: Running '%s'", cmd);
-    int res = system(cmd);
-    if (res != 0) {
-        LOG_ERROR("Vulkan: Shader compilation failed. Command: %s", cmd);
-        return false;
-    }
-    
-    // 5. Read Result
-    LOG_INFO("Vulkan Compile: Reading result from %s", tmp_spv);
-    size_t sz = 0;
-    void* code = fs_read_bin(NULL, tmp_spv, &sz);
-    if (!code) return false;
-    
-    *out_spv = code;
-    *out_spv_size = sz;
-    return true;
+static bool vulkan_compile_shader(RendererBackend* backend, const char* source, size_t size, const char* stage,
+                                  void** out_spv, size_t* out_spv_size, ShaderDiagnostics* out_diagnostics) {
+    VulkanRendererState* state = (VulkanRendererState*)backend->state;
+    return vk_shader_compiler_compile(state->shader_compiler, source, size, stage, out_spv, out_spv_size, out_diagnostics);
 }
 
 static bool vulkan_renderer_init(RendererBackend* backend, const RenderBackendInit* init) {
     VulkanRendererState* state = (VulkanRendererState*)backend->state;
+    if (!init->window) {
+        LOG_ERROR("Vulkan: A window is required (use the \"null\" backend for headless runs)");
+        return false;
+    }
     
     // Config
     state->window = init->window;
@@ -308,6 +414,10 @@ static bool vulkan_renderer_init(RendererBackend* backend, const RenderBackendIn
 
     // 3. Device
     vk_pick_physical_and_create_device(state);
+    if (!vk_memory_init(state)) {
+        LOG_FATAL("Failed to initialize device memory");
+        return false;
+    }
 
     // 4. Swapchain
     vk_create_swapchain_and_views(state, VK_NULL_HANDLE);
@@ -346,16 +456,13 @@ static bool vulkan_renderer_init(RendererBackend* backend, const RenderBackendIn
     vk_create_font_texture(state);
     vk_create_descriptor_pool_and_set(state);
 
-    VkDescriptorSetAllocateInfo dsai = {
-        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
-        .descriptorPool = state->descriptor_pool,
-        .descriptorSetCount = 1,
-        .pSetLayouts = &state->compute_ssbo_layout
-    };
-    if (vkAllocateDescriptorSets(state->device, &dsai, &state->compute_ssbo_descriptor) != VK_SUCCESS) {
-        LOG_FATAL("Failed to allocate compute SSBO descriptor");
+    if (!vk_descriptor_cache_init(state)) {
+        LOG_FATAL("Failed to create compute descriptor cache");
     }
 
+    // Created up front: compile_shader is called from the shader cache's workers
+    state->shader_compiler = vk_shader_compiler_create();
+
     // 9. Static Buffers (Quad)
     // Vertex Buffer
     VkDeviceSize v_size = sizeof(PRIM_QUAD_VERTS);
@@ -395,14 +502,7 @@ static bool vulkan_renderer_init(RendererBackend* backend, const RenderBackendIn
     // 11. Compute Infrastructure
     VkFenceCreateInfo fci = { .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, .flags = VK_FENCE_CREATE_SIGNALED_BIT };
     vkCreateFence(state->device, &fci, NULL, &state->compute_fence);
-    
-    VkCommandBufferAllocateInfo cbai = { 
-        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, 
-        .commandPool = state->cmdpool, 
-        .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY, 
-        .commandBufferCount = 1 
-    };
-    vkAllocateCommandBuffers(state->device, &cbai, &state->compute_cmd);
+    compute_allocate_cmd(state);
     
     vk_ensure_compute_target(state, 512, 512);
 
@@ -416,6 +516,9 @@ static void vulkan_renderer_update_viewport(RendererBackend* backend, int width,
     if (width == 0 || height == 0) return;
     
     vkDeviceWaitIdle(state->device);
+
+    // Queued uploads go out now: the command pool and frame fences are about to be recreated
+    vk_staging_submit_pending(state);
     
     // Save old swapchain handle
     VkSwapchainKHR old_swapchain = state->swapchain;
@@ -440,17 +543,25 @@ static void vulkan_renderer_update_viewport(RendererBackend* backend, int width,
     
     // Recreate Framebuffers, Command Pool, and Command Buffers (which were destroyed by cleanup)
     vk_create_cmds_and_sync(state);
+    compute_allocate_cmd(state);
     
     // Recreate Pipeline (which depends on Render Pass and was destroyed)
     vk_create_pipeline(state);
-    
-    // Reset frame cursor as sync objects were recreated
-    state->current_frame_cursor = 0;
+
+    // The frame cursor is kept: a resize can land between begin_frame and submit, and the
+    // frame must submit on the slot whose mapped regions it wrote. The new fences start
+    // signaled and the device is idle, so any slot is free.
 }
 
 static void vulkan_renderer_cleanup(RendererBackend* backend) {
     if (!backend) return;
     VulkanRendererState* state = (VulkanRendererState*)backend->state;
+    if (state && !state->device) {
+        // Never initialized (no window, or init was not reached)
+        if (state->instance) vkDestroyInstance(state->instance, NULL);
+        free(state);
+        state = NULL;
+    }
     if (state) {
         vkDeviceWaitIdle(state->device);
         
@@ -464,7 +575,11 @@ static void vulkan_renderer_cleanup(RendererBackend* backend) {
         if (state->vert_shader_src.code) free(state->vert_shader_src.code);
         if (state->frag_shader_src.code) free(state->frag_shader_src.code);
 
+        vk_staging_destroy(state);
+        vk_descriptor_cache_destroy(state);
+        vk_shader_compiler_destroy(state->shader_compiler);
         vk_destroy_device_resources(state);
+        vk_memory_shutdown(state);
         
         if (state->surface) {
             platform_destroy_surface(state->instance, NULL, state->platform_surface);
@@ -480,9 +595,13 @@ static bool vulkan_buffer_create(RendererBackend* backend, Stream* stream) {
     VulkanRendererState* state = (VulkanRendererState*)backend->state;
     VkBufferWrapper* wrapper = malloc(sizeof(VkBufferWrapper));
     // Default to Storage Buffer + Transfer Dest/Src + Vertex Buffer
+    // Host-visible streams are written by the CPU every frame through a persistent mapping
+    VkMemoryPropertyFlags props = stream->host_visible
+        ? (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+        : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
     if (vk_buffer_create(state, stream->total_size, 
         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT, 
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, wrapper)) {
+        props, wrapper)) {
         stream->buffer_handle = wrapper;
         return true;
     }
@@ -495,6 +614,9 @@ static void vulkan_buffer_destroy(RendererBackend* backend, Stream* stream) {
     VulkanRendererState* state = (VulkanRendererState*)backend->state;
     VkBufferWrapper* wrapper = (VkBufferWrapper*)stream->buffer_handle;
     if (wrapper) {
+        // An open compute batch may reference it
+        compute_flush(state);
+
         // Clear bindings if this buffer is bound
         for (int i=0; i<MAX_COMPUTE_BINDINGS; ++i) {
             if (state->compute_bindings[i].buffer == wrapper) {
@@ -525,11 +647,18 @@ static void vulkan_buffer_unmap(RendererBackend* backend, Stream* stream) {
 
 static bool vulkan_buffer_upload(RendererBackend* backend, Stream* stream, const void* data, size_t size, size_t offset) {
     VulkanRendererState* state = (VulkanRendererState*)backend->state;
+    if (stream->host_visible) {
+        // Written in place: dispatches recorded or in flight must see the old contents
+        compute_flush(state);
+        vkWaitForFences(state->device, 1, &state->compute_fence, VK_TRUE, UINT64_MAX);
+    }
     return vk_buffer_upload(state, (VkBufferWrapper*)stream->buffer_handle, data, size, offset);
 }
 
 static bool vulkan_buffer_read(RendererBackend* backend, Stream* stream, void* dst, size_t size, size_t offset) {
     VulkanRendererState* state = (VulkanRendererState*)backend->state;
+    // Results recorded into an open compute batch must be on the queue first
+    compute_flush(state);
     return vk_buffer_read(state, (VkBufferWrapper*)stream->buffer_handle, dst, size, offset);
 }
 
@@ -651,19 +780,12 @@ static void vk_create_texture_internal(VulkanRendererState* state, int slot, uin
     }
     
     // 3. Memory
-    VkMemoryRequirements mr; 
-    vkGetImageMemoryRequirements(state->device, state->textures[slot].image, &mr);
-    VkMemoryAllocateInfo mai = { 
-        .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, 
-        .allocationSize = mr.size, 
-        .memoryTypeIndex = find_mem_type(state->physical_device, mr.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) 
-    };
-    
-    if (vkAllocateMemory(state->device, &mai, NULL, &state->textures[slot].memory) != VK_SUCCESS) {
+    if (!vk_memory_bind_image(state, state->textures[slot].image, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &state->textures[slot].allocation)) {
         LOG_ERROR("Failed to allocate texture memory");
+        vkDestroyImage(state->device, state->textures[slot].image, NULL);
+        state->textures[slot].image = VK_NULL_HANDLE;
         return;
     }
-    vkBindImageMemory(state->device, state->textures[slot].image, state->textures[slot].memory, 0);
 
     // 4. View
     VkImageViewCreateInfo ivci = { 
@@ -740,7 +862,7 @@ static void vulkan_texture_destroy(RendererBackend* backend, uint32_t handle) {
         
         if (state->textures[idx].view) vkDestroyImageView(state->device, state->textures[idx].view, NULL);
         if (state->textures[idx].image) vkDestroyImage(state->device, state->textures[idx].image, NULL);
-        if (state->textures[idx].memory) vkFreeMemory(state->device, state->textures[idx].memory, NULL);
+        vk_memory_free(state, &state->textures[idx].allocation);
         if (state->textures[idx].sampler) vkDestroySampler(state->device, state->textures[idx].sampler, NULL);
         
         // Note: We don't free the cached descriptor set because it's allocated from a pool 
@@ -827,16 +949,29 @@ static void* vulkan_texture_get_descriptor(RendererBackend* backend, uint32_t ha
     return (void*)state->textures[idx].descriptor;
 }
 
+static uint32_t vulkan_renderer_begin_frame(RendererBackend* backend) {
+    VulkanRendererState* state = (VulkanRendererState*)backend->state;
+    // Time blocked here is the GPU (or vsync) holding the CPU back
+    PROFILE_BEGIN("vk_wait_frame_fence");
+    vkWaitForFences(state->device, 1, &state->fences[state->current_frame_cursor], VK_TRUE, UINT64_MAX);
+    PROFILE_END();
+    return state->current_frame_cursor;
+}
+
 static void vulkan_renderer_submit_commands(RendererBackend* backend, const RenderCommandList* list) {
     VulkanRendererState* state = (VulkanRendererState*)backend->state;
     if (!state || !list) return;
 
     // --- Frame Sync ---
+    // Already signaled when begin_frame ran for this frame
     vkWaitForFences(state->device, 1, &state->fences[state->current_frame_cursor], VK_TRUE, UINT64_MAX);
+    vk_staging_begin_frame(state); // Must open before the fence is reset below
     
     uint32_t image_index;
+    PROFILE_BEGIN("vk_acquire_image");
     VkResult result = vkAcquireNextImageKHR(state->device, state->swapchain, UINT64_MAX, 
                                             state->sem_img_avail, VK_NULL_HANDLE, &image_index);
+    PROFILE_END();
 
     if (result == VK_ERROR_OUT_OF_DATE_KHR || (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)) {
         return;
@@ -854,6 +989,10 @@ static void vulkan_renderer_submit_commands(RendererBackend* backend, const Rend
     
     VkCommandBufferBeginInfo begin_info = {.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
     vkBeginCommandBuffer(cmd, &begin_info);
+
+    // --- Uploads ---
+    // Every stream upload of this frame, copied from the slot's staging ring
+    vk_staging_record(state, cmd, state->fences[state->current_frame_cursor]);
     
     // --- Begin Pass ---
     VkRenderPassBeginInfo pass_info = {.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO};
@@ -1035,7 +1174,7 @@ static void vulkan_renderer_submit_commands(RendererBackend* backend, const Rend
 
     // Handle Screenshot Logic
     VkBuffer screenshot_buffer = VK_NULL_HANDLE;
-    VkDeviceMemory screenshot_memory = VK_NULL_HANDLE;
+    GpuAllocation screenshot_memory = {0};
     bool capturing_screenshot = state->screenshot_pending;
 
     if (capturing_screenshot) {
@@ -1051,17 +1190,7 @@ static void vulkan_renderer_submit_commands(RendererBackend* backend, const Rend
             .sharingMode = VK_SHARING_MODE_EXCLUSIVE
         };
         vkCreateBuffer(state->device, &bci, NULL, &screenshot_buffer);
-        
-        VkMemoryRequirements mem_reqs;
-        vkGetBufferMemoryRequirements(state->device, screenshot_buffer, &mem_reqs);
-        
-        VkMemoryAllocateInfo alloc_info = {
-            .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-            .allocationSize = mem_reqs.size,
-            .memoryTypeIndex = find_mem_type(state->physical_device, mem_reqs.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
-        };
-        vkAllocateMemory(state->device, &alloc_info, NULL, &screenshot_memory);
-        vkBindBufferMemory(state->device, screenshot_buffer, screenshot_memory, 0);
+        vk_memory_bind_buffer(state, screenshot_buffer, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, &screenshot_memory);
         
         // 2. Transition Swapchain to TRANSFER_SRC
         VkImageMemoryBarrier barrier = {
@@ -1112,12 +1241,11 @@ static void vulkan_renderer_submit_commands(RendererBackend* backend, const Rend
     if (capturing_screenshot) {
         vkWaitForFences(state->device, 1, &state->fences[state->current_frame_cursor], VK_TRUE, UINT64_MAX);
         
-        void* mapped_data;
-        vkMapMemory(state->device, screenshot_memory, 0, VK_WHOLE_SIZE, 0, &mapped_data);
+        void* mapped_data = screenshot_memory.mapped; // Persistently mapped block
         
         // Copy to CPU buffer
         VkDeviceSize data_size = state->swapchain_extent.width * state->swapchain_extent.height * 4;
-        void* cpu_data = malloc(data_size);
+        void* cpu_data = mapped_data ? malloc(data_size) : NULL;
         if (cpu_data) {
             memcpy(cpu_data, mapped_data, data_size);
             
@@ -1142,9 +1270,8 @@ static void vulkan_renderer_submit_commands(RendererBackend* backend, const Rend
             }
         }
         
-        vkUnmapMemory(state->device, screenshot_memory);
         vkDestroyBuffer(state->device, screenshot_buffer, NULL);
-        vkFreeMemory(state->device, screenshot_memory, NULL);
+        vk_memory_free(state, &screenshot_memory);
     }
 
     VkPresentInfoKHR present_info = {.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR};
@@ -1154,9 +1281,12 @@ static void vulkan_renderer_submit_commands(RendererBackend* backend, const Rend
     present_info.pSwapchains = &state->swapchain;
     present_info.pImageIndices = &image_index;
     
+    PROFILE_BEGIN("vk_present");
     vkQueuePresentKHR(state->queue, &present_info);
+    PROFILE_END();
     
-    state->current_frame_cursor = (state->current_frame_cursor + 1) % 2;
+    vk_staging_end_frame(state);
+    state->current_frame_cursor = (state->current_frame_cursor + 1) % RENDER_FRAMES_IN_FLIGHT;
 }
 
 // Factory
@@ -1174,6 +1304,7 @@ RendererBackend* vulkan_renderer_backend(void) {
     backend->id = "vulkan";
     backend->state = state;
     backend->init = vulkan_renderer_init;
+    backend->begin_frame = vulkan_renderer_begin_frame;
     backend->submit_commands = vulkan_renderer_submit_commands; // Register new method
     backend->update_viewport = vulkan_renderer_update_viewport;
 
@@ -1185,6 +1316,8 @@ RendererBackend* vulkan_renderer_backend(void) {
     backend->compute_pipeline_destroy = vulkan_compute_pipeline_destroy;
     backend->compute_dispatch = vulkan_compute_dispatch;
     backend->compute_wait = vulkan_compute_wait;
+    backend->compute_begin = vulkan_compute_begin;
+    backend->compute_end = vulkan_compute_end;
     backend->compile_shader = vulkan_compile_shader;
     
     // Buffer
@@ -0,0 +1,518 @@
+#include "engine/graphics/internal/gpu_allocator.h"
+#include "foundation/logger/logger.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// --- TLSF Layout ---
+// First level: power of two of the size. Second level: TLSF_SL_COUNT linear
+// subdivisions of that range. Sizes are multiples of GPU_ALLOCATOR_GRANULE.
+#define TLSF_SL_LOG2 4
+#define TLSF_SL_COUNT (1u << TLSF_SL_LOG2)
+#define TLSF_FL_COUNT 48 // Covers blocks up to 2^51 bytes
+#define NODE_NONE UINT32_MAX
+#define BLOCK_TRANSIENT UINT32_MAX
+
+// One contiguous range of a block, free or in use
+typedef struct TlsfNode {
+    uint64_t offset;
+    uint64_t size;
+    uint32_t prev_phys; // Physical neighbours within the block
+    uint32_t next_phys;
+    uint32_t prev_free; // Free-list links (free nodes); next_free also links unused records
+    uint32_t next_free;
+    bool free;
+} TlsfNode;
+
+typedef struct GpuBlock {
+    bool alive;
+    bool dedicated;
+    GpuResourceKind kind;
+    uint32_t memory_type;
+    uint64_t memory;
+    void* mapped;
+    uint64_t size;
+    uint64_t used;
+    uint32_t allocation_count;
+
+    uint64_t fl_bitmap;
+    uint32_t sl_bitmap[TLSF_FL_COUNT];
+    uint32_t heads[TLSF_FL_COUNT][TLSF_SL_COUNT];
+} GpuBlock;
+
+typedef struct LinearBlock {
+    uint32_t memory_type;
+    uint64_t memory;
+    void* mapped;
+    uint64_t size;
+    uint64_t used;
+} LinearBlock;
+
+typedef struct FrameArena {
+    LinearBlock* blocks;
+    size_t count;
+    size_t capacity;
+} FrameArena;
+
+struct GpuAllocator {
+    GpuHeap heap;
+    uint64_t block_size;
+    uint32_t frame_count;
+
+    GpuBlock** blocks; // Stable pointers; dead slots are reused
+    size_t block_count;
+    size_t block_capacity;
+
+    TlsfNode* nodes;
+    size_t node_count;
+    size_t node_capacity;
+    uint32_t free_node_records;
+
+    FrameArena frames[GPU_ALLOCATOR_MAX_FRAMES];
+
+    GpuAllocatorStats stats;
+};
+
+// --- Bit Helpers ---
+
+static uint32_t bit_scan_forward(uint64_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return (uint32_t)index;
+#else
+    return (uint32_t)__builtin_ctzll(value);
+#endif
+}
+
+static uint32_t bit_scan_reverse(uint64_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return (uint32_t)index;
+#else
+    return 63u - (uint32_t)__builtin_clzll(value);
+#endif
+}
+
+static uint64_t align_up(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// --- Node Records ---
+
+static uint32_t node_acquire(GpuAllocator* a) {
+    if (a->free_node_records != NODE_NONE) {
+        uint32_t index = a->free_node_records;
+        a->free_node_records = a->nodes[index].next_free;
+        return index;
+    }
+    if (a->node_count == a->node_capacity) {
+        size_t new_cap = a->node_capacity ? a->node_capacity * 2 : 256;
+        TlsfNode* nodes = (TlsfNode*)realloc(a->nodes, new_cap * sizeof(TlsfNode));
+        if (!nodes) return NODE_NONE;
+        a->nodes = nodes;
+        a->node_capacity = new_cap;
+    }
+    return (uint32_t)a->node_count++;
+}
+
+static void node_release(GpuAllocator* a, uint32_t index) {
+    a->nodes[index].next_free = a->free_node_records;
+    a->free_node_records = index;
+}
+
+// --- TLSF Index ---
+
+static void mapping_insert(uint64_t size, uint32_t* fl, uint32_t* sl) {
+    uint32_t msb = bit_scan_reverse(size);
+    if (msb < TLSF_SL_LOG2) {
+        *fl = 0;
+        *sl = (uint32_t)size;
+    } else {
+        *fl = msb - TLSF_SL_LOG2 + 1;
+        *sl = (uint32_t)(size >> (msb - TLSF_SL_LOG2)) - TLSF_SL_COUNT;
+    }
+}
+
+// Rounds up to the next list start so every block in the found list is big enough
+static void mapping_search(uint64_t size, uint32_t* fl, uint32_t* sl) {
+    uint32_t msb = bit_scan_reverse(size);
+    if (msb >= TLSF_SL_LOG2) {
+        size += ((uint64_t)1 << (msb - TLSF_SL_LOG2)) - 1;
+    }
+    mapping_insert(size, fl, sl);
+}
+
+static void free_list_insert(GpuAllocator* a, GpuBlock* block, uint32_t index) {
+    TlsfNode* node = &a->nodes[index];
+    uint32_t fl, sl;
+    mapping_insert(node->size, &fl, &sl);
+
+    uint32_t head = block->heads[fl][sl];
+    node->free = true;
+    node->prev_free = NODE_NONE;
+    node->next_free = head;
+    if (head != NODE_NONE) a->nodes[head].prev_free = index;
+    block->heads[fl][sl] = index;
+    block->fl_bitmap |= (uint64_t)1 << fl;
+    block->sl_bitmap[fl] |= 1u << sl;
+}
+
+static void free_list_remove(GpuAllocator* a, GpuBlock* block, uint32_t index) {
+    TlsfNode* node = &a->nodes[index];
+    uint32_t fl, sl;
+    mapping_insert(node->size, &fl, &sl);
+
+    if (node->prev_free != NODE_NONE) a->nodes[node->prev_free].next_free = node->next_free;
+    if (node->next_free != NODE_NONE) a->nodes[node->next_free].prev_free = node->prev_free;
+    if (block->heads[fl][sl] == index) {
+        block->heads[fl][sl] = node->next_free;
+        if (node->next_free == NODE_NONE) {
+            block->sl_bitmap[fl] &= ~(1u << sl);
+            if (block->sl_bitmap[fl] == 0) block->fl_bitmap &= ~((uint64_t)1 << fl);
+        }
+    }
+    node->free = false;
+}
+
+static uint32_t find_free_node(const GpuBlock* block, uint64_t size) {
+    uint32_t fl, sl;
+    mapping_search(size, &fl, &sl);
+    if (fl >= TLSF_FL_COUNT) return NODE_NONE;
+
+    uint32_t sl_map = block->sl_bitmap[fl] & (~0u << sl);
+    if (!sl_map) {
+        uint64_t fl_map = (fl + 1 < 64) ? block->fl_bitmap & (~(uint64_t)0 << (fl + 1)) : 0;
+        if (!fl_map) return NODE_NONE;
+        fl = bit_scan_forward(fl_map);
+        sl_map = block->sl_bitmap[fl];
+    }
+    return block->heads[fl][bit_scan_forward(sl_map)];
+}
+
+// The free node of an empty block spans the whole block
+static uint32_t root_free_node(const GpuBlock* block) {
+    if (!block->fl_bitmap) return NODE_NONE;
+    uint32_t fl = bit_scan_reverse(block->fl_bitmap);
+    return block->heads[fl][bit_scan_reverse(block->sl_bitmap[fl])];
+}
+
+// Splits [node] into [node: size][new free node: rest]
+static bool split_tail(GpuAllocator* a, GpuBlock* block, uint32_t index, uint64_t size) {
+    uint32_t rest = node_acquire(a);
+    if (rest == NODE_NONE) return false;
+    TlsfNode* node = &a->nodes[index];
+    TlsfNode* tail = &a->nodes[rest];
+    tail->offset = node->offset + size;
+    tail->size = node->size - size;
+    tail->prev_phys = index;
+    tail->next_phys = node->next_phys;
+    if (node->next_phys != NODE_NONE) a->nodes[node->next_phys].prev_phys = rest;
+    node->next_phys = rest;
+    node->size = size;
+    free_list_insert(a, block, rest);
+    return true;
+}
+
+// --- Blocks ---
+
+static GpuBlock* block_create(GpuAllocator* a, uint32_t memory_type, GpuResourceKind kind, uint64_t size, bool dedicated, uint32_t* out_index) {
+    size_t slot = a->block_count;
+    for (size_t i = 0; i < a->block_count; ++i) {
+        if (!a->blocks[i]->alive) { slot = i; break; }
+    }
+    if (slot == a->block_count) {
+        if (a->block_count == a->block_capacity) {
+            size_t new_cap = a->block_capacity ? a->block_capacity * 2 : 16;
+            GpuBlock** blocks = (GpuBlock**)realloc(a->blocks, new_cap * sizeof(GpuBlock*));
+            if (!blocks) return NULL;
+            a->blocks = blocks;
+            a->block_capacity = new_cap;
+        }
+        a->blocks[slot] = (GpuBlock*)calloc(1, sizeof(GpuBlock));
+        if (!a->blocks[slot]) return NULL;
+        a->block_count++;
+    }
+
+    uint32_t first = node_acquire(a);
+    if (first == NODE_NONE) return NULL;
+
+    uint64_t memory = 0;
+    void* mapped = NULL;
+    if (!a->heap.allocate(a->heap.user, memory_type, size, &memory, &mapped)) {
+        node_release(a, first);
+        return NULL;
+    }
+
+    GpuBlock* block = a->blocks[slot];
+    memset(block, 0, sizeof(*block));
+    memset(block->heads, 0xFF, sizeof(block->heads));
+    block->alive = true;
+    block->dedicated = dedicated;
+    block->kind = kind;
+    block->memory_type = memory_type;
+    block->memory = memory;
+    block->mapped = mapped;
+    block->size = size;
+
+    TlsfNode* node = &a->nodes[first];
+    node->offset = 0;
+    node->size = size;
+    node->prev_phys = NODE_NONE;
+    node->next_phys = NODE_NONE;
+    free_list_insert(a, block, first);
+
+    a->stats.block_count++;
+    a->stats.bytes_reserved += size;
+    *out_index = (uint32_t)slot;
+    return block;
+}
+
+static void block_release(GpuAllocator* a, uint32_t index) {
+    GpuBlock* block = a->blocks[index];
+    uint32_t head = root_free_node(block);
+    if (head != NODE_NONE) node_release(a, head);
+
+    a->heap.free(a->heap.user, block->memory_type, block->memory);
+    a->stats.block_count--;
+    a->stats.bytes_reserved -= block->size;
+    block->alive = false;
+}
+
+static bool block_place(GpuAllocator* a, GpuBlock* block, uint32_t block_index, uint64_t size, uint64_t alignment, GpuAllocation* out) {
+    // Offsets are granule aligned, so at most (alignment - granule) bytes of padding
+    // An empty block starts at offset 0 and fits exactly, which the rounded search would miss
+    uint64_t padding = alignment > GPU_ALLOCATOR_GRANULE ? alignment - GPU_ALLOCATOR_GRANULE : 0;
+    uint32_t index = block->allocation_count == 0 ? root_free_node(block) : find_free_node(block, size + padding);
+    if (index == NODE_NONE || a->nodes[index].size < size) return false;
+
+    free_list_remove(a, block, index);
+
+    // Front padding becomes its own free node
+    uint64_t aligned = align_up(a->nodes[index].offset, alignment);
+    uint64_t front = aligned - a->nodes[index].offset;
+    if (front > 0) {
+        if (!split_tail(a, block, index, front)) {
+            free_list_insert(a, block, index);
+            return false;
+        }
+        uint32_t placed = a->nodes[index].next_phys;
+        free_list_remove(a, block, placed);
+        free_list_insert(a, block, index);
+        index = placed;
+    }
+
+    // Out of node records: the placement keeps the whole range
+    if (a->nodes[index].size > size) split_tail(a, block, index, size);
+
+    TlsfNode* node = &a->nodes[index];
+    block->used += node->size;
+    block->allocation_count++;
+    a->stats.allocation_count++;
+    a->stats.bytes_used += node->size;
+
+    out->memory = block->memory;
+    out->offset = node->offset;
+    out->size = size;
+    out->mapped = block->mapped ? (uint8_t*)block->mapped + node->offset : NULL;
+    out->memory_type = block->memory_type;
+    out->block = block_index;
+    out->node = index;
+    return true;
+}
+
+// --- API ---
+
+GpuAllocator* gpu_allocator_create(const GpuAllocatorConfig* config) {
+    if (!config || !config->heap.allocate || !config->heap.free) return NULL;
+
+    GpuAllocator* a = (GpuAllocator*)calloc(1, sizeof(GpuAllocator));
+    if (!a) return NULL;
+    a->heap = config->heap;
+    a->block_size = config->block_size ? align_up(config->block_size, GPU_ALLOCATOR_GRANULE) : GPU_ALLOCATOR_DEFAULT_BLOCK_SIZE;
+    a->frame_count = config->frame_count < GPU_ALLOCATOR_MAX_FRAMES ? config->frame_count : GPU_ALLOCATOR_MAX_FRAMES;
+    a->free_node_records = NODE_NONE;
+    return a;
+}
+
+void gpu_allocator_destroy(GpuAllocator* allocator) {
+    if (!allocator) return;
+
+    for (size_t i = 0; i < allocator->block_count; ++i) {
+        GpuBlock* block = allocator->blocks[i];
+        if (block->alive) {
+            if (block->allocation_count > 0) {
+                LOG_WARN("GpuAllocator: Block %zu destroyed with %u live allocations", i, block->allocation_count);
+            }
+            allocator->heap.free(allocator->heap.user, block->memory_type, block->memory);
+        }
+        free(block);
+    }
+    for (uint32_t f = 0; f < GPU_ALLOCATOR_MAX_FRAMES; ++f) {
+        FrameArena* frame = &allocator->frames[f];
+        for (size_t i = 0; i < frame->count; ++i) {
+            allocator->heap.free(allocator->heap.user, frame->blocks[i].memory_type, frame->blocks[i].memory);
+        }
+        free(frame->blocks);
+    }
+    free(allocator->blocks);
+    free(allocator->nodes);
+    free(allocator);
+}
+
+bool gpu_allocator_alloc(GpuAllocator* allocator, uint32_t memory_type, uint64_t size, uint64_t alignment,
+                         GpuResourceKind kind, GpuAllocation* out) {
+    if (!allocator || !out || size == 0 || kind >= GPU_RESOURCE_KIND_COUNT) return false;
+    if (alignment & (alignment - 1)) return false; // Not a power of two
+
+    size = align_up(size, GPU_ALLOCATOR_GRANULE);
+    if (alignment < GPU_ALLOCATOR_GRANULE) alignment = GPU_ALLOCATOR_GRANULE;
+
+    // Large resources get a block of their own so they don't fragment the shared ones
+    bool dedicated = size > allocator->block_size / 2;
+    if (!dedicated) {
+        for (size_t i = 0; i < allocator->block_count; ++i) {
+            GpuBlock* block = allocator->blocks[i];
+            if (!block->alive || block->dedicated || block->memory_type != memory_type || block->kind != kind) continue;
+            if (block->size - block->used < size) continue;
+            if (block_place(allocator, block, (uint32_t)i, size, alignment, out)) return true;
+        }
+    }
+
+    // Block memory starts at offset 0, which satisfies any alignment
+    uint32_t index = 0;
+    GpuBlock* block = block_create(allocator, memory_type, kind, dedicated ? size : allocator->block_size, dedicated, &index);
+    if (!block) {
+        LOG_ERROR("GpuAllocator: Out of device memory (type %u, %llu bytes)", memory_type, (unsigned long long)size);
+        return false;
+    }
+    return block_place(allocator, block, index, size, alignment, out);
+}
+
+void gpu_allocator_free(GpuAllocator* allocator, GpuAllocation* allocation) {
+    if (!allocator || !allocation || allocation->block == BLOCK_TRANSIENT || allocation->node == NODE_NONE) return;
+    if (allocation->block >= allocator->block_count) return;
+
+    GpuBlock* block = allocator->blocks[allocation->block];
+    uint32_t index = allocation->node;
+    TlsfNode* node = &allocator->nodes[index];
+    if (!block->alive || node->free) return; // Double free
+
+    block->used -= node->size;
+    block->allocation_count--;
+    allocator->stats.allocation_count--;
+    allocator->stats.bytes_used -= node->size;
+
+    // Coalesce with free physical neighbours
+    uint32_t next = node->next_phys;
+    if (next != NODE_NONE && allocator->nodes[next].free) {
+        free_list_remove(allocator, block, next);
+        node->size += allocator->nodes[next].size;
+        node->next_phys = allocator->nodes[next].next_phys;
+        if (node->next_phys != NODE_NONE) allocator->nodes[node->next_phys].prev_phys = index;
+        node_release(allocator, next);
+    }
+    uint32_t prev = node->prev_phys;
+    if (prev != NODE_NONE && allocator->nodes[prev].free) {
+        free_list_remove(allocator, block, prev);
+        TlsfNode* merged = &allocator->nodes[prev];
+        merged->size += node->size;
+        merged->next_phys = node->next_phys;
+        if (merged->next_phys != NODE_NONE) allocator->nodes[merged->next_phys].prev_phys = prev;
+        node_release(allocator, index);
+        index = prev;
+    }
+    free_list_insert(allocator, block, index);
+
+    allocation->node = NODE_NONE;
+    allocation->mapped = NULL;
+
+    if (block->allocation_count == 0) {
+        // Keep one empty shared block per pool to avoid heap churn
+        bool keep = !block->dedicated;
+        if (keep) {
+            for (size_t i = 0; i < allocator->block_count; ++i) {
+                GpuBlock* other = allocator->blocks[i];
+                if (other != block && other->alive && !other->dedicated &&
+                    other->memory_type == block->memory_type && other->kind == block->kind) {
+                    keep = false;
+                    break;
+                }
+            }
+        }
+        if (!keep) block_release(allocator, allocation->block);
+    }
+}
+
+bool gpu_allocator_alloc_transient(GpuAllocator* allocator, uint32_t frame, uint32_t memory_type,
+                                   uint64_t size, uint64_t alignment, GpuAllocation* out) {
+    if (!allocator || !out || size == 0 || frame >= allocator->frame_count) return false;
+    if (alignment & (alignment - 1)) return false;
+
+    size = align_up(size, GPU_ALLOCATOR_GRANULE);
+    if (alignment < GPU_ALLOCATOR_GRANULE) alignment = GPU_ALLOCATOR_GRANULE;
+
+    FrameArena* arena = &allocator->frames[frame];
+    LinearBlock* target = NULL;
+    uint64_t offset = 0;
+    for (size_t i = 0; i < arena->count; ++i) {
+        LinearBlock* block = &arena->blocks[i];
+        if (block->memory_type != memory_type) continue;
+        offset = align_up(block->used, alignment);
+        if (offset + size <= block->size) {
+            target = block;
+            break;
+        }
+    }
+
+    if (!target) {
+        if (arena->count == arena->capacity) {
+            size_t new_cap = arena->capacity ? arena->capacity * 2 : 4;
+            LinearBlock* blocks = (LinearBlock*)realloc(arena->blocks, new_cap * sizeof(LinearBlock));
+            if (!blocks) return false;
+            arena->blocks = blocks;
+            arena->capacity = new_cap;
+        }
+        uint64_t block_size = size > allocator->block_size ? size : allocator->block_size;
+        LinearBlock block = { .memory_type = memory_type, .size = block_size };
+        if (!allocator->heap.allocate(allocator->heap.user, memory_type, block_size, &block.memory, &block.mapped)) {
+            LOG_ERROR("GpuAllocator: Out of device memory for transient data (%llu bytes)", (unsigned long long)size);
+            return false;
+        }
+        arena->blocks[arena->count] = block;
+        target = &arena->blocks[arena->count++];
+        offset = 0;
+        allocator->stats.block_count++;
+        allocator->stats.bytes_reserved += block_size;
+    }
+
+    target->used = offset + size;
+    out->memory = target->memory;
+    out->offset = offset;
+    out->size = size;
+    out->mapped = target->mapped ? (uint8_t*)target->mapped + offset : NULL;
+    out->memory_type = memory_type;
+    out->block = BLOCK_TRANSIENT;
+    out->node = NODE_NONE;
+    return true;
+}
+
+void gpu_allocator_begin_frame(GpuAllocator* allocator, uint32_t frame) {
+    if (!allocator || frame >= allocator->frame_count) return;
+    FrameArena* arena = &allocator->frames[frame];
+    for (size_t i = 0; i < arena->count; ++i) {
+        arena->blocks[i].used = 0;
+    }
+}
+
+GpuAllocatorStats gpu_allocator_get_stats(const GpuAllocator* allocator) {
+    if (!allocator) {
+        GpuAllocatorStats empty = {0};
+        return empty;
+    }
+    return allocator->stats;
+}
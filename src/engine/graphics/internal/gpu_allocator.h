@@ -0,0 +1,90 @@
+#ifndef GPU_ALLOCATOR_H
+#define GPU_ALLOCATOR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// --- GPU Memory Sub-Allocator ---
+// Places many resources inside a few large device memory blocks per memory type.
+// Blocks come from a GpuHeap (vkAllocateMemory in the Vulkan backend, a fake heap in
+// tests). Placement inside a block is TLSF (two-level segregated fit): O(1) allocate
+// and free, with neighbours coalesced on free. Per-frame transient memory uses a
+// separate bump allocator that is rewound when its frame slot comes around again.
+//
+// bufferImageGranularity: linear resources (buffers) and optimal-tiling images are
+// never placed in the same block, so they can never share a granularity page.
+// Nothing here touches the memory itself, so the allocator is not backend specific.
+// Not thread-safe; the backend serializes access.
+
+#define GPU_ALLOCATOR_MAX_FRAMES 4
+#define GPU_ALLOCATOR_GRANULE 16 // Minimum size and alignment of a placement
+#define GPU_ALLOCATOR_DEFAULT_BLOCK_SIZE ((uint64_t)64 * 1024 * 1024)
+
+typedef enum GpuResourceKind {
+    GPU_RESOURCE_LINEAR = 0, // Buffers
+    GPU_RESOURCE_OPTIMAL,    // Optimal-tiling images
+    GPU_RESOURCE_KIND_COUNT
+} GpuResourceKind;
+
+// Source of device memory blocks.
+typedef struct GpuHeap {
+    void* user;
+    // Allocates one block. out_mapped receives a persistent CPU pointer for host-visible
+    // memory types (NULL otherwise). Returns false when the heap is exhausted.
+    bool (*allocate)(void* user, uint32_t memory_type, uint64_t size, uint64_t* out_memory, void** out_mapped);
+    void (*free)(void* user, uint32_t memory_type, uint64_t memory);
+} GpuHeap;
+
+typedef struct GpuAllocatorConfig {
+    GpuHeap heap;
+    uint64_t block_size;  // 0 = GPU_ALLOCATOR_DEFAULT_BLOCK_SIZE. Larger requests get a dedicated block.
+    uint32_t frame_count; // Transient frame slots, at most GPU_ALLOCATOR_MAX_FRAMES
+} GpuAllocatorConfig;
+
+typedef struct GpuAllocation {
+    uint64_t memory;      // Heap block handle (VkDeviceMemory)
+    uint64_t offset;      // Byte offset inside the block, aligned as requested
+    uint64_t size;        // Requested size rounded up to GPU_ALLOCATOR_GRANULE
+    void* mapped;         // CPU pointer at 'offset' for host-visible memory, else NULL
+    uint32_t memory_type;
+    uint32_t block;       // Internal: owning block (UINT32_MAX for transient memory)
+    uint32_t node;        // Internal: placement record
+} GpuAllocation;
+
+typedef struct GpuAllocatorStats {
+    uint32_t block_count;      // Blocks currently held from the heap (incl. transient)
+    uint32_t allocation_count; // Live placed allocations
+    uint64_t bytes_reserved;   // Sum of block sizes
+    uint64_t bytes_used;       // Sum of live placed allocation sizes
+} GpuAllocatorStats;
+
+typedef struct GpuAllocator GpuAllocator;
+
+GpuAllocator* gpu_allocator_create(const GpuAllocatorConfig* config);
+
+// Returns every block to the heap. Outstanding allocations become invalid.
+void gpu_allocator_destroy(GpuAllocator* allocator);
+
+/**
+ * @brief Places 'size' bytes at a multiple of 'alignment' (a power of two) in a block of
+ * 'memory_type' holding only 'kind' resources. Grows by one heap block when full.
+ * @return false if the heap cannot provide a block.
+ */
+bool gpu_allocator_alloc(GpuAllocator* allocator, uint32_t memory_type, uint64_t size, uint64_t alignment,
+                         GpuResourceKind kind, GpuAllocation* out);
+
+// Releases a placed allocation. Empty blocks go back to the heap, except the last one of a kind.
+void gpu_allocator_free(GpuAllocator* allocator, GpuAllocation* allocation);
+
+// Bump-allocates memory that stays valid until gpu_allocator_begin_frame(frame) runs again.
+// Transient allocations are never freed individually.
+bool gpu_allocator_alloc_transient(GpuAllocator* allocator, uint32_t frame, uint32_t memory_type,
+                                   uint64_t size, uint64_t alignment, GpuAllocation* out);
+
+// Rewinds the transient memory of a frame slot (once the GPU is done with that frame).
+void gpu_allocator_begin_frame(GpuAllocator* allocator, uint32_t frame);
+
+GpuAllocatorStats gpu_allocator_get_stats(const GpuAllocator* allocator);
+
+#endif // GPU_ALLOCATOR_H
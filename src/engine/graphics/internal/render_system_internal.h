@@ -25,10 +25,13 @@ struct RenderSystem {
 
     // Internal State
     PlatformWindow* window;
+    int headless_width, headless_height; // Target size without a window (tracks resizes)
     RendererBackend* backend;
+    JobSystem* jobs; // Not owned
     Stream* gpu_input_stream; 
     
     RenderCommandList cmd_list; 
+    RenderBatchStats batch_stats; // Reset per recorded frame
     
     RenderFramePacket packets[2];
     int front_packet_index;
@@ -36,6 +39,9 @@ struct RenderSystem {
     bool packet_ready;
     Mutex* packet_mutex;
     
+    // Runtime shader compilation (created on first use)
+    ShaderCache* shader_cache;
+
     // Compute Graphs
     ComputeGraph** compute_graphs;
     size_t compute_graph_count;
@@ -61,6 +67,7 @@ struct RenderSystem {
     double current_time;
     
     uint64_t frame_count;
+    uint32_t frame_slot; // From the backend's begin_frame (or frame_count without one)
 };
 
 #endif // RENDER_SYSTEM_INTERNAL_H
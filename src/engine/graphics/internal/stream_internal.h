@@ -15,6 +15,9 @@ struct Stream {
     size_t count;      // Capacity (number of elements)
     size_t element_size;
     size_t total_size; // Total size in bytes (count * element_size)
+
+    bool host_visible; // Set before buffer_create: CPU-writable memory instead of device-local
+    void* mapped;      // Persistent mapping of a host-visible stream (NULL if unsupported)
 };
 
 #endif // STREAM_INTERNAL_H
@@ -54,6 +54,7 @@ typedef struct PipelinePassDef {
     
     // Tags for RenderBatches (e.g., "UIBatches", "SceneBatches")
     char draw_lists[PIPELINE_MAX_TAGS][PIPELINE_MAX_NAME_LENGTH];
+    StringId draw_list_ids[PIPELINE_MAX_TAGS]; // str_id of draw_lists, resolved at load
     uint32_t draw_list_count;
 
     // For Compute: Shader to execute
@@ -1,11 +1,15 @@
 #include "pipeline_loader.h"
 #include "foundation/config/simple_yaml.h"
+#include "foundation/config/config_cache.h"
 #include "foundation/memory/arena.h"
 #include "engine/assets/assets.h"
 #include "foundation/logger/logger.h"
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 
+#define PIPELINE_CACHE_VERSION 1u
+
 static PixelFormat parse_pixel_format(const char* str) {
     if (!str) return PIXEL_FORMAT_UNKNOWN;
     if (strcmp(str, "RGBA8") == 0) return PIXEL_FORMAT_RGBA8_UNORM;
@@ -16,9 +20,53 @@ static PixelFormat parse_pixel_format(const char* str) {
     return PIXEL_FORMAT_UNKNOWN;
 }
 
+// --- Compiled Cache ---
+// PipelineDefinition is plain data, so the cache is a single blob with no relocations.
+
+static uint32_t pipeline_cache_schema(void) {
+    uint32_t schema = config_cache_schema_mix(PIPELINE_CACHE_VERSION, sizeof(PipelineDefinition));
+    schema = config_cache_schema_mix(schema, sizeof(PipelinePassDef));
+    return config_cache_schema_mix(schema, sizeof(PipelineResourceDef));
+}
+
+static bool pipeline_cache_load(const char* full_path, PipelineDefinition* out_def) {
+    char cache_path[512];
+    config_cache_path(full_path, "pipeline", cache_path, sizeof(cache_path));
+
+    MemoryArena arena;
+    if (!arena_init(&arena, sizeof(PipelineDefinition) + 64)) return false;
+
+    const PipelineDefinition* cached = (const PipelineDefinition*)config_cache_load(cache_path, pipeline_cache_schema(), &arena);
+    if (cached) *out_def = *cached;
+
+    arena_destroy(&arena);
+    return cached != NULL;
+}
+
+static void pipeline_cache_store(const char* full_path, const PipelineDefinition* def) {
+    ConfigCacheDependency dep;
+    if (!config_cache_dependency_init(&dep, full_path)) return;
+
+    ConfigCacheWriter w;
+    config_cache_writer_init(&w);
+    size_t root = config_cache_writer_push(&w, def, sizeof(PipelineDefinition), _Alignof(PipelineDefinition));
+
+    char cache_path[512];
+    config_cache_path(full_path, "pipeline", cache_path, sizeof(cache_path));
+    config_cache_write(cache_path, pipeline_cache_schema(), &dep, 1, &w, root);
+    config_cache_writer_free(&w);
+}
+
 bool pipeline_loader_load(Assets* assets, const char* path, PipelineDefinition* out_def) {
     if (!assets || !path || !out_def) return false;
 
+    char full_path[512];
+    snprintf(full_path, sizeof(full_path), "%s/%s", assets_get_root_dir(assets), path);
+    if (pipeline_cache_load(full_path, out_def)) {
+        LOG_INFO("PipelineLoader: Loaded '%s' from cache (%u resources, %u passes)", path, out_def->resource_count, out_def->pass_count);
+        return true;
+    }
+
     AssetData data = assets_load_file(assets, path);
     if (!data.data) {
         LOG_ERROR("PipelineLoader: Failed to load file '%s'", path);
@@ -136,6 +184,9 @@ bool pipeline_loader_load(Assets* assets, const char* path, PipelineDefinition*
                         }
                     }
                 }
+                for (uint32_t j = 0; j < pass_def->draw_list_count; ++j) {
+                    pass_def->draw_list_ids[j] = str_id(pass_def->draw_lists[j]);
+                }
             }
             
             const ConfigNode* shader = config_node_map_get(pass_item, "shader");
@@ -145,6 +196,7 @@ bool pipeline_loader_load(Assets* assets, const char* path, PipelineDefinition*
 
     arena_destroy(&arena);
     assets_free_file(&data);
+    pipeline_cache_store(full_path, out_def);
     LOG_INFO("PipelineLoader: Successfully loaded '%s' (%u resources, %u passes)", path, out_def->resource_count, out_def->pass_count);
     return true;
 }
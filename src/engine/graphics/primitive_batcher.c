@@ -33,7 +33,8 @@ struct PrimitiveBatcher {
     uint32_t index_capacity;
 
     uint32_t pipeline_id; 
-    char tag[32];
+    StringId tag; // Draw list id
+    uint32_t layer_id;
     
     bool is_drawing;
 };
@@ -54,7 +55,8 @@ PrimitiveBatcher* primitive_batcher_create(RenderSystem* rs) {
     batcher->index_stream = stream_create(rs, STREAM_UINT, batcher->index_capacity, sizeof(uint32_t));
     
     batcher->pipeline_id = 0; 
-    memset(batcher->tag, 0, sizeof(batcher->tag));
+    batcher->tag = 0;
+    batcher->layer_id = RENDER_LAYER_WORLD_OVERLAY;
 
     return batcher;
 }
@@ -77,10 +79,14 @@ void primitive_batcher_set_pipeline(PrimitiveBatcher* batcher, uint32_t pipeline
 
 void primitive_batcher_set_tag(PrimitiveBatcher* batcher, const char* tag) {
     if (batcher && tag) {
-        strncpy(batcher->tag, tag, sizeof(batcher->tag) - 1);
+        batcher->tag = str_id(tag);
     }
 }
 
+void primitive_batcher_set_layer(PrimitiveBatcher* batcher, uint32_t layer_id) {
+    if (batcher) batcher->layer_id = layer_id;
+}
+
 void primitive_batcher_begin(PrimitiveBatcher* batcher) {
     if (!batcher) return;
     batcher->vertex_count = 0;
@@ -101,7 +107,8 @@ void primitive_batcher_end(PrimitiveBatcher* batcher, Scene* scene) {
     // 2. Create RenderBatch
     RenderBatch batch = {0};
     batch.pipeline_id = batcher->pipeline_id; 
-    strncpy(batch.draw_list, batcher->tag, sizeof(batch.draw_list) - 1);
+    batch.draw_list_id = batcher->tag;
+    batch.layer_id = batcher->layer_id;
     
     // Use Vertex Pulling: Bind Vertex Buffer as SSBO (Slot 0)
     batch.bind_buffers[0] = batcher->vertex_stream;
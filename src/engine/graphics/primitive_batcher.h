@@ -14,6 +14,8 @@ void primitive_batcher_destroy(PrimitiveBatcher* batcher);
 
 void primitive_batcher_set_pipeline(PrimitiveBatcher* batcher, uint32_t pipeline_id);
 void primitive_batcher_set_tag(PrimitiveBatcher* batcher, const char* tag);
+// Draw layer of the emitted batch (default RENDER_LAYER_WORLD_OVERLAY)
+void primitive_batcher_set_layer(PrimitiveBatcher* batcher, uint32_t layer_id);
 
 void primitive_batcher_begin(PrimitiveBatcher* batcher);
 void primitive_batcher_end(PrimitiveBatcher* batcher, Scene* scene);
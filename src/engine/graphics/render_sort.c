@@ -0,0 +1,178 @@
+#include "engine/graphics/render_sort.h"
+#include "foundation/memory/scratch.h"
+#include <string.h>
+
+#define RENDER_SORT_INSERTION_THRESHOLD 32
+
+// --- Keys ---
+
+static uint32_t hash_mix(uint32_t hash, uint64_t value) {
+    // FNV-1a over the 8 bytes of value
+    for (int i = 0; i < 8; ++i) {
+        hash ^= (uint32_t)(value >> (i * 8)) & 0xFFu;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t bindings_hash(const RenderBatch* batch) {
+    uint32_t hash = 2166136261u;
+    uint32_t count = batch->bind_count < 4 ? batch->bind_count : 4;
+    for (uint32_t b = 0; b < count; ++b) {
+        hash = hash_mix(hash, (uint64_t)(uintptr_t)batch->bind_buffers[b]);
+        hash = hash_mix(hash, batch->bind_slots[b]);
+    }
+    hash = hash_mix(hash, (uint64_t)(uintptr_t)batch->vertex_stream);
+    hash = hash_mix(hash, (uint64_t)(uintptr_t)batch->index_stream);
+    return (hash ^ (hash >> 20)) & 0xFFFFFu;
+}
+
+// Float bits remapped so unsigned comparison matches float order (negatives flipped)
+static uint16_t depth_bits(float depth) {
+    uint32_t bits;
+    memcpy(&bits, &depth, sizeof(bits));
+    bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    return (uint16_t)(bits >> 16);
+}
+
+RenderSortKey render_sort_key(const RenderBatch* batch, uint32_t pass) {
+    uint64_t layer = batch->layer_id < RENDER_SORT_MAX_LAYER ? batch->layer_id : RENDER_SORT_MAX_LAYER;
+    uint64_t key = 0;
+    key |= (uint64_t)(pass < RENDER_SORT_MAX_PASS ? pass : RENDER_SORT_MAX_PASS) << 56;
+    key |= layer << 48;
+    key |= (uint64_t)(batch->pipeline_id & 0xFFFu) << 36;
+    key |= (uint64_t)bindings_hash(batch) << 16;
+    key |= depth_bits(batch->sort_key);
+    return key;
+}
+
+void render_sort_build_keys(const RenderBatch* batches, size_t count, uint32_t pass, RenderSortKey* out_keys) {
+    for (size_t i = 0; i < count; ++i) {
+        out_keys[i] = render_sort_key(&batches[i], pass);
+    }
+}
+
+// --- Sorting ---
+
+static void insertion_sort(const RenderSortKey* keys, size_t count, uint32_t* indices) {
+    for (size_t i = 1; i < count; ++i) {
+        uint32_t idx = indices[i];
+        size_t j = i;
+        // Strict comparison keeps equal keys in push order
+        while (j > 0 && keys[indices[j - 1]] > keys[idx]) {
+            indices[j] = indices[j - 1];
+            --j;
+        }
+        indices[j] = idx;
+    }
+}
+
+void render_sort_indices(const RenderSortKey* keys, size_t count, uint32_t* out_indices) {
+    if (!keys || !out_indices || count == 0) return;
+
+    for (size_t i = 0; i < count; ++i) out_indices[i] = (uint32_t)i;
+    if (count <= RENDER_SORT_INSERTION_THRESHOLD) {
+        insertion_sort(keys, count, out_indices);
+        return;
+    }
+
+    Scratch scratch = scratch_begin(NULL, 0);
+    uint32_t* temp = scratch.arena ? (uint32_t*)arena_alloc(scratch.arena, count * sizeof(uint32_t)) : NULL;
+    if (!temp) {
+        insertion_sort(keys, count, out_indices);
+        scratch_end(scratch);
+        return;
+    }
+
+    // Bytes that are identical in every key contribute nothing; skip their passes
+    RenderSortKey all_or = 0, all_and = ~(RenderSortKey)0;
+    for (size_t i = 0; i < count; ++i) {
+        all_or |= keys[i];
+        all_and &= keys[i];
+    }
+    RenderSortKey varying = all_or ^ all_and;
+
+    uint32_t* src = out_indices;
+    uint32_t* dst = temp;
+    for (uint32_t shift = 0; shift < 64; shift += 8) {
+        if (((varying >> shift) & 0xFFu) == 0) continue;
+
+        size_t offsets[256] = {0};
+        for (size_t i = 0; i < count; ++i) {
+            offsets[(keys[src[i]] >> shift) & 0xFFu]++;
+        }
+        size_t sum = 0;
+        for (int b = 0; b < 256; ++b) {
+            size_t c = offsets[b];
+            offsets[b] = sum;
+            sum += c;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            dst[offsets[(keys[src[i]] >> shift) & 0xFFu]++] = src[i];
+        }
+
+        uint32_t* swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != out_indices) memcpy(out_indices, src, count * sizeof(uint32_t));
+    scratch_end(scratch);
+}
+
+void render_sort_batches(const RenderBatch* batches, size_t count, uint32_t pass, uint32_t* out_indices) {
+    if (!batches || !out_indices || count == 0) return;
+
+    Scratch scratch = scratch_begin(NULL, 0);
+    RenderSortKey* keys = scratch.arena ? (RenderSortKey*)arena_alloc(scratch.arena, count * sizeof(RenderSortKey)) : NULL;
+    if (!keys) {
+        // No scratch memory: keep push order
+        for (size_t i = 0; i < count; ++i) out_indices[i] = (uint32_t)i;
+        scratch_end(scratch);
+        return;
+    }
+
+    render_sort_build_keys(batches, count, pass, keys);
+    render_sort_indices(keys, count, out_indices);
+    scratch_end(scratch);
+}
+
+// --- Merging ---
+
+// Draw recording treats 0 instances as 1
+static uint32_t instance_count_of(const RenderBatch* batch) {
+    return batch->instance_count > 0 ? batch->instance_count : 1;
+}
+
+bool render_batch_can_merge(const RenderBatch* a, const RenderBatch* b) {
+    if (a->pipeline_id != b->pipeline_id || a->draw_list_id != b->draw_list_id || a->layer_id != b->layer_id) return false;
+
+    // Geometry: meshes and per-batch material/instance data are never shared
+    if (a->mesh || b->mesh || a->material_buffer || b->material_buffer) return false;
+    if (a->instance_buffer || b->instance_buffer) return false;
+    if (a->vertex_stream != b->vertex_stream || a->index_stream != b->index_stream) return false;
+    if (a->vertex_count != b->vertex_count || a->index_count != b->index_count) return false;
+
+    if (a->bind_count != b->bind_count) return false;
+    for (uint32_t i = 0; i < a->bind_count && i < 4; ++i) {
+        if (a->bind_buffers[i] != b->bind_buffers[i] || a->bind_slots[i] != b->bind_slots[i]) return false;
+    }
+
+    return (uint64_t)a->first_instance + instance_count_of(a) == b->first_instance;
+}
+
+size_t render_batch_merge(const RenderBatch* batches, const uint32_t* order, size_t count, RenderBatch* out_batches) {
+    if (!batches || !out_batches || count == 0) return 0;
+
+    size_t written = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const RenderBatch* batch = &batches[order ? order[i] : i];
+        if (written > 0 && render_batch_can_merge(&out_batches[written - 1], batch)) {
+            RenderBatch* run = &out_batches[written - 1];
+            run->instance_count = instance_count_of(run) + instance_count_of(batch);
+            continue;
+        }
+        out_batches[written++] = *batch;
+    }
+    return written;
+}
@@ -0,0 +1,48 @@
+#ifndef RENDER_SORT_H
+#define RENDER_SORT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "engine/graphics/graphics_types.h"
+
+// --- Batch Sort Keys ---
+// Batches are executed in ascending key order, most significant field first:
+//   [63..56] pass       Caller-supplied (draw list index within a pipeline pass)
+//   [55..48] layer      RenderBatch.layer_id, clamped to 255
+//   [47..36] pipeline   RenderBatch.pipeline_id
+//   [35..16] bindings   Hash of bound SSBOs and vertex/index streams
+//   [15..0]  depth      RenderBatch.sort_key, order-preserving (smaller first)
+// Only layer_id guarantees draw order across pipelines; producers that rely on
+// painter's order between different states must give them different layers
+// (RENDER_LAYER_* in graphics_types.h). Every draw list is sorted on its own.
+
+typedef uint64_t RenderSortKey;
+
+#define RENDER_SORT_MAX_PASS 0xFFu
+#define RENDER_SORT_MAX_LAYER 0xFFu
+
+RenderSortKey render_sort_key(const RenderBatch* batch, uint32_t pass);
+
+// Fills out_keys[i] = render_sort_key(&batches[i], pass).
+void render_sort_build_keys(const RenderBatch* batches, size_t count, uint32_t pass, RenderSortKey* out_keys);
+
+// Stable LSD radix sort: writes the batch indices 0..count-1 to out_indices in key
+// order, equal keys keeping push order. Bytes shared by every key are skipped.
+void render_sort_indices(const RenderSortKey* keys, size_t count, uint32_t* out_indices);
+
+// Builds keys for one draw list and sorts it. out_indices needs room for 'count' entries.
+void render_sort_batches(const RenderBatch* batches, size_t count, uint32_t pass, uint32_t* out_indices);
+
+// --- Batch Merging ---
+// Two batches merge when they draw the same geometry with identical pipeline, bindings,
+// draw list and layer, and b's instances directly follow a's (a.first_instance +
+// a.instance_count == b.first_instance). The pair becomes one instanced draw.
+
+bool render_batch_can_merge(const RenderBatch* a, const RenderBatch* b);
+
+// Coalesces runs of mergeable batches, visited in 'order' (e.g. from render_sort_batches).
+// out_batches needs room for 'count' entries. Returns the number of draws written.
+size_t render_batch_merge(const RenderBatch* batches, const uint32_t* order, size_t count, RenderBatch* out_batches);
+
+#endif // RENDER_SORT_H
@@ -13,26 +13,22 @@
 #include "foundation/platform/platform.h"
 #include "engine/graphics/internal/backend/renderer_backend.h"
 #include "engine/graphics/internal/backend/vulkan/vulkan_renderer.h"
+#include "engine/graphics/internal/backend/null/null_renderer.h"
 #include "engine/graphics/stream.h"
 #include "engine/graphics/compute_graph.h"
 #include "engine/graphics/pipeline_loader.h"
 #include "engine/scene/render_packet.h"
 #include "engine/graphics/internal/render_system_internal.h"
+#include "engine/graphics/render_sort.h"
+#include "foundation/memory/scratch.h"
+#include "foundation/profiler/profiler.h"
 
 // ... (rest of includes)
 
 static void scene_render_pass(RenderSystem* sys, const PipelinePassDef* pass_def) {
     if (!sys || !pass_def) return;
     
-    Scene* scene = render_system_get_drawing_scene(sys); 
-    if (!scene) return;
-    
-    size_t batch_count = 0;
-    const RenderBatch* batches = scene_get_render_batches(scene, &batch_count);
-    
-    for (uint32_t i = 0; i < pass_def->draw_list_count; ++i) {
-        render_system_execute_batches_with_tag(sys, batches, batch_count, pass_def->draw_lists[i]);
-    }
+    render_system_execute_draw_lists(sys, pass_def);
 }
 
 void scene_renderer_init(RenderSystem* rs) {
@@ -40,6 +36,13 @@ void scene_renderer_init(RenderSystem* rs) {
     render_system_register_pass(rs, "RenderScene", scene_render_pass);
 }
 
+// Framebuffer size, or the configured size when running headless
+static PlatformWindowSize get_target_size(const RenderSystem* sys) {
+    if (sys->window) return platform_get_framebuffer_size(sys->window);
+    PlatformWindowSize size = { .width = sys->headless_width, .height = sys->headless_height };
+    return size;
+}
+
 // Helper to clear existing resources
 static void free_pipeline_resources(RenderSystem* sys) {
     for (int i = 0; i < PIPELINE_MAX_RESOURCES; ++i) {
@@ -62,7 +65,7 @@ static void free_pipeline_resources(RenderSystem* sys) {
 
 // Helper to create resources
 static void create_pipeline_resources(RenderSystem* sys) {
-    PlatformWindowSize size = platform_get_framebuffer_size(sys->window);
+    PlatformWindowSize size = get_target_size(sys);
     
     for (uint32_t i = 0; i < sys->pipeline_def.resource_count; ++i) {
         PipelineResourceDef* res = &sys->pipeline_def.resources[i];
@@ -157,14 +160,14 @@ static void try_bootstrap_renderer(RenderSystem* sys) {
     if (!sys) return;
     if (sys->renderer_ready) return;
     
-    if (!sys->window) return;
     if (!sys->assets) return;
     if (!sys->backend) return;
 
     AssetData vert_shader = assets_load_file(sys->assets, "shaders/ui_default.vert.spv");
     AssetData frag_shader = assets_load_file(sys->assets, "shaders/ui_default.frag.spv");
     
-    if (!vert_shader.data || !frag_shader.data) {
+    // Headless backends present nothing, so unbuilt shaders (e.g. on CI) are not fatal there
+    if ((!vert_shader.data || !frag_shader.data) && sys->window) {
         LOG_ERROR("RenderSystem: Failed to load default shaders from assets.");
         assets_free_file(&vert_shader);
         assets_free_file(&frag_shader);
@@ -179,11 +182,16 @@ static void try_bootstrap_renderer(RenderSystem* sys) {
         .font = assets_get_font(sys->assets),
         .vert_shader = { .data = vert_shader.data, .size = vert_shader.size },
         .frag_shader = { .data = frag_shader.data, .size = frag_shader.size },
+        .jobs = sys->jobs,
     };
 
     sys->renderer_ready = sys->backend->init(sys->backend, &init);
     
     if (sys->renderer_ready) {
+        // Windowed backends size themselves from the surface
+        if (!sys->window && sys->backend->update_viewport) {
+            sys->backend->update_viewport(sys->backend, sys->headless_width, sys->headless_height);
+        }
         if (!sys->gpu_input_stream) {
             sys->gpu_input_stream = stream_create(sys, STREAM_CUSTOM, 1, sizeof(GpuInputState));
             if (sys->gpu_input_stream) stream_bind_compute(sys->gpu_input_stream, 1);
@@ -200,6 +208,9 @@ RenderSystem* render_system_create(const RenderSystemConfig* config) {
     if (!sys) return NULL;
 
     sys->window = config->window;
+    sys->jobs = config->jobs;
+    sys->headless_width = config->width > 0 ? config->width : 1;
+    sys->headless_height = config->height > 0 ? config->height : 1;
     
     sys->packet_mutex = mutex_create();
     sys->back_packet_index = 1;
@@ -212,9 +223,10 @@ RenderSystem* render_system_create(const RenderSystemConfig* config) {
     sys->packets[0].scene = scene_create();
     sys->packets[1].scene = scene_create();
 
-    renderer_backend_register(vulkan_renderer_backend());
+    renderer_backend_register("vulkan", vulkan_renderer_backend);
+    renderer_backend_register("null", null_renderer_backend);
     const char* backend_id = config->backend_type ? config->backend_type : "vulkan";
-    sys->backend = renderer_backend_get(backend_id);
+    sys->backend = renderer_backend_create(backend_id);
     if (!sys->backend) {
         LOG_ERROR("RenderSystem: Failed to load backend '%s'", backend_id);
         scene_destroy(sys->packets[0].scene);
@@ -230,12 +242,16 @@ RenderSystem* render_system_create(const RenderSystemConfig* config) {
 void render_system_destroy(RenderSystem* sys) {
     if (!sys) return;
     
+    // The worker may be inside the backend's compiler
+    shader_cache_destroy(sys->shader_cache);
+
+    // Streams release their buffers through the backend
+    stream_destroy(sys->gpu_input_stream);
+
     if (sys->backend && sys->backend->cleanup) {
         sys->backend->cleanup(sys->backend);
     }
     
-    stream_destroy(sys->gpu_input_stream);
-    
     if (sys->cmd_list.commands) free(sys->cmd_list.commands);
 
     render_packet_free_resources(&sys->packets[0]);
@@ -258,12 +274,18 @@ void render_system_begin_frame(RenderSystem* sys, double time) {
     sys->frame_count++;
     sys->current_time = time;
 
+    if (sys->renderer_ready && sys->backend->begin_frame) {
+        sys->frame_slot = sys->backend->begin_frame(sys->backend);
+    } else {
+        sys->frame_slot = (uint32_t)(sys->frame_count % RENDER_FRAMES_IN_FLIGHT);
+    }
+
     RenderFramePacket* dest = &sys->packets[sys->back_packet_index];
     render_packet_free_resources(dest); // scene_clear
     
     scene_set_frame_number(dest->scene, sys->frame_count);
 
-    PlatformWindowSize size = platform_get_framebuffer_size(sys->window);
+    PlatformWindowSize size = get_target_size(sys);
     float w = (float)size.width;
     float h = (float)size.height;
     if (w < 1.0f) w = 1.0f;
@@ -282,20 +304,28 @@ void render_system_begin_frame(RenderSystem* sys, double time) {
 
 void render_system_update(RenderSystem* sys) {
     if (!sys || !sys->renderer_ready) return;
+    PROFILE_BEGIN("render_system_update");
 
-    // 1. Execute Registered Compute Graphs
+    // 1. Execute Registered Compute Graphs (one compute submit per frame when the backend batches)
     if (sys->compute_graphs) {
+        PROFILE_BEGIN("compute_graphs");
+        RendererBackend* backend = sys->backend;
+        bool batched = backend && backend->compute_begin && backend->compute_end;
+        if (batched) backend->compute_begin(backend);
         for (size_t i = 0; i < sys->compute_graph_count; ++i) {
             ComputeGraph* graph = sys->compute_graphs[i];
             if (graph) {
                 compute_graph_execute(graph, sys);
             }
         }
+        if (batched) backend->compute_end(backend);
+        PROFILE_END();
     }
 
     mutex_lock(sys->packet_mutex);
     sys->packet_ready = true;
     mutex_unlock(sys->packet_mutex);
+    PROFILE_END();
 }
 
 static void cmd_list_add(RenderCommandList* list, RenderCommand cmd) {
@@ -340,156 +370,130 @@ void render_system_register_pass(RenderSystem* sys, const char* name, PipelinePa
     LOG_INFO("RenderSystem: Registered pipeline pass '%s'", name);
 }
 
-void render_system_execute_batches(RenderSystem* sys, const RenderBatch* batches, size_t batch_count) {
-    if (!sys || !batches || batch_count == 0) return;
-
-    uint32_t current_pipeline = (uint32_t)-1;
+// Last state emitted into the command list, so sorted batches skip redundant binds.
+// Buffer bindings are re-emitted after a pipeline change (its layout may differ).
+typedef struct BatchEmitState {
+    uint32_t pipeline;
+    Stream* bound[4];
+} BatchEmitState;
+
+static void emit_batch(RenderSystem* sys, const RenderBatch* batch, BatchEmitState* state) {
+    // 1. Pipeline
+    if (batch->pipeline_id != state->pipeline) {
+         RenderCommand cmd = {0};
+         cmd.type = RENDER_CMD_BIND_PIPELINE;
+         cmd.bind_pipeline.pipeline_id = batch->pipeline_id;
+         cmd_list_add(&sys->cmd_list, cmd);
+         state->pipeline = batch->pipeline_id;
+         memset(state->bound, 0, sizeof(state->bound));
+         sys->batch_stats.pipeline_binds++;
+    }
+    
+    // 2. Custom Bindings
+    for (uint32_t b = 0; b < batch->bind_count && b < 4; ++b) {
+        uint32_t slot = batch->bind_slots[b];
+        if (batch->bind_buffers[b] && (slot >= 4 || state->bound[slot] != batch->bind_buffers[b])) {
+            RenderCommand cmd = {0};
+            cmd.type = RENDER_CMD_BIND_BUFFER;
+            cmd.bind_buffer.slot = slot;
+            cmd.bind_buffer.stream = batch->bind_buffers[b];
+            cmd_list_add(&sys->cmd_list, cmd);
+            if (slot < 4) state->bound[slot] = batch->bind_buffers[b];
+            sys->batch_stats.buffer_binds++;
+        }
+    }
+    
+    // 3. Draw
+    if (batch->vertex_stream) {
+         RenderCommand cmd = {0};
+         cmd.type = RENDER_CMD_BIND_VERTEX_BUFFER;
+         cmd.bind_buffer.stream = batch->vertex_stream;
+         cmd_list_add(&sys->cmd_list, cmd);
+    }
 
-    for (size_t i = 0; i < batch_count; ++i) {
-        const RenderBatch* batch = &batches[i];
-        
-        // 1. Pipeline
-        if (batch->pipeline_id != current_pipeline) {
+    if (batch->index_stream) {
+         RenderCommand cmd = {0};
+         cmd.type = RENDER_CMD_BIND_INDEX_BUFFER;
+         cmd.bind_buffer.stream = batch->index_stream;
+         cmd_list_add(&sys->cmd_list, cmd);
+         
+         RenderCommand draw_cmd = {0};
+         draw_cmd.type = RENDER_CMD_DRAW_INDEXED;
+         draw_cmd.draw_indexed.index_count = batch->index_count;
+         draw_cmd.draw_indexed.instance_count = batch->instance_count > 0 ? batch->instance_count : 1;
+         draw_cmd.draw_indexed.first_instance = batch->first_instance;
+         cmd_list_add(&sys->cmd_list, draw_cmd);
+         sys->batch_stats.draws++;
+    } else if (batch->mesh) {
+        // TODO: Implement Mesh Binding (Vertex Buffers) in Backend or via Commands
+    } else {
+        if (batch->index_count > 0 && !batch->index_stream) {
              RenderCommand cmd = {0};
-             cmd.type = RENDER_CMD_BIND_PIPELINE;
-             cmd.bind_pipeline.pipeline_id = batch->pipeline_id;
+             cmd.type = RENDER_CMD_DRAW_INDEXED;
+             cmd.draw_indexed.index_count = batch->index_count;
+             cmd.draw_indexed.instance_count = batch->instance_count > 0 ? batch->instance_count : 1;
+             cmd.draw_indexed.first_index = 0;
+             cmd.draw_indexed.vertex_offset = 0;
+             cmd.draw_indexed.first_instance = batch->first_instance;
              cmd_list_add(&sys->cmd_list, cmd);
-             current_pipeline = batch->pipeline_id;
-        }
-        
-        // 2. Custom Bindings
-        for (uint32_t b = 0; b < batch->bind_count && b < 4; ++b) {
-            if (batch->bind_buffers[b]) {
-                RenderCommand cmd = {0};
-                cmd.type = RENDER_CMD_BIND_BUFFER;
-                cmd.bind_buffer.slot = batch->bind_slots[b];
-                cmd.bind_buffer.stream = batch->bind_buffers[b];
-                cmd_list_add(&sys->cmd_list, cmd);
-            }
-        }
-        
-        // 3. Draw
-        if (batch->vertex_stream) {
+             sys->batch_stats.draws++;
+        } else {
              RenderCommand cmd = {0};
-             cmd.type = RENDER_CMD_BIND_VERTEX_BUFFER;
-             cmd.bind_buffer.stream = batch->vertex_stream;
+             cmd.type = RENDER_CMD_DRAW;
+             cmd.draw.vertex_count = batch->vertex_count;
+             cmd.draw.instance_count = batch->instance_count > 0 ? batch->instance_count : 1;
+             cmd.draw.first_vertex = 0;
+             cmd.draw.first_instance = batch->first_instance;
              cmd_list_add(&sys->cmd_list, cmd);
+             sys->batch_stats.draws++;
         }
+    }
+}
 
-        if (batch->index_stream) {
-             RenderCommand cmd = {0};
-             cmd.type = RENDER_CMD_BIND_INDEX_BUFFER;
-             cmd.bind_buffer.stream = batch->index_stream;
-             cmd_list_add(&sys->cmd_list, cmd);
-             
-             RenderCommand draw_cmd = {0};
-             draw_cmd.type = RENDER_CMD_DRAW_INDEXED;
-             draw_cmd.draw_indexed.index_count = batch->index_count;
-             draw_cmd.draw_indexed.instance_count = batch->instance_count > 0 ? batch->instance_count : 1;
-             draw_cmd.draw_indexed.first_instance = batch->first_instance;
-             cmd_list_add(&sys->cmd_list, draw_cmd);
-        } else if (batch->mesh) {
-            // TODO: Implement Mesh Binding (Vertex Buffers) in Backend or via Commands
-        } else {
-            if (batch->index_count > 0 && !batch->index_stream) {
-                 RenderCommand cmd = {0};
-                 cmd.type = RENDER_CMD_DRAW_INDEXED;
-                 cmd.draw_indexed.index_count = batch->index_count;
-                 cmd.draw_indexed.instance_count = batch->instance_count > 0 ? batch->instance_count : 1;
-                 cmd.draw_indexed.first_index = 0;
-                 cmd.draw_indexed.vertex_offset = 0;
-                 cmd.draw_indexed.first_instance = batch->first_instance;
-                 cmd_list_add(&sys->cmd_list, cmd);
-            } else {
-                 RenderCommand cmd = {0};
-                 cmd.type = RENDER_CMD_DRAW;
-                 cmd.draw.vertex_count = batch->vertex_count;
-                 cmd.draw.instance_count = batch->instance_count > 0 ? batch->instance_count : 1;
-                 cmd.draw.first_vertex = 0;
-                 cmd.draw.first_instance = batch->first_instance;
-                 cmd_list_add(&sys->cmd_list, cmd);
-            }
+void render_system_execute_batches(RenderSystem* sys, const RenderBatch* batches, size_t batch_count) {
+    if (!sys || !batches || batch_count == 0) return;
+
+    Scratch scratch = scratch_begin(NULL, 0);
+    uint32_t* order = scratch.arena ? (uint32_t*)arena_alloc(scratch.arena, batch_count * sizeof(uint32_t)) : NULL;
+    RenderBatch* merged = scratch.arena ? (RenderBatch*)arena_alloc(scratch.arena, batch_count * sizeof(RenderBatch)) : NULL;
+    BatchEmitState state = { .pipeline = (uint32_t)-1 };
+    sys->batch_stats.batches += (uint32_t)batch_count;
+
+    if (order && merged) {
+        // Sort by state, then fold contiguous instance ranges into single draws
+        render_sort_batches(batches, batch_count, 0, order);
+        size_t draw_count = render_batch_merge(batches, order, batch_count, merged);
+        sys->batch_stats.merged += (uint32_t)(batch_count - draw_count);
+        for (size_t i = 0; i < draw_count; ++i) {
+            emit_batch(sys, &merged[i], &state);
+        }
+    } else {
+        for (size_t i = 0; i < batch_count; ++i) {
+            emit_batch(sys, &batches[i], &state);
         }
     }
+    scratch_end(scratch);
 }
 
-void render_system_execute_batches_with_tag(RenderSystem* sys, const RenderBatch* batches, size_t batch_count, const char* tag) {
-    if (!sys || !batches || batch_count == 0 || !tag) return;
-
-    uint32_t current_pipeline = (uint32_t)-1;
+void render_system_execute_draw_lists(RenderSystem* sys, const PipelinePassDef* pass_def) {
+    if (!sys || !pass_def) return;
 
-    for (size_t i = 0; i < batch_count; ++i) {
-        const RenderBatch* batch = &batches[i];
-        
-        // Tag filter
-        if (tag[0] != '\0' && strcmp(batch->draw_list, tag) != 0) {
-            continue;
-        }
+    Scene* scene = render_system_get_drawing_scene(sys);
+    if (!scene) return;
 
-        // 1. Pipeline
-        if (batch->pipeline_id != current_pipeline) {
-             RenderCommand cmd = {0};
-             cmd.type = RENDER_CMD_BIND_PIPELINE;
-             cmd.bind_pipeline.pipeline_id = batch->pipeline_id;
-             cmd_list_add(&sys->cmd_list, cmd);
-             current_pipeline = batch->pipeline_id;
-        }
-        
-        // 2. Custom Bindings
-        for (uint32_t b = 0; b < batch->bind_count && b < 4; ++b) {
-            if (batch->bind_buffers[b]) {
-                RenderCommand cmd = {0};
-                cmd.type = RENDER_CMD_BIND_BUFFER;
-                cmd.bind_buffer.slot = batch->bind_slots[b];
-                cmd.bind_buffer.stream = batch->bind_buffers[b];
-                cmd_list_add(&sys->cmd_list, cmd);
-            }
-        }
-        
-        // 3. Draw
-        if (batch->vertex_stream) {
-             RenderCommand cmd = {0};
-             cmd.type = RENDER_CMD_BIND_VERTEX_BUFFER;
-             cmd.bind_buffer.stream = batch->vertex_stream;
-             cmd_list_add(&sys->cmd_list, cmd);
-        }
+    for (uint32_t i = 0; i < pass_def->draw_list_count; ++i) {
+        size_t batch_count = 0;
+        const RenderBatch* batches = scene_get_draw_list(scene, pass_def->draw_list_ids[i], &batch_count);
+        render_system_execute_batches(sys, batches, batch_count);
+    }
+}
 
-        if (batch->index_stream) {
-             RenderCommand cmd = {0};
-             cmd.type = RENDER_CMD_BIND_INDEX_BUFFER;
-             cmd.bind_buffer.stream = batch->index_stream;
-             cmd_list_add(&sys->cmd_list, cmd);
-             
-             RenderCommand draw_cmd = {0};
-             draw_cmd.type = RENDER_CMD_DRAW_INDEXED;
-             draw_cmd.draw_indexed.index_count = batch->index_count;
-             draw_cmd.draw_indexed.instance_count = batch->instance_count > 0 ? batch->instance_count : 1;
-             draw_cmd.draw_indexed.first_instance = batch->first_instance;
-             cmd_list_add(&sys->cmd_list, draw_cmd);
-        } else if (batch->mesh) {
-            // TODO: Implement Mesh Binding (Vertex Buffers) in Backend or via Commands
-        } else {
-            if (batch->index_count > 0 && !batch->index_stream) {
-                 RenderCommand cmd = {0};
-                 cmd.type = RENDER_CMD_DRAW_INDEXED;
-                 cmd.draw_indexed.index_count = batch->index_count;
-                 cmd.draw_indexed.instance_count = batch->instance_count > 0 ? batch->instance_count : 1;
-                 cmd.draw_indexed.first_index = 0;
-                 cmd.draw_indexed.vertex_offset = 0;
-                                  cmd.draw_indexed.first_instance = batch->first_instance;
-                                  cmd_list_add(&sys->cmd_list, cmd);
-                             }
-                  else {
-                 RenderCommand cmd = {0};
-                 cmd.type = RENDER_CMD_DRAW;
-                 cmd.draw.vertex_count = batch->vertex_count;
-                 cmd.draw.instance_count = batch->instance_count > 0 ? batch->instance_count : 1;
-                 cmd.draw.first_vertex = 0;
-                 cmd.draw.first_instance = batch->first_instance;
-                 cmd_list_add(&sys->cmd_list, cmd);
-            }
-        }
+RenderBatchStats render_system_get_batch_stats(const RenderSystem* sys) {
+    if (!sys) {
+        RenderBatchStats empty = {0};
+        return empty;
     }
+    return sys->batch_stats;
 }
 
 static uint32_t render_system_resolve_resource(RenderSystem* sys, const char* name) {
@@ -521,6 +525,7 @@ void render_system_draw(RenderSystem* sys) {
     
     // Reset Command List
     sys->cmd_list.count = 0;
+    memset(&sys->batch_stats, 0, sizeof(sys->batch_stats));
     
     // Calculate ViewProj
     SceneCamera cam = scene_get_camera(scene);
@@ -538,9 +543,12 @@ void render_system_draw(RenderSystem* sys) {
     // If we have no pipeline defined yet, fall back to old monolithic behavior
     if (sys->pipeline_def.pass_count == 0) {
         // Monolithic: Assume swapchain and no clearing (handled by backend usually)
-        size_t batch_count = 0;
-        const RenderBatch* batches = scene_get_render_batches(scene, &batch_count);
-        render_system_execute_batches(sys, batches, batch_count);
+        size_t list_count = scene_get_draw_list_count(scene);
+        for (size_t i = 0; i < list_count; ++i) {
+            size_t batch_count = 0;
+            const RenderBatch* batches = scene_get_draw_list_at(scene, i, NULL, &batch_count);
+            render_system_execute_batches(sys, batches, batch_count);
+        }
     } else {
         // Execute via Pipeline Definition
         for (uint32_t i = 0; i < sys->pipeline_def.pass_count; ++i) {
@@ -586,12 +594,18 @@ void render_system_draw(RenderSystem* sys) {
     }
     
     // Submit
+    PROFILE_BEGIN("backend_submit");
     sys->backend->submit_commands(sys->backend, &sys->cmd_list);
+    PROFILE_END();
 }
 
 
 void render_system_resize(RenderSystem* sys, int width, int height) {
     if (!sys) return;
+    if (!sys->window) {
+        sys->headless_width = width;
+        sys->headless_height = height;
+    }
     
     // Resize backend (swapchain)
     if (sys->backend && sys->backend->update_viewport) {
@@ -644,30 +658,98 @@ uint32_t render_system_create_compute_pipeline(RenderSystem* sys, uint32_t* spv_
     return sys->backend->compute_pipeline_create(sys->backend, spv_code, spv_size, layouts, 2);
 }
 
-uint32_t render_system_create_compute_pipeline_from_source(RenderSystem* sys, const char* source) {
-    if (!sys || !sys->backend) return 0;
-    
-    // 1. Compile
-    void* spv_code = NULL;
-    size_t spv_size = 0;
-    
+static bool backend_compile_shader(void* user, const char* source, size_t size, const char* stage,
+                                   void** out_spv, size_t* out_spv_size, ShaderDiagnostics* diagnostics) {
+    RendererBackend* backend = (RendererBackend*)user;
+    return backend->compile_shader(backend, source, size, stage, out_spv, out_spv_size, diagnostics);
+}
+
+// The backend logs a failure when it compiles; this repeats it for sources that failed earlier
+static void log_cached_failure(ShaderCache* cache, uint64_t key) {
+    ShaderDiagnostics diagnostics;
+    const ShaderDiagnostic* first = NULL;
+    if (shader_cache_get_diagnostics(cache, key, &diagnostics)) first = shader_diagnostics_first_error(&diagnostics);
+    if (!first) {
+        LOG_ERROR("Shader compilation failed.");
+        return;
+    }
+    LOG_ERROR("Shader compilation failed (%u errors). Line %u: %s", diagnostics.error_count, first->line, first->message);
+}
+
+static ShaderCache* get_shader_cache(RenderSystem* sys) {
+    if (sys->shader_cache) return sys->shader_cache;
     if (!sys->backend->compile_shader) {
         LOG_ERROR("Backend does not support runtime shader compilation.");
-        return 0;
+        return NULL;
     }
+    ShaderCacheConfig config = {
+        .directory = SHADER_CACHE_DIR,
+        .compile = backend_compile_shader,
+        .user = sys->backend,
+        .worker_count = 2, // Keeps one compile going while a large graph is still compiling
+    };
+    sys->shader_cache = shader_cache_create(&config);
+    return sys->shader_cache;
+}
+
+// Creates a pipeline from the SPIR-V of a resolved key (borrowed from the cache)
+static uint32_t create_compute_pipeline_from_cache(RenderSystem* sys, uint64_t key) {
+    const void* spv_code = NULL;
+    size_t spv_size = 0;
+    if (!shader_cache_get(sys->shader_cache, key, &spv_code, &spv_size)) return 0;
+    uint32_t pipeline = render_system_create_compute_pipeline(sys, (uint32_t*)spv_code, spv_size);
+    shader_cache_release(sys->shader_cache, key);
+    return pipeline;
+}
+
+uint32_t render_system_create_compute_pipeline_from_source(RenderSystem* sys, const char* source) {
+    if (!sys || !sys->backend || !source) return 0;
     
-    if (!sys->backend->compile_shader(sys->backend, source, strlen(source), "compute", &spv_code, &spv_size)) {
-        LOG_ERROR("Shader compilation failed.");
+    // 1. Compile (or hit the cache)
+    ShaderCache* cache = get_shader_cache(sys);
+    if (!cache) return 0;
+
+    uint64_t key = 0;
+    ShaderCacheStatus status = shader_cache_request(cache, source, strlen(source), "compute", NULL, &key);
+    if (status == SHADER_CACHE_PENDING) status = shader_cache_wait(cache, key);
+    if (status != SHADER_CACHE_READY) {
+        log_cached_failure(cache, key);
         return 0;
     }
     
     // 2. Create Pipeline
-    uint32_t id = render_system_create_compute_pipeline(sys, (uint32_t*)spv_code, spv_size);
-    
-    // 3. Free SPIR-V
-    free(spv_code);
-    
-    return id;
+    return create_compute_pipeline_from_cache(sys, key);
+}
+
+uint64_t render_system_request_compute_pipeline(RenderSystem* sys, const char* source) {
+    if (!sys || !sys->backend || !source) return 0;
+    ShaderCache* cache = get_shader_cache(sys);
+    if (!cache) return 0;
+
+    uint64_t key = 0;
+    ShaderCacheStatus status = shader_cache_request(cache, source, strlen(source), "compute", NULL, &key);
+    if (status == SHADER_CACHE_FAILED) {
+        log_cached_failure(cache, key);
+        return 0;
+    }
+    return key;
+}
+
+ShaderCacheStatus render_system_poll_compute_pipeline(RenderSystem* sys, uint64_t ticket, uint32_t* out_pipeline) {
+    if (out_pipeline) *out_pipeline = 0;
+    if (!sys || !sys->shader_cache || ticket == 0) return SHADER_CACHE_FAILED;
+
+    ShaderCacheStatus status = shader_cache_poll(sys->shader_cache, ticket);
+    if (status != SHADER_CACHE_READY) return status;
+
+    uint32_t pipeline = create_compute_pipeline_from_cache(sys, ticket);
+    if (out_pipeline) *out_pipeline = pipeline;
+    return pipeline ? SHADER_CACHE_READY : SHADER_CACHE_FAILED;
+}
+
+bool render_system_get_compute_diagnostics(RenderSystem* sys, uint64_t ticket, ShaderDiagnostics* out) {
+    if (!sys || !sys->shader_cache || ticket == 0) return false;
+    return shader_cache_get_diagnostics(sys->shader_cache, ticket, out);
 }
 
 void render_system_destroy_compute_pipeline(RenderSystem* sys, uint32_t pipeline_id) {
@@ -675,6 +757,15 @@ void render_system_destroy_compute_pipeline(RenderSystem* sys, uint32_t pipeline
     sys->backend->compute_pipeline_destroy(sys->backend, pipeline_id);
 }
 
+bool render_system_supports_cpu_compute(RenderSystem* sys) {
+    return sys && sys->backend && sys->backend->compute_pipeline_create_cpu;
+}
+
+uint32_t render_system_create_cpu_compute_pipeline(RenderSystem* sys, const CpuComputeKernel* kernel) {
+    if (!render_system_supports_cpu_compute(sys) || !kernel) return 0;
+    return sys->backend->compute_pipeline_create_cpu(sys->backend, kernel);
+}
+
 uint32_t render_system_create_graphics_pipeline(RenderSystem* sys, const void* vert_code, size_t vert_size, const void* frag_code, size_t frag_size, int layout_index) {
     if (!sys || !sys->backend || !sys->backend->graphics_pipeline_create) return 0;
     
@@ -716,6 +807,7 @@ void render_system_request_screenshot(RenderSystem* sys, const char* filepath) {
 
 double render_system_get_time(RenderSystem* sys) { return sys ? sys->current_time : 0.0; }
 uint64_t render_system_get_frame_count(RenderSystem* sys) { return sys ? sys->frame_count : 0; }
+uint32_t render_system_get_frame_slot(RenderSystem* sys) { return sys ? sys->frame_slot : 0; }
 bool render_system_is_ready(RenderSystem* sys) { return sys ? sys->renderer_ready : false; }
 
 RendererBackend* render_system_get_backend(RenderSystem* sys) {
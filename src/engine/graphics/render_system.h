@@ -6,6 +6,7 @@
 #include <stddef.h>
 #include "engine/graphics/graphics_types.h"
 #include "engine/graphics/gpu_input.h" // Added for GpuInputState
+#include "engine/graphics/shader_cache.h"
 
 typedef struct RenderSystem RenderSystem;
 typedef struct RenderFramePacket RenderFramePacket;
@@ -17,12 +18,20 @@ typedef struct Scene Scene;
 typedef struct RendererBackend RendererBackend; // Forward declaration
 typedef struct ComputeGraph ComputeGraph;
 typedef struct PipelinePassDef PipelinePassDef;
+typedef struct CpuComputeKernel CpuComputeKernel;
+typedef struct JobSystem JobSystem;
+
+// Frames the CPU may record ahead of the GPU. Per-frame CPU-written GPU data
+// (instance rings, staging) needs this many copies.
+#define RENDER_FRAMES_IN_FLIGHT 2
 
 typedef void (*PipelinePassCallback)(RenderSystem* sys, const PipelinePassDef* pass_def);
 
 typedef struct RenderSystemConfig {
-    PlatformWindow* window;
-    const char* backend_type; // "vulkan"
+    PlatformWindow* window;   // NULL = headless (needs a backend without a surface, e.g. "null")
+    const char* backend_type; // "vulkan" (default), "null"
+    int width, height;        // Render target size when there is no window
+    JobSystem* jobs;          // Optional worker pool for CPU-side backend work; must outlive the system
 } RenderSystemConfig;
 
 RenderSystem* render_system_create(const RenderSystemConfig* config);
@@ -34,9 +43,15 @@ void render_system_bind_assets(RenderSystem* sys, Assets* assets);
 // Updates the render system (Syncs logic to render packet)
 void render_system_update(RenderSystem* sys);
 
-// Begins a new frame (updates time and frame count, clears scene)
+// Begins a new frame (updates time and frame count, clears scene). Blocks until the GPU
+// has finished the frame that last used this frame's slot.
 void render_system_begin_frame(RenderSystem* sys, double time);
 
+// Frame slot in [0, RENDER_FRAMES_IN_FLIGHT) of the frame being prepared. Per-frame data
+// in persistently mapped buffers is safe to write in this slot's region after
+// render_system_begin_frame.
+uint32_t render_system_get_frame_slot(RenderSystem* sys);
+
 // Gets the current mutable scene for the frame being prepared
 Scene* render_system_get_scene(RenderSystem* sys);
 
@@ -54,15 +69,43 @@ void render_system_set_pipeline(RenderSystem* sys, const char* path);
 // --- Pipeline Pass Registry ---
 void render_system_register_pass(RenderSystem* sys, const char* name, PipelinePassCallback callback);
 
-// Helper for pass callbacks to execute a filtered list of batches
+// Helper for pass callbacks: sorts the batches by state (render_sort.h) and records them
 void render_system_execute_batches(RenderSystem* sys, const RenderBatch* batches, size_t batch_count);
-void render_system_execute_batches_with_tag(RenderSystem* sys, const RenderBatch* batches, size_t batch_count, const char* tag);
+
+// Executes the drawing scene's buckets for each of the pass's draw lists
+void render_system_execute_draw_lists(RenderSystem* sys, const PipelinePassDef* pass_def);
+
+// Counters of the last recorded frame (render_system_draw).
+typedef struct RenderBatchStats {
+    uint32_t batches;        // Batches submitted for execution
+    uint32_t draws;          // Draw commands recorded after merging
+    uint32_t merged;         // Batches folded into a preceding instanced draw
+    uint32_t pipeline_binds;
+    uint32_t buffer_binds;
+} RenderBatchStats;
+
+RenderBatchStats render_system_get_batch_stats(const RenderSystem* sys);
 
 uint32_t render_system_create_compute_pipeline(RenderSystem* sys, uint32_t* spv_code, size_t spv_size);
-// Compiles GLSL (if supported by backend) and creates pipeline
+// Compiles GLSL (if supported by backend) and creates pipeline. Blocks on a cache miss.
 uint32_t render_system_create_compute_pipeline_from_source(RenderSystem* sys, const char* source);
+
+// Non-blocking variant: a cache miss compiles on a background thread (shader_cache.h).
+// Returns a ticket for render_system_poll_compute_pipeline, 0 on failure.
+uint64_t render_system_request_compute_pipeline(RenderSystem* sys, const char* source);
+
+// PENDING while compiling. On READY, *out_pipeline is a new pipeline owned by the caller;
+// every READY poll creates one, so stop polling the ticket after it resolves.
+ShaderCacheStatus render_system_poll_compute_pipeline(RenderSystem* sys, uint64_t ticket, uint32_t* out_pipeline);
+// Compiler errors (or warnings) of a resolved ticket. False if the compiler reported none.
+bool render_system_get_compute_diagnostics(RenderSystem* sys, uint64_t ticket, ShaderDiagnostics* out);
 void render_system_destroy_compute_pipeline(RenderSystem* sys, uint32_t pipeline_id);
 
+// CPU kernels (cpu_compute.h) for backends without a GPU, e.g. the headless "null" backend.
+bool render_system_supports_cpu_compute(RenderSystem* sys);
+// Returns 0 if unsupported or on failure; the caller then still owns the kernel.
+uint32_t render_system_create_cpu_compute_pipeline(RenderSystem* sys, const CpuComputeKernel* kernel);
+
 // Registers a Compute Graph for automatic execution each frame
 void render_system_register_compute_graph(RenderSystem* sys, ComputeGraph* graph);
 void render_system_unregister_compute_graph(RenderSystem* sys, ComputeGraph* graph);
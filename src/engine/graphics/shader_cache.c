@@ -0,0 +1,606 @@
+#include "engine/graphics/shader_cache.h"
+#include "foundation/config/config_cache.h"
+#include "foundation/platform/fs.h"
+#include "foundation/thread/thread.h"
+#include "foundation/logger/logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Bump to orphan every on-disk entry (e.g. when compiler flags change)
+#define SHADER_CACHE_VERSION 1ull
+#define SPIRV_MAGIC 0x07230203u
+
+// Open addressing at <= 50% load, probed linearly from the low bits of the key
+#define ENTRY_TABLE_MIN_SIZE 64
+
+typedef struct ShaderCacheEntry {
+    bool used;
+    uint64_t key;
+    ShaderCacheStatus status;
+    void* spv;
+    size_t spv_size;
+    ShaderDiagnostics* diagnostics; // NULL when the compiler had nothing to say
+    uint32_t borrows;               // shader_cache_get calls not yet released; pins the entry
+    uint64_t last_use;              // Cache clock at the last request, poll or get
+} ShaderCacheEntry;
+
+typedef struct ShaderCompileJob {
+    uint64_t key;
+    char* source; // Defines already merged in
+    size_t size;
+    char stage[16];
+} ShaderCompileJob;
+
+struct ShaderCache {
+    ShaderCompileFunc compile;
+    void* user;
+    char directory[256]; // Empty = memory only
+
+    Mutex* mutex;
+    ConditionVariable* cond; // Signaled when a job is queued or an entry resolves
+
+    ShaderCacheEntry* table; // Power-of-two size, moves when it grows
+    size_t table_size;
+    size_t entry_count;
+    uint32_t max_entries;
+    uint64_t clock;
+
+    ShaderCompileJob* jobs; // FIFO, jobs[0] runs next
+    size_t job_count;
+    size_t job_capacity;
+
+    Thread* workers[SHADER_CACHE_MAX_WORKERS];
+    uint32_t worker_count; // 0 = compile on the calling thread
+    bool running;
+
+    ShaderCacheStats stats;
+};
+
+// --- Helpers ---
+
+// Inserts the defines after the #version line (GLSL requires it first), or at the top.
+static char* merge_defines(const char* source, size_t size, const char* defines, size_t* out_size) {
+    size_t defines_len = defines ? strlen(defines) : 0;
+    char* merged = malloc(size + defines_len + 2);
+    if (!merged) return NULL;
+
+    size_t split = 0;
+    if (defines_len > 0 && size >= 8 && strncmp(source, "#version", 8) == 0) {
+        while (split < size && source[split] != '\n') split++;
+        if (split < size) split++;
+    }
+
+    size_t n = 0;
+    memcpy(merged, source, split);
+    n += split;
+    if (defines_len > 0) {
+        memcpy(merged + n, defines, defines_len);
+        n += defines_len;
+        if (defines[defines_len - 1] != '\n') merged[n++] = '\n';
+    }
+    memcpy(merged + n, source + split, size - split);
+    n += size - split;
+    merged[n] = '\0';
+    *out_size = n;
+    return merged;
+}
+
+static uint64_t hash_merged(const char* merged, size_t size, const char* stage) {
+    uint64_t key = config_cache_hash(merged, size);
+    uint64_t salt[2] = { config_cache_hash(stage, strlen(stage)), SHADER_CACHE_VERSION };
+    return key ^ config_cache_hash(salt, sizeof(salt));
+}
+
+static void entry_path(const ShaderCache* cache, uint64_t key, char* out, size_t out_size) {
+    snprintf(out, out_size, "%s/%016llx.spv", cache->directory, (unsigned long long)key);
+}
+
+// Creates every component of a relative path
+static void make_dirs(const char* path) {
+    char partial[256];
+    size_t len = strlen(path);
+    if (len >= sizeof(partial)) return;
+    for (size_t i = 1; i <= len; ++i) {
+        if (path[i] == '/' || path[i] == '\0') {
+            memcpy(partial, path, i);
+            partial[i] = '\0';
+            platform_mkdir(partial);
+        }
+    }
+}
+
+static bool is_spirv(const void* data, size_t size) {
+    if (size < 20 || size % 4 != 0) return false; // Header is 5 words
+    uint32_t magic;
+    memcpy(&magic, data, sizeof(magic));
+    return magic == SPIRV_MAGIC;
+}
+
+// --- Entry Table ---
+// Every function here expects the mutex held. Entry pointers are only valid until the
+// next add_entry, which may grow the table or evict.
+
+static size_t home_slot(const ShaderCache* cache, uint64_t key) {
+    return (size_t)(key ^ (key >> 32)) & (cache->table_size - 1);
+}
+
+static ShaderCacheEntry* find_entry(ShaderCache* cache, uint64_t key) {
+    if (cache->table_size == 0) return NULL;
+    size_t mask = cache->table_size - 1;
+    for (size_t i = home_slot(cache, key);; i = (i + 1) & mask) {
+        ShaderCacheEntry* entry = &cache->table[i];
+        if (!entry->used) return NULL;
+        if (entry->key == key) return entry;
+    }
+}
+
+static void touch_entry(ShaderCache* cache, ShaderCacheEntry* entry) {
+    entry->last_use = ++cache->clock;
+}
+
+static ShaderCacheEntry* insert_slot(ShaderCache* cache, uint64_t key) {
+    size_t mask = cache->table_size - 1;
+    size_t i = home_slot(cache, key);
+    while (cache->table[i].used) i = (i + 1) & mask;
+    return &cache->table[i];
+}
+
+static bool grow_table(ShaderCache* cache) {
+    size_t new_size = cache->table_size ? cache->table_size * 2 : ENTRY_TABLE_MIN_SIZE;
+    ShaderCacheEntry* table = calloc(new_size, sizeof(ShaderCacheEntry));
+    if (!table) return false;
+
+    ShaderCacheEntry* old = cache->table;
+    size_t old_size = cache->table_size;
+    cache->table = table;
+    cache->table_size = new_size;
+    for (size_t i = 0; i < old_size; ++i) {
+        if (old[i].used) *insert_slot(cache, old[i].key) = old[i];
+    }
+    free(old);
+    return true;
+}
+
+// Frees the entry and shifts later members of its probe chain back into the hole, so
+// lookups never need tombstones
+static void remove_entry(ShaderCache* cache, ShaderCacheEntry* entry) {
+    free(entry->spv);
+    free(entry->diagnostics);
+
+    size_t mask = cache->table_size - 1;
+    size_t hole = (size_t)(entry - cache->table);
+    for (size_t i = (hole + 1) & mask; cache->table[i].used; i = (i + 1) & mask) {
+        // Movable if the hole lies on its probe path (between its home slot and i)
+        size_t home = home_slot(cache, cache->table[i].key);
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            cache->table[hole] = cache->table[i];
+            hole = i;
+        }
+    }
+    memset(&cache->table[hole], 0, sizeof(ShaderCacheEntry));
+    cache->entry_count--;
+}
+
+// Drops least recently used resolved entries until one more fits under max_entries.
+// Runs only on a miss, so the scan stays off the hit path.
+static void evict_entries(ShaderCache* cache) {
+    while (cache->entry_count >= cache->max_entries) {
+        ShaderCacheEntry* oldest = NULL;
+        for (size_t i = 0; i < cache->table_size; ++i) {
+            ShaderCacheEntry* entry = &cache->table[i];
+            if (!entry->used || entry->status == SHADER_CACHE_PENDING || entry->borrows > 0) continue;
+            if (!oldest || entry->last_use < oldest->last_use) oldest = entry;
+        }
+        if (!oldest) return; // Everything is pending or borrowed
+        remove_entry(cache, oldest);
+        cache->stats.evictions++;
+    }
+}
+
+static ShaderCacheEntry* add_entry(ShaderCache* cache, uint64_t key, ShaderCacheStatus status) {
+    evict_entries(cache);
+    if ((cache->entry_count + 1) * 2 > cache->table_size && !grow_table(cache)) return NULL;
+
+    ShaderCacheEntry* entry = insert_slot(cache, key);
+    memset(entry, 0, sizeof(*entry));
+    entry->used = true;
+    entry->key = key;
+    entry->status = status;
+    touch_entry(cache, entry);
+    cache->entry_count++;
+    return entry;
+}
+
+// Runs one job outside the lock and publishes the result
+static void run_job(ShaderCache* cache, ShaderCompileJob* job) {
+    void* spv = NULL;
+    size_t spv_size = 0;
+    ShaderDiagnostics* diagnostics = calloc(1, sizeof(ShaderDiagnostics));
+    ShaderDiagnostics discarded;
+    memset(&discarded, 0, sizeof(discarded));
+    bool ok = cache->compile(cache->user, job->source, job->size, job->stage, &spv, &spv_size,
+                             diagnostics ? diagnostics : &discarded);
+    if (diagnostics && diagnostics->error_count == 0 && diagnostics->warning_count == 0) {
+        free(diagnostics);
+        diagnostics = NULL;
+    }
+    if (ok && !is_spirv(spv, spv_size)) {
+        LOG_ERROR("ShaderCache: Compiler returned invalid SPIR-V (%zu bytes)", spv_size);
+        free(spv);
+        spv = NULL;
+        ok = false;
+    }
+
+    if (ok && cache->directory[0]) {
+        char path[320];
+        entry_path(cache, job->key, path, sizeof(path));
+        make_dirs(cache->directory);
+        if (!fs_write_bin(path, spv, spv_size)) {
+            LOG_WARN("ShaderCache: Failed to write %s", path);
+        }
+    }
+
+    mutex_lock(cache->mutex);
+    ShaderCacheEntry* entry = find_entry(cache, job->key);
+    if (entry) {
+        entry->status = ok ? SHADER_CACHE_READY : SHADER_CACHE_FAILED;
+        entry->spv = spv;
+        entry->spv_size = spv_size;
+        entry->diagnostics = diagnostics;
+    } else {
+        free(spv);
+        free(diagnostics);
+    }
+    cache->stats.compiles++;
+    if (!ok) cache->stats.failures++;
+    condvar_broadcast(cache->cond);
+    mutex_unlock(cache->mutex);
+
+    free(job->source);
+    job->source = NULL;
+}
+
+static int worker_main(void* arg) {
+    ShaderCache* cache = (ShaderCache*)arg;
+    mutex_lock(cache->mutex);
+    for (;;) {
+        while (cache->running && cache->job_count == 0) {
+            condvar_wait(cache->cond, cache->mutex);
+        }
+        if (!cache->running) break;
+
+        ShaderCompileJob job = cache->jobs[0];
+        cache->job_count--;
+        memmove(cache->jobs, cache->jobs + 1, cache->job_count * sizeof(ShaderCompileJob));
+        mutex_unlock(cache->mutex);
+
+        LOG_DEBUG("ShaderCache: Compiling %016llx (%s, %zu bytes)", (unsigned long long)job.key, job.stage, job.size);
+        run_job(cache, &job);
+
+        mutex_lock(cache->mutex);
+    }
+    mutex_unlock(cache->mutex);
+    return 0;
+}
+
+// --- API ---
+
+ShaderCache* shader_cache_create(const ShaderCacheConfig* config) {
+    if (!config || !config->compile) return NULL;
+    ShaderCache* cache = calloc(1, sizeof(ShaderCache));
+    if (!cache) return NULL;
+
+    cache->compile = config->compile;
+    cache->user = config->user;
+    cache->max_entries = config->max_entries ? config->max_entries : SHADER_CACHE_DEFAULT_MAX_ENTRIES;
+    if (config->directory) {
+        snprintf(cache->directory, sizeof(cache->directory), "%s", config->directory);
+    }
+
+    cache->mutex = mutex_create();
+    cache->cond = condvar_create();
+    if (!cache->mutex || !cache->cond) {
+        if (cache->mutex) mutex_destroy(cache->mutex);
+        if (cache->cond) condvar_destroy(cache->cond);
+        free(cache);
+        return NULL;
+    }
+
+    uint32_t wanted = config->worker_count;
+    if (wanted == 0) wanted = 1;
+    if (wanted > SHADER_CACHE_MAX_WORKERS) wanted = SHADER_CACHE_MAX_WORKERS;
+
+    cache->running = true;
+    for (uint32_t i = 0; i < wanted; ++i) {
+        Thread* worker = thread_create(worker_main, cache);
+        if (!worker) break;
+        cache->workers[cache->worker_count++] = worker;
+    }
+    if (cache->worker_count == 0) {
+        LOG_WARN("ShaderCache: No worker thread, compiling on the calling thread");
+    }
+    return cache;
+}
+
+void shader_cache_destroy(ShaderCache* cache) {
+    if (!cache) return;
+
+    mutex_lock(cache->mutex);
+    cache->running = false;
+    condvar_broadcast(cache->cond);
+    mutex_unlock(cache->mutex);
+    for (uint32_t i = 0; i < cache->worker_count; ++i) thread_join(cache->workers[i]);
+
+    for (size_t i = 0; i < cache->job_count; ++i) free(cache->jobs[i].source);
+    for (size_t i = 0; i < cache->table_size; ++i) {
+        free(cache->table[i].spv);
+        free(cache->table[i].diagnostics);
+    }
+    free(cache->jobs);
+    free(cache->table);
+    condvar_destroy(cache->cond);
+    mutex_destroy(cache->mutex);
+    free(cache);
+}
+
+uint64_t shader_cache_key(const char* source, size_t size, const char* stage, const char* defines) {
+    size_t merged_size = 0;
+    char* merged = merge_defines(source, size, defines, &merged_size);
+    if (!merged) return 0;
+    uint64_t key = hash_merged(merged, merged_size, stage);
+    free(merged);
+    return key;
+}
+
+ShaderCacheStatus shader_cache_request(ShaderCache* cache, const char* source, size_t size, const char* stage, const char* defines, uint64_t* out_key) {
+    if (out_key) *out_key = 0;
+    if (!cache || !source || !stage || strlen(stage) >= sizeof(((ShaderCompileJob*)0)->stage)) return SHADER_CACHE_FAILED;
+
+    size_t merged_size = 0;
+    char* merged = merge_defines(source, size, defines, &merged_size);
+    if (!merged) return SHADER_CACHE_FAILED;
+    uint64_t key = hash_merged(merged, merged_size, stage);
+    if (out_key) *out_key = key;
+
+    // 1. Memory
+    mutex_lock(cache->mutex);
+    ShaderCacheEntry* entry = find_entry(cache, key);
+    if (entry) {
+        ShaderCacheStatus status = entry->status;
+        if (status == SHADER_CACHE_READY) cache->stats.memory_hits++;
+        touch_entry(cache, entry);
+        mutex_unlock(cache->mutex);
+        free(merged);
+        return status;
+    }
+    mutex_unlock(cache->mutex);
+
+    // 2. Disk (read outside the lock; entries are write-once so a racing insert is harmless)
+    void* spv = NULL;
+    size_t spv_size = 0;
+    if (cache->directory[0]) {
+        char path[320];
+        entry_path(cache, key, path, sizeof(path));
+        spv = fs_read_bin(NULL, path, &spv_size);
+        if (spv && !is_spirv(spv, spv_size)) {
+            LOG_WARN("ShaderCache: Ignoring corrupt entry %s", path);
+            free(spv);
+            spv = NULL;
+        }
+    }
+
+    mutex_lock(cache->mutex);
+    entry = find_entry(cache, key);
+    if (entry) {
+        // Another thread requested the same source meanwhile
+        ShaderCacheStatus status = entry->status;
+        touch_entry(cache, entry);
+        mutex_unlock(cache->mutex);
+        free(spv);
+        free(merged);
+        return status;
+    }
+    if (spv) {
+        entry = add_entry(cache, key, SHADER_CACHE_READY);
+        if (entry) {
+            entry->spv = spv;
+            entry->spv_size = spv_size;
+            cache->stats.disk_hits++;
+        } else {
+            free(spv);
+        }
+        mutex_unlock(cache->mutex);
+        free(merged);
+        return entry ? SHADER_CACHE_READY : SHADER_CACHE_FAILED;
+    }
+
+    // 3. Compile
+    ShaderCompileJob job = { .key = key, .source = merged, .size = merged_size };
+    snprintf(job.stage, sizeof(job.stage), "%s", stage);
+
+    if (cache->worker_count == 0) {
+        bool added = add_entry(cache, key, SHADER_CACHE_PENDING) != NULL;
+        mutex_unlock(cache->mutex);
+        if (!added) {
+            free(merged);
+            return SHADER_CACHE_FAILED;
+        }
+        run_job(cache, &job);
+        return shader_cache_poll(cache, key);
+    }
+
+    if (cache->job_count == cache->job_capacity) {
+        size_t new_cap = cache->job_capacity ? cache->job_capacity * 2 : 8;
+        ShaderCompileJob* jobs = realloc(cache->jobs, new_cap * sizeof(ShaderCompileJob));
+        if (!jobs) {
+            mutex_unlock(cache->mutex);
+            free(merged);
+            return SHADER_CACHE_FAILED;
+        }
+        cache->jobs = jobs;
+        cache->job_capacity = new_cap;
+    }
+    if (!add_entry(cache, key, SHADER_CACHE_PENDING)) {
+        mutex_unlock(cache->mutex);
+        free(merged);
+        return SHADER_CACHE_FAILED;
+    }
+    cache->jobs[cache->job_count++] = job;
+    condvar_broadcast(cache->cond);
+    mutex_unlock(cache->mutex);
+    return SHADER_CACHE_PENDING;
+}
+
+ShaderCacheStatus shader_cache_poll(ShaderCache* cache, uint64_t key) {
+    if (!cache) return SHADER_CACHE_FAILED;
+    mutex_lock(cache->mutex);
+    ShaderCacheEntry* entry = find_entry(cache, key);
+    if (entry) touch_entry(cache, entry);
+    ShaderCacheStatus status = entry ? entry->status : SHADER_CACHE_FAILED;
+    mutex_unlock(cache->mutex);
+    return status;
+}
+
+ShaderCacheStatus shader_cache_wait(ShaderCache* cache, uint64_t key) {
+    if (!cache) return SHADER_CACHE_FAILED;
+    mutex_lock(cache->mutex);
+    ShaderCacheEntry* entry = find_entry(cache, key);
+    while (entry && entry->status == SHADER_CACHE_PENDING) {
+        condvar_wait(cache->cond, cache->mutex);
+        entry = find_entry(cache, key); // The table may have moved
+    }
+    ShaderCacheStatus status = entry ? entry->status : SHADER_CACHE_FAILED;
+    mutex_unlock(cache->mutex);
+    return status;
+}
+
+bool shader_cache_get(ShaderCache* cache, uint64_t key, const void** out_spv, size_t* out_spv_size) {
+    if (!cache) return false;
+    mutex_lock(cache->mutex);
+    ShaderCacheEntry* entry = find_entry(cache, key);
+    bool ready = entry && entry->status == SHADER_CACHE_READY;
+    if (ready) {
+        if (out_spv) *out_spv = entry->spv;
+        if (out_spv_size) *out_spv_size = entry->spv_size;
+        entry->borrows++;
+        touch_entry(cache, entry);
+    }
+    mutex_unlock(cache->mutex);
+    return ready;
+}
+
+void shader_cache_release(ShaderCache* cache, uint64_t key) {
+    if (!cache) return;
+    mutex_lock(cache->mutex);
+    ShaderCacheEntry* entry = find_entry(cache, key);
+    if (entry && entry->borrows > 0) entry->borrows--;
+    mutex_unlock(cache->mutex);
+}
+
+bool shader_cache_get_diagnostics(ShaderCache* cache, uint64_t key, ShaderDiagnostics* out) {
+    if (!cache || !out) return false;
+    mutex_lock(cache->mutex);
+    ShaderCacheEntry* entry = find_entry(cache, key);
+    bool found = entry && entry->diagnostics;
+    if (found) *out = *entry->diagnostics;
+    mutex_unlock(cache->mutex);
+    return found;
+}
+
+ShaderCacheStats shader_cache_get_stats(ShaderCache* cache) {
+    ShaderCacheStats stats = {0};
+    if (!cache) return stats;
+    mutex_lock(cache->mutex);
+    stats = cache->stats;
+    mutex_unlock(cache->mutex);
+    return stats;
+}
+
+// --- Diagnostics ---
+
+static void add_diagnostic(ShaderDiagnostics* out, bool is_error, uint32_t line, const char* message, size_t message_len) {
+    if (is_error) out->error_count++;
+    else out->warning_count++;
+    if (out->count >= SHADER_MAX_DIAGNOSTICS) return;
+
+    ShaderDiagnostic* item = &out->items[out->count++];
+    item->line = line;
+    item->is_error = is_error;
+    while (message_len > 0 && (*message == ' ' || *message == '\t')) { message++; message_len--; }
+    if (message_len >= sizeof(item->message)) message_len = sizeof(item->message) - 1;
+    memcpy(item->message, message, message_len);
+    item->message[message_len] = '\0';
+}
+
+// Line number of a "name:LINE:" or "0:LINE:" location; 0 if there is none
+static uint32_t parse_location(const char* begin, const char* end) {
+    while (end > begin && (end[-1] == ' ' || end[-1] == ':')) end--;
+    const char* digits = end;
+    while (digits > begin && digits[-1] >= '0' && digits[-1] <= '9') digits--;
+    if (digits == end || digits == begin || digits[-1] != ':') return 0;
+
+    uint32_t line = 0;
+    for (const char* c = digits; c < end; ++c) line = line * 10 + (uint32_t)(*c - '0');
+    return line;
+}
+
+static void parse_line(const char* line, size_t len, ShaderDiagnostics* out) {
+    // glslangValidator: "ERROR: 0:12: 'x' : undeclared identifier"
+    static const struct { const char* prefix; bool is_error; } upper[] = { { "ERROR: ", true }, { "WARNING: ", false } };
+    for (size_t i = 0; i < sizeof(upper) / sizeof(upper[0]); ++i) {
+        size_t plen = strlen(upper[i].prefix);
+        if (len <= plen || strncmp(line, upper[i].prefix, plen) != 0) continue;
+        const char* rest = line + plen;
+        const char* end = line + len;
+        // The location is the leading "N:M:" run; the rest is the message
+        const char* msg = rest;
+        int colons = 0;
+        for (const char* c = rest; c < end && colons < 2; ++c) {
+            if (*c == ':') { colons++; msg = c + 1; }
+            else if (*c < '0' || *c > '9') break;
+        }
+        if (colons < 2) return; // "ERROR: 1 compilation errors." summaries repeat what was said
+        add_diagnostic(out, upper[i].is_error, parse_location(rest, msg), msg, (size_t)(end - msg));
+        return;
+    }
+
+    // glslc / shaderc: "graph.comp:12: error: 'x' : undeclared identifier"
+    static const struct { const char* marker; bool is_error; } lower[] = { { "error: ", true }, { "warning: ", false } };
+    const char* found = NULL;
+    size_t found_len = 0;
+    bool is_error = false;
+    for (size_t i = 0; i < sizeof(lower) / sizeof(lower[0]); ++i) {
+        size_t mlen = strlen(lower[i].marker);
+        for (const char* c = line; c + mlen <= line + len; ++c) {
+            if (strncmp(c, lower[i].marker, mlen) != 0) continue;
+            if (!found || c < found) { found = c; found_len = mlen; is_error = lower[i].is_error; }
+            break;
+        }
+    }
+    if (!found) return;
+    const char* msg = found + found_len;
+    add_diagnostic(out, is_error, parse_location(line, found), msg, (size_t)(line + len - msg));
+}
+
+void shader_diagnostics_parse(const char* log, ShaderDiagnostics* out) {
+    if (!log || !out) return;
+    const char* line = log;
+    while (*line) {
+        const char* end = strchr(line, '\n');
+        size_t len = end ? (size_t)(end - line) : strlen(line);
+        size_t trimmed = len;
+        while (trimmed > 0 && (line[trimmed - 1] == '\r' || line[trimmed - 1] == ' ')) trimmed--;
+        if (trimmed > 0) parse_line(line, trimmed, out);
+        if (!end) break;
+        line = end + 1;
+    }
+}
+
+const ShaderDiagnostic* shader_diagnostics_first_error(const ShaderDiagnostics* diagnostics) {
+    if (!diagnostics) return NULL;
+    for (uint32_t i = 0; i < diagnostics->count; ++i) {
+        if (diagnostics->items[i].is_error) return &diagnostics->items[i];
+    }
+    return NULL;
+}
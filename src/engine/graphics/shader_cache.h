@@ -0,0 +1,93 @@
+#ifndef SHADER_CACHE_H
+#define SHADER_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "engine/graphics/graphics_types.h"
+
+// --- Shader Cache ---
+// Content-addressed SPIR-V store. The key is a hash of (GLSL source, stage, defines), so
+// any source seen before (in this run or, through the on-disk directory, an earlier one)
+// resolves without compiling. Misses compile on background workers; callers poll or wait.
+//
+// Entries are immutable once resolved, so borrowed SPIR-V needs no locking or copying.
+// About 'max_entries' entries stay in memory; past that the least recently used
+// resolved one is dropped (a later request reloads it from disk). Pending entries and
+// entries borrowed with shader_cache_get are never dropped.
+
+#define SHADER_CACHE_DIR "cache/shaders"
+
+typedef struct ShaderCache ShaderCache;
+
+// Compiles 'source' to SPIR-V. Allocates *out_spv (freed by the cache with free()).
+// 'diagnostics' is zeroed and never NULL. Called from the worker threads, so with more
+// than one worker it must be reentrant.
+typedef bool (*ShaderCompileFunc)(void* user, const char* source, size_t size, const char* stage,
+                                  void** out_spv, size_t* out_spv_size, ShaderDiagnostics* diagnostics);
+
+#define SHADER_CACHE_MAX_WORKERS 4
+#define SHADER_CACHE_DEFAULT_MAX_ENTRIES 256
+
+typedef struct ShaderCacheConfig {
+    const char* directory; // On-disk store, created on first write. NULL = memory only.
+    ShaderCompileFunc compile;
+    void* user;
+    uint32_t worker_count; // Concurrent compiles, clamped to [1, SHADER_CACHE_MAX_WORKERS]
+    uint32_t max_entries;  // Entries kept in memory, 0 = SHADER_CACHE_DEFAULT_MAX_ENTRIES
+} ShaderCacheConfig;
+
+typedef enum ShaderCacheStatus {
+    SHADER_CACHE_PENDING,
+    SHADER_CACHE_READY,
+    SHADER_CACHE_FAILED,
+} ShaderCacheStatus;
+
+typedef struct ShaderCacheStats {
+    uint32_t memory_hits;
+    uint32_t disk_hits;
+    uint32_t compiles;  // Finished compiles, including failures
+    uint32_t failures;
+    uint32_t evictions; // Entries dropped from memory to stay within max_entries
+} ShaderCacheStats;
+
+ShaderCache* shader_cache_create(const ShaderCacheConfig* config);
+
+// Stops the workers (compiles in progress finish first) and frees every entry.
+void shader_cache_destroy(ShaderCache* cache);
+
+// 'defines' holds preprocessor lines inserted after the #version directive (may be NULL).
+uint64_t shader_cache_key(const char* source, size_t size, const char* stage, const char* defines);
+
+/**
+ * @brief Looks the shader up in memory, then on disk; queues a compile on a miss.
+ * Never waits for the compiler. A source that failed before stays FAILED.
+ * @param out_key Receives the key to poll, wait on or fetch.
+ */
+ShaderCacheStatus shader_cache_request(ShaderCache* cache, const char* source, size_t size, const char* stage, const char* defines, uint64_t* out_key);
+
+// Current status of a requested key (FAILED for unknown keys).
+ShaderCacheStatus shader_cache_poll(ShaderCache* cache, uint64_t key);
+
+// Blocks until the key is no longer PENDING.
+ShaderCacheStatus shader_cache_wait(ShaderCache* cache, uint64_t key);
+
+// Borrows the SPIR-V of a READY key. It stays valid (and the entry in memory) until the
+// matching shader_cache_release.
+bool shader_cache_get(ShaderCache* cache, uint64_t key, const void** out_spv, size_t* out_spv_size);
+void shader_cache_release(ShaderCache* cache, uint64_t key);
+
+// Copies the compiler messages of a resolved key (errors for FAILED, warnings for READY).
+// Only compiles from this run have them; returns false if there are none.
+bool shader_cache_get_diagnostics(ShaderCache* cache, uint64_t key, ShaderDiagnostics* out);
+
+ShaderCacheStats shader_cache_get_stats(ShaderCache* cache);
+
+// Appends the messages of a glslang-style log ("name:LINE: error: msg" or
+// "ERROR: 0:LINE: msg") to 'out'. Lines without a severity are skipped.
+void shader_diagnostics_parse(const char* log, ShaderDiagnostics* out);
+
+// First error in 'diagnostics', or NULL if it holds only warnings.
+const ShaderDiagnostic* shader_diagnostics_first_error(const ShaderDiagnostics* diagnostics);
+
+#endif // SHADER_CACHE_H
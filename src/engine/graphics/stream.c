@@ -19,7 +19,7 @@ static size_t get_element_size(StreamType type, size_t custom_size) {
     }
 }
 
-Stream* stream_create(RenderSystem* sys, StreamType type, size_t count, size_t custom_element_size) {
+static Stream* stream_create_internal(RenderSystem* sys, StreamType type, size_t count, size_t custom_element_size, bool host_visible) {
     if (!sys || count == 0) return NULL;
     
     RendererBackend* backend = render_system_get_backend(sys);
@@ -46,6 +46,8 @@ Stream* stream_create(RenderSystem* sys, StreamType type, size_t count, size_t c
     s->element_size = elem_size;
     s->total_size = total_size;
     s->buffer_handle = NULL;
+    s->host_visible = host_visible;
+    s->mapped = NULL;
     
     if (!backend->buffer_create(backend, s)) {
         LOG_ERROR("Stream: Failed to allocate GPU buffer (%zu bytes).", total_size);
@@ -53,12 +55,28 @@ Stream* stream_create(RenderSystem* sys, StreamType type, size_t count, size_t c
         return NULL;
     }
 
+    if (host_visible && backend->buffer_map) {
+        s->mapped = backend->buffer_map(backend, s);
+    }
+
     LOG_TRACE("Stream created: %p (Count: %zu, Size: %zu bytes)", (void*)s, count, total_size);
     return s;
 }
 
+Stream* stream_create(RenderSystem* sys, StreamType type, size_t count, size_t custom_element_size) {
+    return stream_create_internal(sys, type, count, custom_element_size, false);
+}
+
+Stream* stream_create_mapped(RenderSystem* sys, StreamType type, size_t count, size_t custom_element_size) {
+    return stream_create_internal(sys, type, count, custom_element_size, true);
+}
+
 void stream_destroy(Stream* stream) {
     if (!stream) return;
+
+    if (stream->mapped && stream->backend && stream->backend->buffer_unmap) {
+        stream->backend->buffer_unmap(stream->backend, stream);
+    }
     
     if (stream->backend && stream->backend->buffer_destroy) {
         stream->backend->buffer_destroy(stream->backend, stream);
@@ -79,6 +97,23 @@ bool stream_set_data(Stream* stream, const void* data, size_t count) {
     return stream->backend->buffer_upload(stream->backend, stream, data, count * stream->element_size, 0);
 }
 
+bool stream_set_data_range(Stream* stream, const void* data, size_t first, size_t count) {
+    if (!stream || !data) return false;
+    if (first > stream->count || count > stream->count - first) {
+        LOG_WARN("Stream: Range [%zu, +%zu) exceeds stream of size %zu", first, count, stream->count);
+        return false;
+    }
+    if (count == 0) return true;
+
+    if (!stream->backend->buffer_upload) return false;
+
+    return stream->backend->buffer_upload(stream->backend, stream, data, count * stream->element_size, first * stream->element_size);
+}
+
+void* stream_get_mapped(Stream* stream) {
+    return stream ? stream->mapped : NULL;
+}
+
 bool stream_read_back(Stream* stream, void* out_data, size_t count) {
     if (!stream || !out_data) return false;
     if (count > stream->count) count = stream->count; // Clamp
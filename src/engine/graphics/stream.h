@@ -28,6 +28,10 @@ typedef enum {
 // element_size: размер одного элемента в байтах (игнорируется для стандартных типов, обязателен для STREAM_CUSTOM).
 Stream* stream_create(RenderSystem* sys, StreamType type, size_t count, size_t element_size);
 
+// Создает поток в памяти, видимой CPU, и держит его постоянно отображенным (persistent map).
+// Для данных, которые CPU переписывает каждый кадр: запись идет напрямую, без staging-копии.
+Stream* stream_create_mapped(RenderSystem* sys, StreamType type, size_t count, size_t element_size);
+
 // Уничтожает поток.
 void stream_destroy(Stream* stream);
 
@@ -38,6 +42,12 @@ void stream_destroy(Stream* stream);
 // count: количество элементов для копирования (должно быть <= stream.capacity).
 bool stream_set_data(Stream* stream, const void* data, size_t count);
 
+// Загружает count элементов, начиная с элемента first (частичное обновление).
+bool stream_set_data_range(Stream* stream, const void* data, size_t first, size_t count);
+
+// Указатель на отображенную память потока (только stream_create_mapped), иначе NULL.
+void* stream_get_mapped(Stream* stream);
+
 // Читает данные с GPU на CPU (блокирующая операция, медленно!).
 // out_data: буфер назначения.
 bool stream_read_back(Stream* stream, void* out_data, size_t count);
@@ -147,11 +147,12 @@ static void on_cursor_pos(PlatformWindow* window, double x, double y, void* user
 // --- Public API ---
 
 InputSystem* input_system_create(PlatformWindow* window) {
-    if (!window) return NULL;
-    
     InputSystem* sys = (InputSystem*)calloc(1, sizeof(InputSystem));
     if (!sys) return NULL;
 
+    // Headless: no events ever arrive, every query reports an idle device
+    if (!window) return sys;
+
     // Register Callbacks with 'sys' as user_data
     platform_set_mouse_button_callback(window, on_mouse_button, sys);
     platform_set_scroll_callback(window, on_scroll, sys);
@@ -212,60 +213,71 @@ void input_map_action(InputSystem* sys, const char* action_name, InputKey defaul
     }
 }
 
-bool input_is_action_pressed(const InputSystem* sys, const char* action_name) {
-    if (!sys || !action_name) return false;
-    StringId id = str_id(action_name);
-
+// Returns the mapping for an action, or NULL if it was never mapped
+static const ActionMapping* find_action(const InputSystem* sys, StringId id) {
     for (int i = 0; i < sys->action_count; ++i) {
-        if (sys->actions[i].name_hash == id) {
-            InputKey k = sys->actions[i].key;
-            if (k == INPUT_KEY_UNKNOWN) return false; // Unbound
-            
-            bool key_down = sys->state.keys[k];
-            bool mods_ok = check_modifiers(sys, sys->actions[i].mods);
-            return key_down && mods_ok;
-        }
+        if (sys->actions[i].name_hash == id) return &sys->actions[i];
     }
-    return false;
+    return NULL;
 }
 
-bool input_is_action_just_pressed(const InputSystem* sys, const char* action_name) {
-    if (!sys || !action_name) return false;
-    StringId id = str_id(action_name);
+bool input_is_action_pressed_id(const InputSystem* sys, StringId action_id) {
+    if (!sys) return false;
+    const ActionMapping* action = find_action(sys, action_id);
+    if (!action) return false;
 
-    for (int i = 0; i < sys->action_count; ++i) {
-        if (sys->actions[i].name_hash == id) {
-            InputKey k = sys->actions[i].key;
-            if (k == INPUT_KEY_UNKNOWN) return false;
+    InputKey k = action->key;
+    if (k == INPUT_KEY_UNKNOWN) return false; // Unbound
 
-            bool key_down = sys->state.keys[k];
-            bool prev_down = sys->_prev_keys[k];
-            bool mods_ok = check_modifiers(sys, sys->actions[i].mods);
+    bool key_down = sys->state.keys[k];
+    bool mods_ok = check_modifiers(sys, action->mods);
+    return key_down && mods_ok;
+}
 
-            // Note: We don't check if modifiers were "just pressed", usually just the trigger key.
-            return key_down && !prev_down && mods_ok;
-        }
-    }
-    return false;
+bool input_is_action_just_pressed_id(const InputSystem* sys, StringId action_id) {
+    if (!sys) return false;
+    const ActionMapping* action = find_action(sys, action_id);
+    if (!action) return false;
+
+    InputKey k = action->key;
+    if (k == INPUT_KEY_UNKNOWN) return false;
+
+    bool key_down = sys->state.keys[k];
+    bool prev_down = sys->_prev_keys[k];
+    bool mods_ok = check_modifiers(sys, action->mods);
+
+    // Note: We don't check if modifiers were "just pressed", usually just the trigger key.
+    return key_down && !prev_down && mods_ok;
 }
 
-bool input_is_action_released(const InputSystem* sys, const char* action_name) {
+bool input_is_action_released_id(const InputSystem* sys, StringId action_id) {
+    if (!sys) return false;
+    const ActionMapping* action = find_action(sys, action_id);
+    if (!action) return false;
+
+    InputKey k = action->key;
+    if (k == INPUT_KEY_UNKNOWN) return false;
+
+    bool key_down = sys->state.keys[k];
+    bool prev_down = sys->_prev_keys[k];
+    // Modifiers state at release moment? 
+    // Usually we want to know if it WAS pressed and NOW isn't.
+    return !key_down && prev_down;
+}
+
+bool input_is_action_pressed(const InputSystem* sys, const char* action_name) {
     if (!sys || !action_name) return false;
-    StringId id = str_id(action_name);
+    return input_is_action_pressed_id(sys, str_id(action_name));
+}
 
-    for (int i = 0; i < sys->action_count; ++i) {
-        if (sys->actions[i].name_hash == id) {
-            InputKey k = sys->actions[i].key;
-            if (k == INPUT_KEY_UNKNOWN) return false;
-
-            bool key_down = sys->state.keys[k];
-            bool prev_down = sys->_prev_keys[k];
-            // Modifiers state at release moment? 
-            // Usually we want to know if it WAS pressed and NOW isn't.
-            return !key_down && prev_down;
-        }
-    }
-    return false;
+bool input_is_action_just_pressed(const InputSystem* sys, const char* action_name) {
+    if (!sys || !action_name) return false;
+    return input_is_action_just_pressed_id(sys, str_id(action_name));
+}
+
+bool input_is_action_released(const InputSystem* sys, const char* action_name) {
+    if (!sys || !action_name) return false;
+    return input_is_action_released_id(sys, str_id(action_name));
 }
 
 // --- Accessors ---
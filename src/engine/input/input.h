@@ -1,6 +1,7 @@
 #ifndef ENGINE_INPUT_H
 #define ENGINE_INPUT_H
 
+#include "foundation/string/string_id.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -193,6 +194,7 @@ typedef enum InputMod {
 
 // --- Lifecycle ---
 
+// A NULL window gives a headless input system that never receives events.
 InputSystem* input_system_create(struct PlatformWindow* window);
 void input_system_destroy(InputSystem* sys);
 void input_system_update(InputSystem* sys);
@@ -222,6 +224,11 @@ bool input_is_action_just_pressed(const InputSystem* sys, const char* action_nam
  */
 bool input_is_action_released(const InputSystem* sys, const char* action_name);
 
+// Variants taking a precomputed id (e.g. STR_ID("Undo")) to skip hashing per query.
+bool input_is_action_pressed_id(const InputSystem* sys, StringId action_id);
+bool input_is_action_just_pressed_id(const InputSystem* sys, StringId action_id);
+bool input_is_action_released_id(const InputSystem* sys, StringId action_id);
+
 // --- Accessors (State) ---
 
 float input_get_mouse_x(const InputSystem* sys);
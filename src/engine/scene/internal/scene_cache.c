@@ -0,0 +1,140 @@
+#include "scene_cache.h"
+#include "foundation/logger/logger.h"
+#include <stddef.h>
+#include <stdlib.h>
+
+#define SCENE_CACHE_VERSION 1u
+#define SCENE_CACHE_RESERVE ((size_t)64 * 1024 * 1024) // Virtual, committed on demand
+
+// Root record of the payload
+typedef struct SceneCacheRoot {
+    SceneNodeSpec* root;
+    SceneTemplate* templates;
+} SceneCacheRoot;
+
+static uint32_t scene_cache_schema(void) {
+    uint32_t schema = config_cache_schema_mix(SCENE_CACHE_VERSION, sizeof(void*));
+    schema = config_cache_schema_mix(schema, sizeof(SceneNodeSpec));
+    schema = config_cache_schema_mix(schema, sizeof(SceneBindingSpec));
+    schema = config_cache_schema_mix(schema, sizeof(SceneTemplate));
+    schema = config_cache_schema_mix(schema, offsetof(SceneNodeSpec, bindings));
+    schema = config_cache_schema_mix(schema, offsetof(SceneNodeSpec, collection));
+    schema = config_cache_schema_mix(schema, offsetof(SceneNodeSpec, item_template));
+    schema = config_cache_schema_mix(schema, offsetof(SceneNodeSpec, children));
+    schema = config_cache_schema_mix(schema, offsetof(SceneNodeSpec, system_spec));
+    return schema;
+}
+
+// --- Writing ---
+
+static void write_string_field(ConfigCacheWriter* w, size_t slot, const char* str) {
+    config_cache_writer_set_pointer(w, slot, config_cache_writer_push_string(w, str));
+}
+
+// Returns the payload offset of the copied spec (SIZE_MAX for NULL or failure)
+static size_t write_spec(ConfigCacheWriter* w, const SceneNodeSpec* spec) {
+    if (!spec) return SIZE_MAX;
+    if (spec->system_spec) {
+        w->failed = true; // Opaque extension data cannot be serialized
+        return SIZE_MAX;
+    }
+
+    size_t at = config_cache_writer_push(w, spec, sizeof(SceneNodeSpec), _Alignof(SceneNodeSpec));
+    if (at == SIZE_MAX) return SIZE_MAX;
+
+    // Bindings
+    if (spec->bindings && spec->binding_count > 0) {
+        size_t bindings = config_cache_writer_push(w, spec->bindings, spec->binding_count * sizeof(SceneBindingSpec),
+                                                   _Alignof(SceneBindingSpec));
+        for (size_t i = 0; i < spec->binding_count && bindings != SIZE_MAX; ++i) {
+            size_t b = bindings + i * sizeof(SceneBindingSpec);
+            write_string_field(w, b + offsetof(SceneBindingSpec, target), spec->bindings[i].target);
+            write_string_field(w, b + offsetof(SceneBindingSpec, source), spec->bindings[i].source);
+        }
+        config_cache_writer_set_pointer(w, at + offsetof(SceneNodeSpec, bindings), bindings);
+    } else {
+        config_cache_writer_set_pointer(w, at + offsetof(SceneNodeSpec, bindings), SIZE_MAX);
+    }
+
+    // Strings
+    write_string_field(w, at + offsetof(SceneNodeSpec, collection), spec->collection);
+    write_string_field(w, at + offsetof(SceneNodeSpec, template_selector), spec->template_selector);
+    write_string_field(w, at + offsetof(SceneNodeSpec, text), spec->text);
+    write_string_field(w, at + offsetof(SceneNodeSpec, text_source), spec->text_source);
+
+    // Hierarchy
+    config_cache_writer_set_pointer(w, at + offsetof(SceneNodeSpec, item_template), write_spec(w, spec->item_template));
+
+    if (spec->children && spec->child_count > 0) {
+        size_t children = config_cache_writer_push(w, NULL, spec->child_count * sizeof(SceneNodeSpec*),
+                                                   _Alignof(SceneNodeSpec*));
+        for (size_t i = 0; i < spec->child_count && children != SIZE_MAX; ++i) {
+            size_t child = write_spec(w, spec->children[i]);
+            config_cache_writer_set_pointer(w, children + i * sizeof(SceneNodeSpec*), child);
+        }
+        config_cache_writer_set_pointer(w, at + offsetof(SceneNodeSpec, children), children);
+    } else {
+        config_cache_writer_set_pointer(w, at + offsetof(SceneNodeSpec, children), SIZE_MAX);
+    }
+
+    return w->failed ? SIZE_MAX : at;
+}
+
+bool scene_cache_store(const char* path, const SceneAsset* asset,
+                       const ConfigCacheDependency* deps, size_t dep_count) {
+    if (!path || !asset) return false;
+
+    ConfigCacheWriter w;
+    config_cache_writer_init(&w);
+
+    size_t root = config_cache_writer_push(&w, NULL, sizeof(SceneCacheRoot), _Alignof(SceneCacheRoot));
+    config_cache_writer_set_pointer(&w, root + offsetof(SceneCacheRoot, root), write_spec(&w, asset->root));
+
+    // Template list, written in the same order so lookups behave identically
+    size_t link_slot = root + offsetof(SceneCacheRoot, templates);
+    for (const SceneTemplate* t = asset->templates; t && !w.failed; t = t->next) {
+        size_t node = config_cache_writer_push(&w, NULL, sizeof(SceneTemplate), _Alignof(SceneTemplate));
+        config_cache_writer_set_pointer(&w, link_slot, node);
+        write_string_field(&w, node + offsetof(SceneTemplate, name), t->name);
+        config_cache_writer_set_pointer(&w, node + offsetof(SceneTemplate, spec), write_spec(&w, t->spec));
+        link_slot = node + offsetof(SceneTemplate, next);
+    }
+    config_cache_writer_set_pointer(&w, link_slot, SIZE_MAX);
+
+    bool ok = false;
+    if (!w.failed) {
+        char cache_path[512];
+        config_cache_path(path, "scene", cache_path, sizeof(cache_path));
+        ok = config_cache_write(cache_path, scene_cache_schema(), deps, dep_count, &w, root);
+    }
+
+    config_cache_writer_free(&w);
+    return ok;
+}
+
+// --- Loading ---
+
+SceneAsset* scene_cache_load(const char* path) {
+    if (!path) return NULL;
+
+    char cache_path[512];
+    config_cache_path(path, "scene", cache_path, sizeof(cache_path));
+
+    SceneAsset* asset = (SceneAsset*)calloc(1, sizeof(SceneAsset));
+    if (!asset) return NULL;
+    if (!arena_init_virtual(&asset->arena, SCENE_CACHE_RESERVE)) {
+        free(asset);
+        return NULL;
+    }
+
+    SceneCacheRoot* root = (SceneCacheRoot*)config_cache_load(cache_path, scene_cache_schema(), &asset->arena);
+    if (!root) {
+        scene_asset_destroy(asset);
+        return NULL;
+    }
+
+    asset->root = root->root;
+    asset->templates = root->templates;
+    LOG_TRACE("SceneCache: Loaded '%s' from %s", path, cache_path);
+    return asset;
+}
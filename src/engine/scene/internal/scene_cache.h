@@ -0,0 +1,18 @@
+#ifndef SCENE_CACHE_H
+#define SCENE_CACHE_H
+
+#include "scene_tree_internal.h"
+#include "foundation/config/config_cache.h"
+
+// --- Compiled Scene Cache ---
+// Serializes a parsed SceneAsset (node specs, bindings, strings, templates) into a
+// relocatable config cache, keyed by the source path.
+
+// Returns a fully usable asset, or NULL if there is no valid cache for 'path'.
+SceneAsset* scene_cache_load(const char* path);
+
+// Writes the cache for an asset parsed from 'path'. 'deps' lists every file read (path + imports).
+bool scene_cache_store(const char* path, const SceneAsset* asset,
+                       const ConfigCacheDependency* deps, size_t dep_count);
+
+#endif // SCENE_CACHE_H
@@ -54,9 +54,11 @@ SceneNode* scene_internal_node_create(SceneTree* tree, const SceneNodeSpec* spec
     node->spec = spec;
     node->data_ptr = data;
     node->meta = meta;
-    node->flags = spec->flags;
+    node->flags = spec->flags | SCENE_FLAG_DIRTY;
+    node->ui_flags = UI_FLAG_LAYOUT_DIRTY;
     
-    // Initial transform update
+    // Transform is computed on the first update
+    node->transform = spec->transform;
     node->local_matrix = mat4_identity();
     node->world_matrix = mat4_identity();
 
@@ -86,7 +88,8 @@ void scene_internal_node_add_child(SceneNode* parent, SceneNode* child) {
     parent->last_child = child;
     parent->child_count++;
     
-    child->flags |= SCENE_FLAG_DIRTY;
+    scene_internal_node_mark_dirty(child); // New parent, new world matrix
+    scene_internal_node_mark_layout_dirty(parent);
 }
 
 void scene_internal_node_clear_children(SceneNode* parent, SceneTree* tree) {
@@ -101,52 +104,93 @@ void scene_internal_node_clear_children(SceneNode* parent, SceneTree* tree) {
     parent->first_child = NULL;
     parent->last_child = NULL;
     parent->child_count = 0;
+
+    scene_internal_node_mark_layout_dirty(parent);
 }
 
 // --- Transform System Internal ---
+// Setters mark a node DIRTY and tag its ancestors CHILD_DIRTY, so an update only
+// descends into branches that contain dirty nodes. Below a dirty node the whole
+// subtree is recomputed (its parent world changed); clean siblings are skipped.
 
-void scene_internal_node_update_transforms(SceneNode* node, const Mat4* parent_world) {
+void scene_internal_node_mark_dirty(SceneNode* node) {
     if (!node) return;
+    node->flags |= SCENE_FLAG_DIRTY;
+
+    // Stop at the first ancestor already tagged: everything above it is too
+    for (SceneNode* p = node->parent; p && !(p->flags & SCENE_FLAG_CHILD_DIRTY); p = p->parent) {
+        p->flags |= SCENE_FLAG_CHILD_DIRTY;
+    }
+}
 
-    // 1. Build Local Matrix (from spec transform)
-    const SceneTransformSpec* trans = &node->spec->transform;
+// Same scheme for UI layout, on ui_flags
+void scene_internal_node_mark_layout_dirty(SceneNode* node) {
+    if (!node) return;
+    node->ui_flags |= UI_FLAG_LAYOUT_DIRTY;
+
+    for (SceneNode* p = node->parent; p && !(p->ui_flags & UI_FLAG_LAYOUT_CHILD_DIRTY); p = p->parent) {
+        p->ui_flags |= UI_FLAG_LAYOUT_CHILD_DIRTY;
+    }
+}
+
+static void build_local_matrix(SceneNode* node) {
+    const SceneTransformSpec* trans = &node->transform;
     
     Vec3 scale = { 
         trans->local_scale.x == 0 ? 1.0f : trans->local_scale.x, 
         trans->local_scale.y == 0 ? 1.0f : trans->local_scale.y, 
         trans->local_scale.z == 0 ? 1.0f : trans->local_scale.z 
     };
-    Mat4 mat_s = mat4_scale(scale);
-    
     EulerAngles euler = { trans->local_rotation.x, trans->local_rotation.y, trans->local_rotation.z };
-    Mat4 mat_r = mat4_rotation_euler(euler);
-    
-    Mat4 mat_t = mat4_translation(trans->local_position);
-    
-    Mat4 mat_rs = mat4_multiply(&mat_r, &mat_s);
-    node->local_matrix = mat4_multiply(&mat_t, &mat_rs);
+    node->local_matrix = mat4_compose(trans->local_position, quat_from_euler(euler), scale); // T * R * S
+}
 
-    // 2. World Matrix
-    if (parent_world) {
-        node->world_matrix = mat4_multiply(parent_world, &node->local_matrix);
-    } else {
-        node->world_matrix = node->local_matrix;
+static size_t update_recursive(SceneNode* node, const Mat4* parent_world, bool parent_changed) {
+    if (!parent_changed && !(node->flags & (SCENE_FLAG_DIRTY | SCENE_FLAG_CHILD_DIRTY))) return 0;
+
+    size_t updated = 0;
+    bool changed = parent_changed || (node->flags & SCENE_FLAG_DIRTY);
+
+    if (changed) {
+        // 1. Local Matrix (only when the node itself moved)
+        if (node->flags & SCENE_FLAG_DIRTY) build_local_matrix(node);
+
+        // 2. World Matrix
+        if (parent_world) {
+            node->world_matrix = mat4_multiply(parent_world, &node->local_matrix);
+        } else {
+            node->world_matrix = node->local_matrix;
+        }
+        node->world_version++;
+        updated++;
     }
+    node->flags &= ~(uint32_t)(SCENE_FLAG_DIRTY | SCENE_FLAG_CHILD_DIRTY);
 
-    // 3. Recurse
+    // 3. Recurse (dirtiness flows down implicitly through 'changed')
     for (SceneNode* child = node->first_child; child; child = child->next_sibling) {
-        scene_internal_node_update_transforms(child, &node->world_matrix);
+        updated += update_recursive(child, &node->world_matrix, changed);
     }
+    return updated;
 }
 
-SceneNode* scene_internal_node_find_by_id(SceneNode* root, const char* id) {
-    if (!root || !id) return NULL;
-    StringId target = str_id(id);
-    if ((root->spec ? root->spec->id : 0) == target) return root;
+size_t scene_internal_node_update_transforms(SceneNode* node, const Mat4* parent_world) {
+    if (!node) return 0;
+    return update_recursive(node, parent_world, false);
+}
+
+SceneNode* scene_internal_node_find(SceneNode* root, StringId id) {
+    if (!root || id == 0) return NULL;
+    if ((root->spec ? root->spec->id : 0) == id) return root;
     
     for (SceneNode* child = root->first_child; child; child = child->next_sibling) {
-        SceneNode* found = scene_internal_node_find_by_id(child, id);
+        SceneNode* found = scene_internal_node_find(child, id);
         if (found) return found;
     }
     return NULL;
 }
+
+SceneNode* scene_internal_node_find_by_id(SceneNode* root, const char* id) {
+    if (!root || !id) return NULL;
+    // Hash once, then compare integers down the tree
+    return scene_internal_node_find(root, str_id(id));
+}
@@ -11,7 +11,10 @@ void scene_internal_tree_destroy(SceneTree* tree);
 SceneNode* scene_internal_node_create(SceneTree* tree, const SceneNodeSpec* spec, void* data, const struct MetaStruct* meta);
 void scene_internal_node_add_child(SceneNode* parent, SceneNode* child);
 void scene_internal_node_clear_children(SceneNode* parent, SceneTree* tree);
-void scene_internal_node_update_transforms(SceneNode* node, const Mat4* parent_world);
+void scene_internal_node_mark_dirty(SceneNode* node);
+void scene_internal_node_mark_layout_dirty(SceneNode* node);
+size_t scene_internal_node_update_transforms(SceneNode* node, const Mat4* parent_world);
+SceneNode* scene_internal_node_find(SceneNode* root, StringId id);
 SceneNode* scene_internal_node_find_by_id(SceneNode* root, const char* id);
 
 #endif // SCENE_GRAPH_H
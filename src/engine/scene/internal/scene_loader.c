@@ -1,6 +1,7 @@
 #include "scene_tree_internal.h"
 #include "../scene.h"
 #include "scene_loader.h"
+#include "scene_cache.h"
 #include "foundation/config/simple_yaml.h"
 #include "foundation/logger/logger.h"
 #include "foundation/memory/arena.h"
@@ -267,12 +268,30 @@ static SceneNodeSpec* load_recursive(SceneAsset* asset, const ConfigNode* node)
 
 // --- Generic Reflection for Scalars ---
 
-static ConfigNode* resolve_import(MemoryArena* scratch, const ConfigNode* node) {
+#define SCENE_LOADER_MAX_DEPS 32
+
+// Files read while loading, recorded for the compiled cache
+typedef struct SceneLoadDeps {
+    const char* paths[SCENE_LOADER_MAX_DEPS];
+    size_t count;
+    bool overflow;
+} SceneLoadDeps;
+
+static void deps_add(SceneLoadDeps* deps, const char* path) {
+    for (size_t i = 0; i < deps->count; ++i) {
+        if (strcmp(deps->paths[i], path) == 0) return;
+    }
+    if (deps->count < SCENE_LOADER_MAX_DEPS) deps->paths[deps->count++] = path;
+    else deps->overflow = true;
+}
+
+static ConfigNode* resolve_import(MemoryArena* scratch, const ConfigNode* node, SceneLoadDeps* deps) {
     if (node->type == CONFIG_NODE_MAP) {
         const ConfigNode* import_val = config_node_map_get(node, "import");
         if (import_val && import_val->scalar) {
             char* text = fs_read_text(scratch, import_val->scalar);
             if (text) {
+                deps_add(deps, import_val->scalar);
                 ConfigNode* imported_root = NULL;
                 ConfigError err;
                 if (simple_yaml_parse(scratch, text, &imported_root, &err)) {
@@ -303,11 +322,15 @@ static void validate_node(SceneNodeSpec* spec, const char* path) {
 SceneAsset* scene_internal_asset_load_from_file(const char* path) {
     if (!path) return NULL;
 
+    // Compiled cache first: one read + relocation instead of YAML + reflection
+    SceneAsset* cached = scene_cache_load(path);
+    if (cached) return cached;
+
     LOG_TRACE("UiParser: Loading UI definition from file: %s", path);
 
-    // Scratch Arena for parsing (2MB should be plenty for config files)
+    // Scratch Arena for parsing (virtual, so large imports cannot overflow it)
     MemoryArena scratch;
-    if (!arena_init(&scratch, 2 * 1024 * 1024)) {
+    if (!arena_init_virtual(&scratch, (size_t)256 * 1024 * 1024)) {
         LOG_ERROR("UiParser: Failed to init scratch arena");
         return NULL;
     }
@@ -327,6 +350,9 @@ SceneAsset* scene_internal_asset_load_from_file(const char* path) {
         return NULL;
     }
 
+    SceneLoadDeps deps = {0};
+    deps_add(&deps, path);
+
     // Create Asset (Owner)
     SceneAsset* asset = scene_asset_create(64 * 1024);
     if (!asset) {
@@ -341,7 +367,7 @@ SceneAsset* scene_internal_asset_load_from_file(const char* path) {
             const char* t_name = templates_node->pairs[i].key;
             const ConfigNode* t_val = templates_node->pairs[i].value;
             
-            ConfigNode* t_actual = resolve_import(&scratch, t_val);
+            ConfigNode* t_actual = resolve_import(&scratch, t_val, &deps);
             
             SceneNodeSpec* spec = load_recursive(asset, t_actual ? t_actual : t_val);
             if (spec) {
@@ -355,11 +381,24 @@ SceneAsset* scene_internal_asset_load_from_file(const char* path) {
         }
     }
 
-    ConfigNode* root_actual = resolve_import(&scratch, root);
+    ConfigNode* root_actual = resolve_import(&scratch, root, &deps);
     asset->root = load_recursive(asset, root_actual ? root_actual : root);
     
     validate_node(asset->root, path);
-    
+
+    // Store the compiled cache (best effort; a failure only costs the next load a parse)
+    if (!deps.overflow) {
+        ConfigCacheDependency cache_deps[SCENE_LOADER_MAX_DEPS];
+        size_t cache_dep_count = 0;
+        for (size_t i = 0; i < deps.count; ++i) {
+            if (!config_cache_dependency_init(&cache_deps[cache_dep_count], deps.paths[i])) break;
+            cache_dep_count++;
+        }
+        if (cache_dep_count == deps.count) {
+            scene_cache_store(path, asset, cache_deps, cache_dep_count);
+        }
+    }
+
     arena_destroy(&scratch);
     return asset;
 }
@@ -123,12 +123,15 @@ typedef struct SceneNode {
     const struct MetaStruct* meta; // Type info
 
     // --- TRANSFORM SYSTEM ---
+    SceneTransformSpec transform; // Local TRS (starts as spec->transform)
     Mat4 local_matrix;    // T * R * S
     Mat4 world_matrix;    // ParentWorld * Local
+    uint32_t world_version; // Bumped whenever world_matrix is recomputed
     
     // --- UI / INTERACTION ---
     Rect rect;            // Computed layout relative to parent
     Rect screen_rect;     // Computed screen space
+    Rect subtree_bounds;  // Union of visible screen rects below (valid if UI_FLAG_BOUNDS_VALID)
     Vec4 render_color;    // Animated color
     
     StringId on_click_cmd_id;
@@ -150,6 +153,10 @@ typedef struct SceneNode {
     float desired_x;
     float desired_y;
 
+    // Space offered by the parent in the last layout (clean node + same space = reuse rects)
+    float layout_avail_w;
+    float layout_avail_h;
+
     // Data Binding (Runtime Cache)
     void* ui_bindings; 
     size_t ui_binding_count;
@@ -168,6 +175,7 @@ typedef struct SceneTree {
     MemoryPool* node_pool; 
     SceneNode* root;
     SceneAsset* assets;
+    Rect viewport; // Window area of the last UI layout (render culling), empty = none
 } SceneTree;
 
 // --- ASSET ---
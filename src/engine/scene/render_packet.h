@@ -4,6 +4,7 @@
 #include "foundation/math/coordinate_systems.h"
 #include <stddef.h> // size_t
 #include <stdint.h> // uint64_t
+#include "foundation/string/string_id.h"
 
 #include "engine/ui/ui_node.h"
 #include "engine/graphics/graphics_types.h"
@@ -82,7 +83,14 @@ uint64_t scene_get_frame_number(const Scene* scene);
 // Data Access for Backend
 // Returns pointer to internal linear array and sets out_count.
 const UiNode* scene_get_ui_nodes(const Scene* scene, size_t* out_count);
-const RenderBatch* scene_get_render_batches(const Scene* scene, size_t* out_count);
+
+// Batches are bucketed by RenderBatch.draw_list_id when pushed, so a pass reads its
+// draw lists directly instead of filtering every batch.
+const RenderBatch* scene_get_draw_list(const Scene* scene, StringId draw_list_id, size_t* out_count);
+
+// Iteration over all non-empty draw lists, in first-push order.
+size_t scene_get_draw_list_count(const Scene* scene);
+const RenderBatch* scene_get_draw_list_at(const Scene* scene, size_t index, StringId* out_id, size_t* out_count);
 
 // --- High-Level Drawing API (Legacy/Helpers) ---
 
@@ -14,12 +14,21 @@
 #include <stdint.h>
 #include <math.h>
 
-#define SCENE_ARENA_SIZE (4 * 1024 * 1024)
-#define MAX_UI_NODES 16384
-#define MAX_BATCHES 4096
+#define SCENE_ARENA_RESERVE ((size_t)256 * 1024 * 1024) // Committed on demand
+#define UI_NODES_INITIAL_CAPACITY 16384 // Grows on demand
+#define DRAW_LISTS_INITIAL_CAPACITY 16 // Grows on demand
+#define DRAW_LIST_INITIAL_CAPACITY 64
 
 // --- Scene Struct Definition ---
 
+// Batches sharing a draw_list_id, in push order
+typedef struct SceneDrawList {
+    StringId id;
+    RenderBatch* batches;
+    size_t count;
+    size_t capacity;
+} SceneDrawList;
+
 struct Scene {
     MemoryArena arena;
     SceneCamera camera;
@@ -29,9 +38,11 @@ struct Scene {
     size_t ui_count;
     size_t ui_capacity;
     
-    RenderBatch* batches;
-    size_t batch_count;
-    size_t batch_capacity;
+    SceneDrawList* draw_lists;
+    size_t draw_list_count;
+    size_t draw_list_capacity;
+    size_t last_draw_list; // Consecutive pushes usually target the same list
+    size_t batch_count;    // Across all draw lists
 };
 
 // --- System Lifecycle ---
@@ -50,7 +61,7 @@ Scene* scene_create(void) {
     Scene* scene = (Scene*)malloc(sizeof(Scene));
     if (scene) {
         memset(scene, 0, sizeof(Scene));
-        if (!arena_init(&scene->arena, SCENE_ARENA_SIZE)) {
+        if (!arena_init_virtual(&scene->arena, SCENE_ARENA_RESERVE)) {
             free(scene);
             return NULL;
         }
@@ -70,23 +81,77 @@ void scene_clear(Scene* scene) {
     if (!scene) return;
     arena_reset(&scene->arena);
     
-    scene->ui_nodes = (UiNode*)arena_alloc(&scene->arena, sizeof(UiNode) * MAX_UI_NODES);
-    scene->ui_capacity = MAX_UI_NODES;
+    scene->ui_nodes = (UiNode*)arena_alloc(&scene->arena, sizeof(UiNode) * UI_NODES_INITIAL_CAPACITY);
+    scene->ui_capacity = scene->ui_nodes ? UI_NODES_INITIAL_CAPACITY : 0;
     scene->ui_count = 0;
     
-    scene->batches = (RenderBatch*)arena_alloc(&scene->arena, sizeof(RenderBatch) * MAX_BATCHES);
-    scene->batch_capacity = MAX_BATCHES;
+    // Lists and their batches lived in the arena
+    scene->draw_lists = NULL;
+    scene->draw_list_count = 0;
+    scene->draw_list_capacity = 0;
+    scene->last_draw_list = 0;
     scene->batch_count = 0;
 }
 
+// Doubles a frame array inside the scene arena (the old block is reclaimed on scene_clear).
+// Returns the new block, or NULL with 'capacity' untouched.
+static void* scene_grow_array(Scene* scene, const void* data, size_t* capacity, size_t count, size_t element_size, size_t initial) {
+    size_t new_cap = *capacity ? *capacity * 2 : initial;
+    void* grown = arena_alloc(&scene->arena, element_size * new_cap);
+    if (!grown) return NULL;
+    if (count > 0) memcpy(grown, data, element_size * count);
+    *capacity = new_cap;
+    return grown;
+}
+
 void scene_push_ui_node(Scene* scene, UiNode node) {
-    if (!scene || scene->ui_count >= scene->ui_capacity) return;
+    if (!scene) return;
+    if (scene->ui_count == scene->ui_capacity) {
+        UiNode* grown = scene_grow_array(scene, scene->ui_nodes, &scene->ui_capacity, scene->ui_count, sizeof(UiNode), UI_NODES_INITIAL_CAPACITY);
+        if (!grown) return;
+        scene->ui_nodes = grown;
+    }
     scene->ui_nodes[scene->ui_count++] = node;
 }
 
+static SceneDrawList* scene_find_draw_list(Scene* scene, StringId id, bool create) {
+    if (scene->last_draw_list < scene->draw_list_count && scene->draw_lists[scene->last_draw_list].id == id) {
+        return &scene->draw_lists[scene->last_draw_list];
+    }
+    for (size_t i = 0; i < scene->draw_list_count; ++i) {
+        if (scene->draw_lists[i].id == id) {
+            scene->last_draw_list = i;
+            return &scene->draw_lists[i];
+        }
+    }
+    if (!create) return NULL;
+
+    if (scene->draw_list_count == scene->draw_list_capacity) {
+        SceneDrawList* grown = scene_grow_array(scene, scene->draw_lists, &scene->draw_list_capacity, scene->draw_list_count, sizeof(SceneDrawList), DRAW_LISTS_INITIAL_CAPACITY);
+        if (!grown) return NULL;
+        scene->draw_lists = grown;
+    }
+
+    scene->last_draw_list = scene->draw_list_count;
+    SceneDrawList* list = &scene->draw_lists[scene->draw_list_count++];
+    *list = (SceneDrawList){ .id = id };
+    return list;
+}
+
 void scene_push_render_batch(Scene* scene, RenderBatch batch) {
-    if (!scene || scene->batch_count >= scene->batch_capacity) return;
-    scene->batches[scene->batch_count++] = batch;
+    if (!scene) return;
+
+    SceneDrawList* list = scene_find_draw_list(scene, batch.draw_list_id, true);
+    if (!list) return;
+
+    if (list->count == list->capacity) {
+        RenderBatch* grown = scene_grow_array(scene, list->batches, &list->capacity, list->count, sizeof(RenderBatch), DRAW_LIST_INITIAL_CAPACITY);
+        if (!grown) return;
+        list->batches = grown;
+    }
+
+    list->batches[list->count++] = batch;
+    scene->batch_count++;
 }
 
 void scene_set_camera(Scene* scene, SceneCamera camera) {
@@ -113,10 +178,28 @@ const UiNode* scene_get_ui_nodes(const Scene* scene, size_t* out_count) {
     return scene->ui_nodes;
 }
 
-const RenderBatch* scene_get_render_batches(const Scene* scene, size_t* out_count) {
-    if (!scene) { if (out_count) *out_count = 0; return NULL; }
-    if (out_count) *out_count = scene->batch_count;
-    return scene->batches;
+const RenderBatch* scene_get_draw_list(const Scene* scene, StringId draw_list_id, size_t* out_count) {
+    if (out_count) *out_count = 0;
+    if (!scene) return NULL;
+    for (size_t i = 0; i < scene->draw_list_count; ++i) {
+        if (scene->draw_lists[i].id == draw_list_id) {
+            if (out_count) *out_count = scene->draw_lists[i].count;
+            return scene->draw_lists[i].batches;
+        }
+    }
+    return NULL;
+}
+
+size_t scene_get_draw_list_count(const Scene* scene) {
+    return scene ? scene->draw_list_count : 0;
+}
+
+const RenderBatch* scene_get_draw_list_at(const Scene* scene, size_t index, StringId* out_id, size_t* out_count) {
+    if (out_count) *out_count = 0;
+    if (!scene || index >= scene->draw_list_count) return NULL;
+    if (out_id) *out_id = scene->draw_lists[index].id;
+    if (out_count) *out_count = scene->draw_lists[index].count;
+    return scene->draw_lists[index].batches;
 }
 
 // --- High-Level Drawing API (Adapted to UiNode) ---
@@ -251,14 +334,44 @@ void scene_node_clear_children(SceneNode* parent, SceneTree* tree) {
     scene_internal_node_clear_children(parent, tree);
 }
 
-void scene_node_update_transforms(SceneNode* node, const Mat4* parent_world) {
-    scene_internal_node_update_transforms(node, parent_world);
+void scene_node_set_local_position(SceneNode* node, Vec3 position) {
+    if (!node) return;
+    node->transform.local_position = position;
+    scene_internal_node_mark_dirty(node);
+}
+
+void scene_node_set_local_rotation(SceneNode* node, Vec3 euler_radians) {
+    if (!node) return;
+    node->transform.local_rotation = euler_radians;
+    scene_internal_node_mark_dirty(node);
+}
+
+void scene_node_set_local_scale(SceneNode* node, Vec3 scale) {
+    if (!node) return;
+    node->transform.local_scale = scale;
+    scene_internal_node_mark_dirty(node);
+}
+
+void scene_node_mark_transform_dirty(SceneNode* node) {
+    scene_internal_node_mark_dirty(node);
+}
+
+void scene_node_mark_layout_dirty(SceneNode* node) {
+    scene_internal_node_mark_layout_dirty(node);
+}
+
+size_t scene_node_update_transforms(SceneNode* node, const Mat4* parent_world) {
+    return scene_internal_node_update_transforms(node, parent_world);
 }
 
 SceneNode* scene_node_find_by_id(SceneNode* root, const char* id) {
     return scene_internal_node_find_by_id(root, id);
 }
 
+SceneNode* scene_node_find(SceneNode* root, StringId id) {
+    return scene_internal_node_find(root, id);
+}
+
 // --- Accessors ---
 
 StringId scene_node_get_id(const SceneNode* node) {
@@ -275,4 +388,12 @@ SceneNode* scene_node_get_parent(const SceneNode* node) {
 
 const struct MetaStruct* scene_node_get_meta(const SceneNode* node) {
     return node ? node->meta : NULL;
+}
+
+const Mat4* scene_node_get_world_matrix(const SceneNode* node) {
+    return node ? &node->world_matrix : NULL;
+}
+
+uint32_t scene_node_get_world_version(const SceneNode* node) {
+    return node ? node->world_version : 0;
 }
\ No newline at end of file
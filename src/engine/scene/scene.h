@@ -32,11 +32,27 @@ void scene_node_remove_child(SceneNode* parent, SceneNode* child);
 void scene_node_clear_children(SceneNode* parent, SceneTree* tree);
 
 // Transform & Update
-void scene_node_update_transforms(SceneNode* node, const Mat4* parent_world);
+// Setters only mark the node dirty. scene_node_update_transforms then recomputes just the
+// dirty subtrees and returns how many world matrices changed (0 = nothing moved).
+// 'parent_world' is applied when 'node' itself is recomputed; if it changes, mark 'node' dirty.
+void scene_node_set_local_position(SceneNode* node, Vec3 position);
+void scene_node_set_local_rotation(SceneNode* node, Vec3 euler_radians);
+void scene_node_set_local_scale(SceneNode* node, Vec3 scale);
+void scene_node_mark_transform_dirty(SceneNode* node);
+size_t scene_node_update_transforms(SceneNode* node, const Mat4* parent_world);
+
+// Flags the node for re-layout (UI layout is incremental, see ui_system_layout).
+void scene_node_mark_layout_dirty(SceneNode* node);
+
+// World-changed signal: the version increments each time the world matrix is recomputed,
+// so consumers (layout, render extraction) compare against the version they last saw.
+const Mat4* scene_node_get_world_matrix(const SceneNode* node);
+uint32_t scene_node_get_world_version(const SceneNode* node);
 
 // Accessors
 StringId scene_node_get_id(const SceneNode* node);
 SceneNode* scene_node_find_by_id(SceneNode* root, const char* id);
+SceneNode* scene_node_find(SceneNode* root, StringId id); // Prefer with STR_ID("literal")
 void* scene_node_get_data(const SceneNode* node);
 SceneNode* scene_node_get_parent(const SceneNode* node);
 const struct MetaStruct* scene_node_get_meta(const SceneNode* node);
@@ -16,6 +16,7 @@ typedef enum SceneFlags {
     SCENE_FLAG_HIDDEN      = 1 << 0,
     SCENE_FLAG_DIRTY       = 1 << 1, // Transform needs update
     SCENE_FLAG_CLIPPED     = 1 << 2,
+    SCENE_FLAG_CHILD_DIRTY = 1 << 3, // Some descendant's transform needs update
     
     SCENE_FLAG_SYSTEM_BIT  = 1 << 8
 } SceneFlags; // REFLECT
@@ -31,7 +32,11 @@ typedef enum SceneInteractionFlags {
 typedef enum UiFlags {
     UI_FLAG_NONE       = 0,
     UI_FLAG_SCROLLABLE = 1 << 0,
-    UI_FLAG_EDITABLE   = 1 << 1
+    UI_FLAG_EDITABLE   = 1 << 1,
+    UI_FLAG_LAYOUT_DIRTY       = 1 << 2, // Size/content/children changed
+    UI_FLAG_LAYOUT_CHILD_DIRTY = 1 << 3, // Some descendant needs layout
+    UI_FLAG_LAYOUT_VISITED     = 1 << 4, // Laid out this frame, screen rect pending
+    UI_FLAG_BOUNDS_VALID       = 1 << 5  // subtree_bounds is finite, subtree may be culled
 } UiFlags; // REFLECT
 
 typedef enum SceneNodeKind {
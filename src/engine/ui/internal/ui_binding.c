@@ -35,6 +35,12 @@ UiBindingTarget ui_resolve_target_enum(const char* target) {
     return BINDING_TARGET_NONE;
 }
 
+static void set_layout_float(SceneNode* el, float* field, float value) {
+    if (*field == value) return;
+    *field = value;
+    scene_node_mark_layout_dirty(el);
+}
+
 void ui_apply_binding_value(SceneNode* el, UiBinding* b) {
     void* ptr = (char*)scene_node_get_data(el) + b->source_offset;
     const MetaField* f = b->source_field;
@@ -61,6 +67,7 @@ void ui_apply_binding_value(SceneNode* el, UiBinding* b) {
             if (strncmp(el->cached_text, buf, 128) != 0) {
                 strncpy(el->cached_text, buf, 127);
                 el->cached_text[127] = '\0';
+                scene_node_mark_layout_dirty(el); // Auto-sized text may change width
             }
             break;
         }
@@ -69,21 +76,23 @@ void ui_apply_binding_value(SceneNode* el, UiBinding* b) {
             if (f->type == META_TYPE_BOOL) vis = *(bool*)ptr;
             else if (f->type == META_TYPE_INT) vis = (*(int*)ptr) != 0;
             
+            bool was_visible = !(el->flags & SCENE_FLAG_HIDDEN);
             if (vis) el->flags &= ~SCENE_FLAG_HIDDEN;
             else el->flags |= SCENE_FLAG_HIDDEN;
+            if (vis != was_visible) scene_node_mark_layout_dirty(el);
             break;
         }
         case BINDING_TARGET_LAYOUT_X:
-            if (f->type == META_TYPE_FLOAT) el->desired_x = *(float*)ptr;
+            if (f->type == META_TYPE_FLOAT) set_layout_float(el, &el->desired_x, *(float*)ptr);
             break;
         case BINDING_TARGET_LAYOUT_Y:
-            if (f->type == META_TYPE_FLOAT) el->desired_y = *(float*)ptr;
+            if (f->type == META_TYPE_FLOAT) set_layout_float(el, &el->desired_y, *(float*)ptr);
             break;
         case BINDING_TARGET_LAYOUT_WIDTH:
-            if (f->type == META_TYPE_FLOAT) el->rect.w = *(float*)ptr;
+            if (f->type == META_TYPE_FLOAT) set_layout_float(el, &el->rect.w, *(float*)ptr);
             break;
         case BINDING_TARGET_LAYOUT_HEIGHT:
-            if (f->type == META_TYPE_FLOAT) el->rect.h = *(float*)ptr;
+            if (f->type == META_TYPE_FLOAT) set_layout_float(el, &el->rect.h, *(float*)ptr);
             break;
         case BINDING_TARGET_STYLE_COLOR:
             if (f->type == META_TYPE_VEC4) el->render_color = *(Vec4*)ptr;
@@ -4,6 +4,7 @@
 #include "foundation/logger/logger.h"
 #include "foundation/meta/reflection.h"
 #include "engine/input/input.h"
+#include "engine/scene/scene.h"
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -118,7 +119,8 @@ static void handle_scroll_event(UiInputContext* ctx, const InputEvent* event) {
             if (max_scroll_x < 0) max_scroll_x = 0;
             if (target->scroll_x < 0) target->scroll_x = 0;
             if (target->scroll_x > max_scroll_x) target->scroll_x = max_scroll_x;
-            
+
+            scene_node_mark_layout_dirty(target); // Children move
             break; // Handled
         }
         target = target->parent;
@@ -292,6 +294,8 @@ static void handle_drag_logic(UiInputContext* ctx, const InputSystem* input) {
              if (max_scroll_x < 0) max_scroll_x = 0;
              if (ctx->active->scroll_x < 0) ctx->active->scroll_x = 0;
              if (ctx->active->scroll_x > max_scroll_x) ctx->active->scroll_x = max_scroll_x;
+
+             scene_node_mark_layout_dirty(ctx->active);
         }
         
         if (changed) {
@@ -2,16 +2,76 @@
 #include "../ui_core.h"
 #include "ui_internal.h"
 #include "foundation/logger/logger.h"
+#include "foundation/string/string_id.h"
 #include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include <math.h>
 
 #define UI_DEFAULT_WIDTH 100.0f
 #define UI_DEFAULT_HEIGHT 30.0f
 #define UI_CHAR_WIDTH_EST 10.0f
 #define UI_INFINITY 10000.0f
 
+#define UI_LAYOUT_DIRTY_MASK (UI_FLAG_LAYOUT_DIRTY | UI_FLAG_LAYOUT_CHILD_DIRTY)
+
+static bool s_incremental = true;
+
+void ui_layout_set_incremental(bool enabled) {
+    s_incremental = enabled;
+}
+
+// --- Text Measure Cache ---
+// Direct-mapped, keyed by (text, measure func, font/user data, scale). Text is stored
+// so hash collisions can't return a wrong size; longer strings are measured uncached.
+
+#define UI_MEASURE_CACHE_SIZE 512 // Power of 2
+#define UI_MEASURE_MAX_TEXT 128
+
+typedef struct UiMeasureEntry {
+    UiTextMeasureFunc func;
+    void* data;
+    float scale;
+    uint32_t hash;
+    Vec2 size;
+    char text[UI_MEASURE_MAX_TEXT];
+} UiMeasureEntry;
+
+static UiMeasureEntry s_measure_cache[UI_MEASURE_CACHE_SIZE];
+
+void ui_layout_clear_measure_cache(void) {
+    memset(s_measure_cache, 0, sizeof(s_measure_cache));
+}
+
+static Vec2 measure_text_cached(const char* text, float scale, UiTextMeasureFunc func, void* data) {
+    size_t len = strlen(text);
+    if (len >= UI_MEASURE_MAX_TEXT) return func(text, scale, data);
+
+    // FNV-1a over the text, then the rest of the key (not str_id: that registers in Debug)
+    uint32_t hash = STR_ID_FNV_OFFSET;
+    for (size_t i = 0; i < len; ++i) {
+        hash = (hash ^ (uint8_t)text[i]) * STR_ID_FNV_PRIME;
+    }
+    uint32_t scale_bits;
+    memcpy(&scale_bits, &scale, sizeof(scale_bits));
+    uint32_t key = hash ^ scale_bits ^ (uint32_t)((uintptr_t)data >> 4);
+
+    UiMeasureEntry* entry = &s_measure_cache[key & (UI_MEASURE_CACHE_SIZE - 1)];
+    if (entry->func == func && entry->data == data && entry->scale == scale &&
+        entry->hash == hash && strcmp(entry->text, text) == 0) {
+        return entry->size;
+    }
+
+    entry->func = func;
+    entry->data = data;
+    entry->scale = scale;
+    entry->hash = hash;
+    entry->size = func(text, scale, data);
+    memcpy(entry->text, text, len + 1);
+    return entry->size;
+}
+
 static float calculate_width(SceneNode* el, float available_w, UiTextMeasureFunc measure_func, void* measure_data) {
     const SceneNodeSpec* spec = el->spec;
     float w = spec->layout.width;
@@ -29,7 +89,7 @@ static float calculate_width(SceneNode* el, float available_w, UiTextMeasureFunc
 
              if (text && text[0] != '\0') {
                  if (measure_func) {
-                     w = measure_func(text, 0.5f, measure_data).x + spec->layout.padding * 2;
+                     w = measure_text_cached(text, 0.5f, measure_func, measure_data).x + spec->layout.padding * 2;
                  } else {
                      w = strlen(text) * UI_CHAR_WIDTH_EST + spec->layout.padding * 2 + UI_CHAR_WIDTH_EST;
                  }
@@ -141,8 +201,18 @@ static void layout_split_v(SceneNode* el, float start_x, float start_y) {
     c2->rect.y = start_y + c1->rect.h;
 }
 
-static void layout_recursive(SceneNode* el, Rect available, uint64_t frame_number, bool log_debug, UiTextMeasureFunc measure_func, void* measure_data) {
-    if (!el || !el->spec) return;
+static size_t layout_recursive(SceneNode* el, Rect available, uint64_t frame_number, bool log_debug, UiTextMeasureFunc measure_func, void* measure_data) {
+    if (!el || !el->spec) return 0;
+
+    // 0. Clean subtree offered the same space: last frame's rects are still valid
+    if (s_incremental && !(el->ui_flags & UI_LAYOUT_DIRTY_MASK) &&
+        available.w == el->layout_avail_w && available.h == el->layout_avail_h) {
+        return 0;
+    }
+    el->layout_avail_w = available.w;
+    el->layout_avail_h = available.h;
+    el->ui_flags = (el->ui_flags & ~(uint32_t)UI_LAYOUT_DIRTY_MASK) | UI_FLAG_LAYOUT_VISITED;
+    size_t visited = 1;
     
     if (el->flags & SCENE_FLAG_HIDDEN) {
         el->rect.w = 0;
@@ -182,7 +252,7 @@ static void layout_recursive(SceneNode* el, Rect available, uint64_t frame_numbe
              else child_avail.h = content.h * (1.0f - ratio);
         }
 
-        layout_recursive(child, child_avail, frame_number, log_debug, measure_func, measure_data);
+        visited += layout_recursive(child, child_avail, frame_number, log_debug, measure_func, measure_data);
         i++;
     }
 
@@ -222,28 +292,63 @@ static void layout_recursive(SceneNode* el, Rect available, uint64_t frame_numbe
             break;
         default: break;
     }
+    return visited;
 }
 
-static void update_screen_rects(SceneNode* el, float parent_x, float parent_y) {
+// Own rect plus visible children. Content not confined to the rect (overlays are drawn
+// in a later pass, curves take endpoints from data) leaves the bounds invalid up the chain.
+static void update_subtree_bounds(SceneNode* el) {
+    bool bounded = el->spec && el->spec->layout.layer != SCENE_LAYER_OVERLAY &&
+                   el->spec->style.render_mode != SCENE_RENDER_MODE_BEZIER;
+    Rect bounds = el->screen_rect;
+
+    for (SceneNode* child = el->first_child; child && bounded; child = child->next_sibling) {
+        if (child->flags & SCENE_FLAG_HIDDEN) continue;
+        if (!(child->ui_flags & UI_FLAG_BOUNDS_VALID)) {
+            bounded = false;
+            break;
+        }
+        Rect cb = child->subtree_bounds;
+        float x2 = fmaxf(bounds.x + bounds.w, cb.x + cb.w);
+        float y2 = fmaxf(bounds.y + bounds.h, cb.y + cb.h);
+        bounds.x = fminf(bounds.x, cb.x);
+        bounds.y = fminf(bounds.y, cb.y);
+        bounds.w = x2 - bounds.x;
+        bounds.h = y2 - bounds.y;
+    }
+
+    el->subtree_bounds = bounds;
+    if (bounded) el->ui_flags |= UI_FLAG_BOUNDS_VALID;
+    else el->ui_flags &= ~(uint32_t)UI_FLAG_BOUNDS_VALID;
+}
+
+// Descends only into nodes laid out this frame or whose absolute position changed.
+static void update_screen_rects(SceneNode* el, float parent_x, float parent_y, bool force) {
     if (!el) return;
-    
-    el->screen_rect.x = parent_x + el->rect.x;
-    el->screen_rect.y = parent_y + el->rect.y;
-    el->screen_rect.w = el->rect.w;
-    el->screen_rect.h = el->rect.h;
+
+    Rect screen = { parent_x + el->rect.x, parent_y + el->rect.y, el->rect.w, el->rect.h };
+    bool moved = force || screen.x != el->screen_rect.x || screen.y != el->screen_rect.y ||
+                 screen.w != el->screen_rect.w || screen.h != el->screen_rect.h;
+    bool visited = (el->ui_flags & UI_FLAG_LAYOUT_VISITED) != 0;
+    if (!moved && !visited) return;
+
+    el->screen_rect = screen;
+    el->ui_flags &= ~(uint32_t)UI_FLAG_LAYOUT_VISITED;
 
     for (SceneNode* child = el->first_child; child; child = child->next_sibling) {
-        update_screen_rects(child, el->screen_rect.x, el->screen_rect.y);
+        update_screen_rects(child, el->screen_rect.x, el->screen_rect.y, moved);
     }
+    update_subtree_bounds(el);
 }
 
-void ui_layout_root(SceneNode* root, float window_w, float window_h, uint64_t frame_number, bool log_debug, UiTextMeasureFunc measure_func, void* measure_data) {
-    if (!root) return;
+size_t ui_layout_root(SceneNode* root, float window_w, float window_h, uint64_t frame_number, bool log_debug, UiTextMeasureFunc measure_func, void* measure_data) {
+    if (!root) return 0;
     
     if (root->spec->layout.width < 0) root->rect.w = window_w;
     if (root->spec->layout.height < 0) root->rect.h = window_h;
     
     Rect initial_avail = {0, 0, window_w, window_h};
-    layout_recursive(root, initial_avail, frame_number, log_debug, measure_func, measure_data);
-    update_screen_rects(root, 0, 0);
+    size_t visited = layout_recursive(root, initial_avail, frame_number, log_debug, measure_func, measure_data);
+    update_screen_rects(root, 0, 0, !s_incremental);
+    return visited;
 }
@@ -10,6 +10,14 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-void ui_layout_root(SceneNode* root, float window_w, float window_h, uint64_t frame_number, bool log_debug, UiTextMeasureFunc measure_func, void* measure_data);
+// Lays out the tree incrementally: only nodes flagged UI_FLAG_LAYOUT_DIRTY (or offered a
+// different size) and their ancestors are processed. Returns the number of nodes laid out.
+size_t ui_layout_root(SceneNode* root, float window_w, float window_h, uint64_t frame_number, bool log_debug, UiTextMeasureFunc measure_func, void* measure_data);
+
+// Disable to lay out the whole tree every frame (debugging).
+void ui_layout_set_incremental(bool enabled);
+
+// Drop cached text sizes (e.g. after a font reload).
+void ui_layout_clear_measure_cache(void);
 
 #endif // UI_LAYOUT_H
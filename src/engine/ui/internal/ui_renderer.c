@@ -8,7 +8,9 @@
 #include "engine/text/font.h" 
 #include "engine/assets/assets.h"
 #include "foundation/memory/arena.h"
+#include "foundation/memory/scratch.h"
 #include "foundation/meta/reflection.h"
+#include "foundation/profiler/profiler.h"
 #include "engine/graphics/render_system.h"
 #include "engine/graphics/stream.h"
 #include "engine/graphics/graphics_types.h"
@@ -26,8 +28,41 @@ typedef struct {
 
 static SceneProviderEntry s_providers[MAX_UI_PROVIDERS];
 static int s_provider_count = 0;
-static Stream* s_ui_instance_stream = NULL;
-static size_t s_ui_instance_capacity = 0;
+static UiRenderStats s_last_stats = {0};
+
+// --- Frame Rings ---
+// Persistently mapped streams split into RENDER_FRAMES_IN_FLIGHT regions, one per frame
+// slot. A frame writes the region of the slot render_system_begin_frame waited on, so the
+// CPU never touches data the GPU may still read.
+// A CPU shadow of each region lets a static UI skip rewriting unchanged elements.
+// Two rings: compact instances and the clip-rect table they index.
+
+#define UI_INSTANCE_MIN_CAPACITY 1024
+#define UI_CLIP_MIN_CAPACITY 64
+#define UI_RING_RETIRED_MAX (RENDER_FRAMES_IN_FLIGHT + 1)
+
+typedef struct UiGpuRing {
+    Stream* stream;
+    size_t element_size;
+    uint8_t* mapped;             // NULL: backend can't map, dirty spans are uploaded
+    uint8_t* shadow;             // Last contents written to each region
+    size_t capacity;             // Elements per region
+    bool region_valid[RENDER_FRAMES_IN_FLIGHT];
+
+    // Region being written this frame
+    size_t base;
+    size_t dirty_first;
+    size_t dirty_last;
+
+    // Streams replaced on growth, destroyed once no in-flight frame can reference them
+    struct {
+        Stream* stream;
+        uint32_t frames_left;
+    } retired[UI_RING_RETIRED_MAX];
+} UiGpuRing;
+
+static UiGpuRing s_instance_ring = { .element_size = sizeof(GpuUiInstance) };
+static UiGpuRing s_clip_ring = { .element_size = sizeof(Vec4) };
 
 void ui_render_pass(RenderSystem* sys, const PipelinePassDef* pass_def);
 
@@ -36,121 +71,242 @@ void ui_renderer_init(RenderSystem* rs) {
     render_system_register_pass(rs, "RenderUI", ui_render_pass);
 }
 
-void ui_renderer_extract(Scene* scene, RenderSystem* rs) {
+static void ring_retire(UiGpuRing* ring, Stream* stream) {
+    for (int i = 0; i < UI_RING_RETIRED_MAX; ++i) {
+        if (!ring->retired[i].stream) {
+            ring->retired[i].stream = stream;
+            ring->retired[i].frames_left = RENDER_FRAMES_IN_FLIGHT;
+            return;
+        }
+    }
+    stream_destroy(stream); // Unreachable with at most one growth per frame
+}
 
-    if (!scene || !rs) return;
+static void ring_collect_retired(UiGpuRing* ring) {
+    for (int i = 0; i < UI_RING_RETIRED_MAX; ++i) {
+        if (ring->retired[i].stream && ring->retired[i].frames_left-- == 0) {
+            stream_destroy(ring->retired[i].stream);
+            ring->retired[i].stream = NULL;
+        }
+    }
+}
+
+static bool ring_reserve(UiGpuRing* ring, RenderSystem* rs, size_t count, size_t min_capacity) {
+    if (count <= ring->capacity && ring->stream) return true;
+
+    size_t new_cap = ring->capacity ? ring->capacity : min_capacity;
+    while (new_cap < count) new_cap *= 2;
+
+    uint8_t* shadow = realloc(ring->shadow, new_cap * RENDER_FRAMES_IN_FLIGHT * ring->element_size);
+    if (!shadow) return false;
+    ring->shadow = shadow;
+
+    Stream* stream = stream_create_mapped(rs, STREAM_CUSTOM, new_cap * RENDER_FRAMES_IN_FLIGHT, ring->element_size);
+    if (!stream) return false;
+
+    if (ring->stream) ring_retire(ring, ring->stream);
+    ring->stream = stream;
+    ring->mapped = (uint8_t*)stream_get_mapped(stream);
+    ring->capacity = new_cap;
+    memset(ring->region_valid, 0, sizeof(ring->region_valid));
+
+    LOG_INFO("UI Renderer: Ring grown to %zu x %d elements of %zu bytes (%s)",
+        new_cap, RENDER_FRAMES_IN_FLIGHT, ring->element_size, ring->mapped ? "mapped" : "upload");
+    return true;
+}
+
+static void ring_begin(UiGpuRing* ring, uint32_t region) {
+    ring->base = (size_t)region * ring->capacity;
+    ring->dirty_first = SIZE_MAX;
+    ring->dirty_last = 0;
+}
+
+// Writes element i of the current region unless the region already holds the same bytes.
+static void ring_write(UiGpuRing* ring, uint32_t region, size_t index, const void* element) {
+    size_t offset = (ring->base + index) * ring->element_size;
+    uint8_t* shadow = ring->shadow + offset;
+    if (ring->region_valid[region] && memcmp(shadow, element, ring->element_size) == 0) return;
+
+    memcpy(shadow, element, ring->element_size);
+    if (ring->mapped) memcpy(ring->mapped + offset, element, ring->element_size);
+    if (index < ring->dirty_first) ring->dirty_first = index;
+    if (index > ring->dirty_last) ring->dirty_last = index;
+}
+
+static void ring_end(UiGpuRing* ring, uint32_t region) {
+    ring->region_valid[region] = true;
+    if (ring->mapped || ring->dirty_first == SIZE_MAX) return;
+
+    size_t first = ring->base + ring->dirty_first;
+    stream_set_data_range(ring->stream, ring->shadow + first * ring->element_size, first,
+                          ring->dirty_last - ring->dirty_first + 1);
+}
+
+static void ring_release(UiGpuRing* ring) {
+    for (int i = 0; i < UI_RING_RETIRED_MAX; ++i) {
+        stream_destroy(ring->retired[i].stream);
+    }
+    stream_destroy(ring->stream);
+    free(ring->shadow);
+
+    size_t element_size = ring->element_size;
+    memset(ring, 0, sizeof(*ring));
+    ring->element_size = element_size;
+}
+
+void ui_renderer_shutdown(void) {
+    ring_release(&s_instance_ring);
+    ring_release(&s_clip_ring);
+}
+
+// --- Instance Packing ---
+
+// Clip rects repeat for every node inside a container; dedupe them into the table.
+#define UI_CLIP_CACHE_SIZE 64 // Power of 2
+#define UI_MAX_INSTANCE_CLIPS (1u << 24) // Clip index bits in GpuUiInstance.mode_clip
+
+typedef struct UiClipTable {
+    Vec4* rects;
+    uint32_t count;
+    uint32_t capacity;
+    struct { Vec4 rect; uint32_t index; bool used; } cache[UI_CLIP_CACHE_SIZE];
+} UiClipTable;
+
+static uint32_t clip_table_index(UiClipTable* table, Rect clip) {
+    Vec4 rect = {clip.x, clip.y, clip.w, clip.h};
+    uint32_t bits[4];
+    memcpy(bits, &rect, sizeof(bits));
+    uint32_t hash = (bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u) ^ (bits[3] * 2654435761u);
+    hash = (hash ^ (hash >> 16)) & (UI_CLIP_CACHE_SIZE - 1);
+    if (table->cache[hash].used && memcmp(&table->cache[hash].rect, &rect, sizeof(rect)) == 0) {
+        return table->cache[hash].index;
+    }
+    if (table->count == table->capacity) return 0; // Table sized for the worst case; not reached
+
+    uint32_t index = table->count++;
+    table->rects[index] = rect;
+    table->cache[hash].rect = rect;
+    table->cache[hash].index = index;
+    table->cache[hash].used = true;
+    return index;
+}
+
+static void build_instance(const UiNode* node, uint32_t clip_index, GpuUiInstance* inst) {
+    // --- Packing Params ---
+    // Same meaning as the params the fragment shader reads; see ui_default.vert for decoding.
+    Vec4 params_1 = {(float)node->primitive_type, node->corner_radius, node->border_width, 0.0f};
+    Vec4 slice = {0};
+
+    if (node->primitive_type == SCENE_MODE_9_SLICE) {
+        params_1.z = node->texture_size.x;
+        params_1.w = node->texture_size.y;
+        slice = node->slice_borders;
+    } else if (node->primitive_type == SCENE_PRIM_CURVE) {
+        // Control points travel in the UV rect (scene_push_curve stores them in both)
+        params_1.y = 1.0f;
+        if (node->rect.h > 0) params_1.w = node->rect.w / node->rect.h;
+    }
+
+    inst->x = node->rect.x;
+    inst->y = node->rect.y;
+    inst->w = node->rect.w;
+    inst->h = node->rect.h;
+    inst->z = node->z_index;
+    inst->color = math_pack_unorm4x8(node->color);
+    inst->uv_min = math_pack_unorm2x16(node->uv_rect.x, node->uv_rect.y);
+    inst->uv_size = math_pack_unorm2x16(node->uv_rect.z, node->uv_rect.w);
+    inst->mode_clip = (node->primitive_type & 0xFFu) | (clip_index << 8);
+    inst->params_a = math_pack_half2(params_1.y, params_1.z);
+    inst->params_b = math_pack_half2(params_1.w, 0.0f);
+    // 9-slice borders are whole pixels
+    inst->slice = math_pack_unorm4x8((Vec4){slice.x / 255.0f, slice.y / 255.0f, slice.z / 255.0f, slice.w / 255.0f});
+}
+
+static void extract_batch(Scene* scene, RenderSystem* rs) {
+    ring_collect_retired(&s_instance_ring);
+    ring_collect_retired(&s_clip_ring);
 
     size_t count = 0;
     const UiNode* nodes = scene_get_ui_nodes(scene, &count);
     if (count == 0) return;
 
-    if (count > 0) {
-        LOG_TRACE("UI Extract: Processing %zu nodes. First: [%.1f, %.1f] %gx%g", count, nodes[0].rect.x, nodes[0].rect.y, nodes[0].rect.w, nodes[0].rect.h);
+    LOG_TRACE("UI Extract: Processing %zu nodes. First: [%.1f, %.1f] %gx%g", count, nodes[0].rect.x, nodes[0].rect.y, nodes[0].rect.w, nodes[0].rect.h);
+
+    if (count > UI_MAX_INSTANCE_CLIPS) count = UI_MAX_INSTANCE_CLIPS;
+
+    // 1. Dedupe clip rects (worst case: one per node)
+    Scratch scratch = scratch_begin(NULL, 0);
+    UiClipTable* clips = arena_alloc_zero(scratch.arena, sizeof(UiClipTable));
+    uint32_t* clip_indices = arena_alloc(scratch.arena, count * sizeof(uint32_t));
+    if (clips) clips->rects = arena_alloc(scratch.arena, count * sizeof(Vec4));
+    if (!clips || !clip_indices || !clips->rects) {
+        scratch_end(scratch);
+        return;
     }
-    
-    // Resize Stream if needed
-    if (count > s_ui_instance_capacity) {
-        size_t new_cap = count + 1024;
-        if (s_ui_instance_stream) {
-            stream_destroy(s_ui_instance_stream);
-        }
-        s_ui_instance_stream = stream_create(rs, STREAM_CUSTOM, new_cap, sizeof(GpuInstanceData));
-        s_ui_instance_capacity = new_cap;
-        LOG_INFO("UI Renderer: Resized Instance Stream to %zu. Stream Ptr: %p", new_cap, (void*)s_ui_instance_stream);
+    clips->capacity = (uint32_t)count;
+    for (size_t i = 0; i < count; ++i) {
+        clip_indices[i] = clip_table_index(clips, nodes[i].clip_rect);
     }
 
-    if (!s_ui_instance_stream) return;
+    if (!ring_reserve(&s_instance_ring, rs, count, UI_INSTANCE_MIN_CAPACITY) ||
+        !ring_reserve(&s_clip_ring, rs, clips->count, UI_CLIP_MIN_CAPACITY)) {
+        scratch_end(scratch);
+        return;
+    }
 
-    // Map Buffer
-    // Note: Stream assumes we use stream_set_data which copies from CPU pointer.
-    // We need a temporary CPU buffer. We can use the Scene arena or a static scratch.
-    // Given the extraction phase is single-threaded usually, malloc/free or arena is fine.
-    // Using malloc for simplicity to match previous logic, or use a scratch arena if available.
-    // Scene has an arena!
-    
-    // GpuInstanceData* instances = arena_alloc(&scene->arena, sizeof(GpuInstanceData) * count);
-    // WARNING: scene->arena is reset at start of frame. If we alloc here, it persists until next frame start.
-    // This is safe.
-    
-    // BUT ui_renderer.c doesn't have access to scene->arena directly (struct Scene is opaque in header).
-    // scene.h implies it's opaque. scene.c shows it.
-    // ui_renderer.c includes scene.h.
-    // I need to use malloc or modify scene.h to expose arena or add scene_alloc helper.
-    // Let's use malloc for now to minimize changes to Scene API, or simple stack array for small counts?
-    // No, UI can be large.
-    
-    GpuInstanceData* instances = malloc(sizeof(GpuInstanceData) * count);
-    if (!instances) return;
+    uint32_t region = render_system_get_frame_slot(rs);
 
-    for (size_t i = 0; i < count; ++i) {
-        const UiNode* node = &nodes[i];
-        GpuInstanceData* inst = &instances[i];
-        
-        // --- Transform ---
-        // Rect (x,y,w,h) -> Mat4 (Translation * Scale)
-        Mat4 s = mat4_scale((Vec3){node->rect.w, node->rect.h, 1.0f});
-        Mat4 t = mat4_translation((Vec3){node->rect.x, node->rect.y, node->z_index});
-        inst->model = mat4_multiply(&t, &s);
-        
-        inst->color = node->color;
-        inst->uv_rect = node->uv_rect;
-        
-        // --- Packing Params ---
-        inst->params_1.x = (float)node->primitive_type;
-        inst->params_1.y = node->corner_radius;
-        
-        if (node->primitive_type == SCENE_MODE_9_SLICE) {
-            inst->params_1.z = node->texture_size.x;
-            inst->params_1.w = node->texture_size.y;
-            inst->params_2 = node->slice_borders;
-        } else if (node->primitive_type == SCENE_PRIM_CURVE) {
-            inst->params_1.y = 1.0f; 
-            inst->params_2 = node->params; // (u1, v1, u2, v2)
-            inst->params_1.z = node->border_width; 
-            if (node->rect.h > 0) inst->params_1.w = node->rect.w / node->rect.h;
-        } else {
-             inst->params_1.z = node->border_width;
-             inst->params_1.w = 0.0f;
-             inst->params_2 = (Vec4){0};
-        }
-        
-        inst->clip_rect = (Vec4){node->clip_rect.x, node->clip_rect.y, node->clip_rect.w, node->clip_rect.h};
+    // 2. Write only elements that differ from what this region already holds
+    ring_begin(&s_clip_ring, region);
+    for (uint32_t i = 0; i < clips->count; ++i) {
+        ring_write(&s_clip_ring, region, i, &clips->rects[i]);
     }
+    ring_end(&s_clip_ring, region);
 
-    stream_set_data(s_ui_instance_stream, instances, count);
-    free(instances);
+    // Clip indices are absolute, so the shader needs no region offset for the table
+    uint32_t clip_base = (uint32_t)s_clip_ring.base;
+    ring_begin(&s_instance_ring, region);
+    for (size_t i = 0; i < count; ++i) {
+        GpuUiInstance inst;
+        build_instance(&nodes[i], clip_base + clip_indices[i], &inst);
+        ring_write(&s_instance_ring, region, i, &inst);
+    }
+    ring_end(&s_instance_ring, region);
+    scratch_end(scratch);
 
     // Create RenderBatch
     RenderBatch batch = {0};
     batch.pipeline_id = 0; // Default UI Pipeline
+    batch.layer_id = RENDER_LAYER_UI;
     batch.vertex_count = 6; // Quad (Indexed)
     batch.index_count = 6;
     batch.instance_count = (uint32_t)count;
-    batch.first_instance = 0;
+    batch.first_instance = (uint32_t)s_instance_ring.base; // gl_InstanceIndex includes it
     
-    batch.bind_buffers[0] = s_ui_instance_stream;
+    batch.bind_buffers[0] = s_instance_ring.stream;
     batch.bind_slots[0] = 0; // Instance Buffer Slot
-    batch.bind_count = 1;
+    batch.bind_buffers[1] = s_clip_ring.stream;
+    batch.bind_slots[1] = 1; // Clip Table Slot
+    batch.bind_count = 2;
 
-    strncpy(batch.draw_list, "UIBatches", sizeof(batch.draw_list) - 1);
+    batch.draw_list_id = STR_ID("UIBatches");
 
     // Push Batch
     scene_push_render_batch(scene, batch);
 }
 
+void ui_renderer_extract(Scene* scene, RenderSystem* rs) {
+    if (!scene || !rs) return;
+
+    PROFILE_BEGIN("ui_renderer_extract");
+    extract_batch(scene, rs);
+    PROFILE_END();
+}
+
 void ui_render_pass(RenderSystem* sys, const PipelinePassDef* pass_def) {
     if (!sys || !pass_def) return;
     
-    Scene* scene = render_system_get_drawing_scene(sys);
-    if (!scene) return;
-    
-    size_t batch_count = 0;
-    const RenderBatch* batches = scene_get_render_batches(scene, &batch_count);
-    
-    // For each draw_list tag in the pass definition, execute batches
-    for (uint32_t i = 0; i < pass_def->draw_list_count; ++i) {
-        render_system_execute_batches_with_tag(sys, batches, batch_count, pass_def->draw_lists[i]);
-    }
+    render_system_execute_draw_lists(sys, pass_def);
 }
 
 void scene_register_provider(const char* name, SceneObjectProvider callback) {
@@ -184,7 +340,8 @@ typedef struct SceneBuilderContext {
     MemoryArena* arena;
     OverlayNode* overlay_head;
     OverlayNode* overlay_tail;
-    int node_count;
+    Rect viewport;
+    UiRenderStats stats;
 } SceneBuilderContext;
 
 // Helper: Intersection
@@ -200,6 +357,12 @@ static Rect rect_intersect(Rect a, Rect b) {
     return (Rect){x1, y1, x2 - x1, y2 - y1};
 }
 
+// Inclusive, so zero-sized rects on the edge still count as visible
+static bool rect_overlaps(Rect a, Rect b) {
+    return a.x <= b.x + b.w && b.x <= a.x + a.w &&
+           a.y <= b.y + b.h && b.y <= a.y + a.h;
+}
+
 static void render_background(const SceneNode* el, SceneBuilderContext* ctx, Vec4 clip_vec, float z) {
     bool is_input = (el->ui_flags & UI_FLAG_EDITABLE);
     int mode = el->spec->style.render_mode;
@@ -242,9 +405,10 @@ static void render_background(const SceneNode* el, SceneBuilderContext* ctx, Vec
             float thickness = 2.0f;
             
             if (el->data_ptr && el->meta) {
-                const MetaField* f_start = meta_find_field(el->meta, "start");
-                const MetaField* f_end = meta_find_field(el->meta, "end");
-                const MetaField* f_thick = meta_find_field(el->meta, "thickness");
+                // Per node per frame: id lookups, no string hashing or compares
+                const MetaField* f_start = meta_find_field_by_id(el->meta, STR_ID_HASH("start"));
+                const MetaField* f_end = meta_find_field_by_id(el->meta, STR_ID_HASH("end"));
+                const MetaField* f_thick = meta_find_field_by_id(el->meta, STR_ID_HASH("thickness"));
                 
                 if (f_start && f_start->type == META_TYPE_VEC2) {
                     float* v = (float*)meta_get_field_ptr(el->data_ptr, f_start);
@@ -392,6 +556,14 @@ static void process_node(const SceneNode* el, SceneBuilderContext* ctx, Rect cur
         return; 
     }
 
+    // Cull: the whole subtree lies outside the inherited clip or the viewport
+    ctx->stats.visited++;
+    if ((el->ui_flags & UI_FLAG_BOUNDS_VALID) &&
+        (!rect_overlaps(el->subtree_bounds, current_clip) || !rect_overlaps(el->subtree_bounds, ctx->viewport))) {
+        ctx->stats.culled++;
+        return;
+    }
+
     Rect effective_clip = current_clip;
     
     if (is_node_overlay) {
@@ -402,7 +574,7 @@ static void process_node(const SceneNode* el, SceneBuilderContext* ctx, Rect cur
         effective_clip = rect_intersect(effective_clip, el->screen_rect);
     }
     
-    ctx->node_count++;
+    ctx->stats.emitted++;
     Vec4 clip_vec = {effective_clip.x, effective_clip.y, effective_clip.w, effective_clip.h};
 
     render_background(el, ctx, clip_vec, base_z);
@@ -414,6 +586,7 @@ static void process_node(const SceneNode* el, SceneBuilderContext* ctx, Rect cur
             // Map SceneNode to RenderBatch
             // batch.pipeline_id = ... (Default 3D)
             batch.mesh = (struct Mesh*)mesh; 
+            batch.layer_id = RENDER_LAYER_WORLD;
             batch.instance_count = 1;
             batch.first_instance = 0;
             // Need to pass transform
@@ -457,6 +630,7 @@ void scene_tree_render(SceneTree* instance, Scene* scene, const Assets* assets,
     ctx.assets = assets;
     ctx.font = assets_get_font(assets);
     ctx.arena = arena;
+    ctx.viewport = (instance->viewport.w > 0 && instance->viewport.h > 0) ? instance->viewport : infinite_clip;
     
     process_node(root, &ctx, infinite_clip, RENDER_LAYER_UI_BASE, false);
     
@@ -468,8 +642,15 @@ void scene_tree_render(SceneTree* instance, Scene* scene, const Assets* assets,
         overlays++;
     }
 
+    s_last_stats = ctx.stats;
+
     static int frame_throttle = 0;
     if (frame_throttle++ % 120 == 0) {
-        LOG_DEBUG("UI Render: %d nodes, %d overlays", ctx.node_count, overlays);
+        LOG_DEBUG("UI Render: %u nodes (%u visited, %u culled), %d overlays",
+            ctx.stats.emitted, ctx.stats.visited, ctx.stats.culled, overlays);
     }
+}
+
+UiRenderStats ui_renderer_get_stats(void) {
+    return s_last_stats;
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "foundation/memory/arena.h"
 #include "foundation/memory/pool.h"
 #include "foundation/meta/reflection.h"
+#include "foundation/profiler/profiler.h"
 #include "engine/scene/scene.h"
 #include "engine/scene/internal/scene_tree_internal.h"
 #include <string.h>
@@ -24,6 +25,11 @@ void ui_system_init(void) {
 
 void ui_system_shutdown(void) {
     ui_command_shutdown();
+    ui_layout_clear_measure_cache();
+}
+
+void ui_system_set_incremental_layout(bool enabled) {
+    ui_layout_set_incremental(enabled);
 }
 
 static void ui_node_init_recursive(SceneNode* el, SceneTree* tree, const MetaStruct* meta) {
@@ -47,12 +53,12 @@ static void ui_node_init_recursive(SceneNode* el, SceneTree* tree, const MetaStr
         
         for (size_t i = 0; i < el->spec->binding_count; ++i) {
              SceneBindingSpec* b_spec = &el->spec->bindings[i];
-             size_t total_offset = 0;
-             const MetaField* f = meta_find_field_by_path(meta, b_spec->source, &total_offset);
+             // Cached: collection items re-run the same (meta, path) pairs
+             MetaFieldPath path = meta_resolve_field_path(meta, b_spec->source);
              
-             if (f) {
-                 bindings[i].source_field = f;
-                 bindings[i].source_offset = total_offset;
+             if (path.field) {
+                 bindings[i].source_field = path.field;
+                 bindings[i].source_offset = path.offset;
                  bindings[i].target = ui_resolve_target_enum(b_spec->target);
              }
         }
@@ -119,9 +125,13 @@ void ui_node_update(SceneNode* element, float dt) {
     }
 }
 
-void ui_system_layout(SceneTree* tree, float window_w, float window_h, uint64_t frame_number, UiTextMeasureFunc measure_func, void* measure_data) {
-    if (!tree || !tree->root) return;
-    ui_layout_root(tree->root, window_w, window_h, frame_number, false, measure_func, measure_data);
+size_t ui_system_layout(SceneTree* tree, float window_w, float window_h, uint64_t frame_number, UiTextMeasureFunc measure_func, void* measure_data) {
+    if (!tree || !tree->root) return 0;
+    PROFILE_BEGIN("ui_system_layout");
+    tree->viewport = (Rect){0, 0, window_w, window_h};
+    size_t changed = ui_layout_root(tree->root, window_w, window_h, frame_number, false, measure_func, measure_data);
+    PROFILE_END();
+    return changed;
 }
 
 void ui_system_render(SceneTree* tree, struct Scene* scene, const struct Assets* assets, struct MemoryArena* arena) {
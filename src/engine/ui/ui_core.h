@@ -30,6 +30,7 @@ typedef struct UiBinding UiBinding;
 
 void ui_system_init(void);
 void ui_system_shutdown(void);
+void ui_system_set_incremental_layout(bool enabled); // Default on; off = full layout every frame
 
 // UI Node Management
 SceneNode* ui_node_create(SceneTree* tree, const SceneNodeSpec* spec, void* data, const MetaStruct* meta);
@@ -40,7 +41,9 @@ void ui_node_update(SceneNode* element, float dt);
 
 // Layout & Render
 typedef Vec2 (*UiTextMeasureFunc)(const char* text, float scale, void* user_data);
-void ui_system_layout(SceneTree* tree, float window_w, float window_h, uint64_t frame_number, UiTextMeasureFunc measure_func, void* measure_data);
+// Incremental: only dirty nodes (see scene_node_mark_layout_dirty) and their ancestors are
+// laid out; text sizes are cached. Returns the number of nodes laid out this call.
+size_t ui_system_layout(SceneTree* tree, float window_w, float window_h, uint64_t frame_number, UiTextMeasureFunc measure_func, void* measure_data);
 
 // Use render_packet.h for Scene*
 struct Scene; 
@@ -19,12 +19,26 @@ typedef struct RenderSystem RenderSystem;
 void ui_renderer_init(RenderSystem* rs);
 
 // Generates render commands into the Scene.
+// Subtrees whose bounds miss the active clip rect or the layout viewport are skipped.
 void scene_tree_render(SceneTree* instance, Scene* scene, const Assets* assets, MemoryArena* arena);
 
+// Counters of the last scene_tree_render call.
+typedef struct UiRenderStats {
+    uint32_t visited; // Nodes reached (not hidden)
+    uint32_t culled;  // Subtrees skipped by clip/viewport culling
+    uint32_t emitted; // Nodes drawn (visited and not culled)
+} UiRenderStats;
+
+UiRenderStats ui_renderer_get_stats(void);
+
 // Extract UI Nodes from Scene, convert to GPU buffers, and push RenderBatch.
+// Instances go straight into a persistently mapped per-frame ring; unchanged ones are not rewritten.
 // Should be called before render_system_update/draw.
 void ui_renderer_extract(Scene* scene, struct RenderSystem* rs);
 
+// Releases the instance ring. Call before destroying the RenderSystem.
+void ui_renderer_shutdown(void);
+
 // --- Viewport Provider ---
 // Callback for Viewport Rendering (dynamic 3D/custom content inside UI)
 typedef void (*SceneObjectProvider)(void* instance_data, Rect screen_rect, float z_depth, Scene* scene, MemoryArena* frame_arena);
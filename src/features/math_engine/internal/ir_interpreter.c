@@ -0,0 +1,280 @@
+#include "ir_interpreter.h"
+#include "foundation/logger/logger.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct IrProgramOp {
+    IrOpCode op;
+    uint32_t components;  // Of the result: 1 (float) to 4 (vec4)
+    uint32_t dst;         // Register index
+    uint32_t a, b;
+    bool a_scalar;        // Operand is a float, broadcast to every component
+    bool b_scalar;
+    bool varying;         // Depends on the pixel (uv)
+    float value;
+} IrProgramOp;
+
+struct IrProgram {
+    IrProgramOp* ops;
+    uint32_t op_count;
+    uint32_t register_count;
+    bool has_result;
+    uint32_t result;        // Register of the returned value
+    uint32_t result_components;
+};
+
+// Registers are float[4][IR_INTERP_CHUNK]: one lane array per component
+static inline float* reg_lanes(float* regs, uint32_t reg, uint32_t component) {
+    return regs + ((size_t)reg * 4 + component) * IR_INTERP_CHUNK;
+}
+
+static uint32_t type_components(MathDataType type) {
+    switch (type) {
+        case MATH_DATA_TYPE_VEC2: return 2;
+        case MATH_DATA_TYPE_VEC3: return 3;
+        case MATH_DATA_TYPE_VEC4: return 4;
+        default: return 1;
+    }
+}
+
+// Register holding node 'id', or UINT32_MAX if no earlier op defines it
+static uint32_t find_register(const IrProgram* program, uint32_t id, const uint32_t* node_ids) {
+    for (uint32_t i = 0; i < program->op_count; ++i) {
+        if (node_ids[i] == id) return program->ops[i].dst;
+    }
+    return UINT32_MAX;
+}
+
+IrProgram* ir_program_create(const ShaderIR* ir) {
+    if (!ir) return NULL;
+
+    IrProgram* program = calloc(1, sizeof(IrProgram));
+    uint32_t* node_ids = calloc(ir->instruction_count + 1, sizeof(uint32_t));
+    if (!program || !node_ids) goto fail;
+    program->ops = calloc(ir->instruction_count + 1, sizeof(IrProgramOp));
+    if (!program->ops) goto fail;
+
+    for (uint32_t i = 0; i < ir->instruction_count; ++i) {
+        const IrInstruction* inst = &ir->instructions[i];
+        IrProgramOp op = {
+            .op = inst->op,
+            .components = type_components(inst->type),
+            .dst = program->op_count,
+            .value = inst->float_val
+        };
+        uint32_t operands = 0;
+
+        switch (inst->op) {
+            case IR_OP_NOP:
+                continue;
+            case IR_OP_LOAD_PARAM_TEXTURE:
+            case IR_OP_SAMPLE_TEXTURE:
+                LOG_WARN("IR interpreter: texture sampling is not supported on the CPU");
+                goto fail;
+            case IR_OP_RETURN: {
+                uint32_t reg = find_register(program, inst->op1_id, node_ids);
+                if (reg == UINT32_MAX) goto unresolved;
+                program->has_result = true;
+                program->result = reg;
+                program->result_components = type_components(inst->type);
+                continue;
+            }
+            case IR_OP_LOAD_PARAM_UV:
+                op.varying = true;
+                break;
+            case IR_OP_ADD:
+            case IR_OP_SUB:
+            case IR_OP_MUL:
+            case IR_OP_DIV:
+                operands = 2;
+                break;
+            case IR_OP_SIN:
+            case IR_OP_COS:
+                operands = 1;
+                break;
+            default:
+                break;
+        }
+
+        if (operands >= 1) {
+            op.a = find_register(program, inst->op1_id, node_ids);
+            if (op.a == UINT32_MAX) goto unresolved;
+            op.a_scalar = program->ops[op.a].components == 1;
+            op.varying = program->ops[op.a].varying;
+        }
+        if (operands >= 2) {
+            op.b = find_register(program, inst->op2_id, node_ids);
+            if (op.b == UINT32_MAX) goto unresolved;
+            op.b_scalar = program->ops[op.b].components == 1;
+            op.varying = op.varying || program->ops[op.b].varying;
+        }
+        // vec2 + vec3 and the like do not compile in GLSL either
+        if ((operands >= 1 && !op.a_scalar && program->ops[op.a].components != op.components) ||
+            (operands >= 2 && !op.b_scalar && program->ops[op.b].components != op.components)) {
+            LOG_WARN("IR interpreter: operands of mismatched vector sizes");
+            goto fail;
+        }
+
+        node_ids[program->op_count] = inst->id;
+        program->ops[program->op_count++] = op;
+    }
+
+    program->register_count = program->op_count;
+    free(node_ids);
+    return program;
+
+unresolved:
+    LOG_WARN("IR interpreter: instruction reads an undefined value (unconnected input?)");
+fail:
+    free(node_ids);
+    ir_program_destroy(program);
+    return NULL;
+}
+
+void ir_program_destroy(IrProgram* program) {
+    if (!program) return;
+    free(program->ops);
+    free(program);
+}
+
+// --- Evaluation ---
+
+typedef struct IrEvalContext {
+    const GpuInputState* input;
+    float* regs;
+    float x0, y;            // First pixel of the chunk
+    float width, height;    // Screen size the uv is relative to
+} IrEvalContext;
+
+static void splat(float* restrict out, float value, uint32_t n) {
+    for (uint32_t i = 0; i < n; ++i) out[i] = value;
+}
+
+static void splat_vec2(const IrEvalContext* ctx, const IrProgramOp* op, Vec2 value, uint32_t n) {
+    splat(reg_lanes(ctx->regs, op->dst, 0), value.x, n);
+    splat(reg_lanes(ctx->regs, op->dst, 1), value.y, n);
+}
+
+static void eval_op(const IrEvalContext* ctx, const IrProgramOp* op, uint32_t n) {
+    const GpuInputState* in = ctx->input;
+
+    switch (op->op) {
+        case IR_OP_CONST_FLOAT:
+            for (uint32_t c = 0; c < op->components; ++c) splat(reg_lanes(ctx->regs, op->dst, c), op->value, n);
+            return;
+        case IR_OP_LOAD_PARAM_TIME:
+            splat(reg_lanes(ctx->regs, op->dst, 0), in->time, n);
+            return;
+        case IR_OP_LOAD_PARAM_MOUSE:
+            splat_vec2(ctx, op, in->mouse_pos, n);
+            return;
+        case IR_OP_LOAD_PARAM_MOUSE_DELTA:
+            splat_vec2(ctx, op, in->mouse_delta, n);
+            return;
+        case IR_OP_LOAD_PARAM_MOUSE_SCROLL:
+            splat_vec2(ctx, op, in->mouse_scroll, n);
+            return;
+        case IR_OP_LOAD_PARAM_MOUSE_BUTTONS:
+            splat(reg_lanes(ctx->regs, op->dst, 0), (float)in->mouse_buttons, n);
+            return;
+        case IR_OP_LOAD_PARAM_UV: {
+            float* restrict u = reg_lanes(ctx->regs, op->dst, 0);
+            for (uint32_t i = 0; i < n; ++i) u[i] = (ctx->x0 + (float)i) / ctx->width;
+            splat(reg_lanes(ctx->regs, op->dst, 1), ctx->y / ctx->height, n);
+            return;
+        }
+        default:
+            break;
+    }
+
+    for (uint32_t c = 0; c < op->components; ++c) {
+        float* restrict out = reg_lanes(ctx->regs, op->dst, c);
+        const float* restrict a = reg_lanes(ctx->regs, op->a, op->a_scalar ? 0 : c);
+        const float* restrict b = reg_lanes(ctx->regs, op->b, op->b_scalar ? 0 : c);
+        switch (op->op) {
+            case IR_OP_ADD: for (uint32_t i = 0; i < n; ++i) out[i] = a[i] + b[i]; break;
+            case IR_OP_SUB: for (uint32_t i = 0; i < n; ++i) out[i] = a[i] - b[i]; break;
+            case IR_OP_MUL: for (uint32_t i = 0; i < n; ++i) out[i] = a[i] * b[i]; break;
+            case IR_OP_DIV: for (uint32_t i = 0; i < n; ++i) out[i] = a[i] / (b[i] + 0.0001f); break;
+            case IR_OP_SIN: for (uint32_t i = 0; i < n; ++i) out[i] = sinf(a[i]) * 0.5f + 0.5f; break;
+            case IR_OP_COS: for (uint32_t i = 0; i < n; ++i) out[i] = cosf(a[i]) * 0.5f + 0.5f; break;
+            default: break;
+        }
+    }
+}
+
+// UNORM8 conversion of abs(v), as imageStore on an rgba8 image does it
+static inline uint8_t to_unorm8(float v) {
+    v = fabsf(v);
+    v = v > 0.0f ? v : 0.0f; // NaN
+    v = v < 1.0f ? v : 1.0f;
+    return (uint8_t)(v * 255.0f + 0.5f);
+}
+
+static void store_chunk(const IrProgram* program, float* regs, uint8_t* restrict out, uint32_t n) {
+    if (!program->has_result) {
+        memset(out, 0xFF, (size_t)n * 4); // White, like the shader without a result
+        return;
+    }
+
+    // Result components map to rgb(a); a float fills rgb, missing channels are 0, alpha 1
+    uint32_t count = program->result_components;
+    for (uint32_t ch = 0; ch < 4; ++ch) {
+        if (ch == 3 && count < 4) {
+            for (uint32_t i = 0; i < n; ++i) out[i * 4 + 3] = 255;
+        } else if (count == 1 || ch < count) {
+            const float* restrict v = reg_lanes(regs, program->result, count == 1 ? 0 : ch);
+            for (uint32_t i = 0; i < n; ++i) out[i * 4 + ch] = to_unorm8(v[i]);
+        } else {
+            for (uint32_t i = 0; i < n; ++i) out[i * 4 + ch] = 0;
+        }
+    }
+}
+
+void ir_program_run_rows(const void* program_ptr, const GpuInputState* input, const CpuComputeImage* target,
+                         uint32_t row_begin, uint32_t row_end) {
+    const IrProgram* program = (const IrProgram*)program_ptr;
+    if (!program || !target || !target->pixels) return;
+
+    GpuInputState zero_input = {0};
+    if (!input) input = &zero_input;
+
+    // The shader returns for pixels outside params.screen_width/height
+    uint32_t width = target->width;
+    uint32_t height = target->height;
+    if (input->screen_width < (float)width) width = input->screen_width > 0.0f ? (uint32_t)input->screen_width : 0;
+    if (input->screen_height < (float)height) height = input->screen_height > 0.0f ? (uint32_t)input->screen_height : 0;
+    if (row_end > height) row_end = height;
+    if (row_begin >= row_end || width == 0) return;
+
+    float* regs = malloc(((size_t)program->register_count + 1) * 4 * IR_INTERP_CHUNK * sizeof(float));
+    if (!regs) return;
+
+    IrEvalContext ctx = {
+        .input = input,
+        .regs = regs,
+        .width = input->screen_width,
+        .height = input->screen_height
+    };
+
+    // Pixel-independent ops fill every lane once; the chunks below only overwrite varying registers
+    for (uint32_t i = 0; i < program->op_count; ++i) {
+        if (!program->ops[i].varying) eval_op(&ctx, &program->ops[i], IR_INTERP_CHUNK);
+    }
+
+    for (uint32_t y = row_begin; y < row_end; ++y) {
+        uint8_t* row = target->pixels + (size_t)y * target->stride;
+        ctx.y = (float)y;
+        for (uint32_t x0 = 0; x0 < width; x0 += IR_INTERP_CHUNK) {
+            uint32_t n = width - x0 < IR_INTERP_CHUNK ? width - x0 : IR_INTERP_CHUNK;
+            ctx.x0 = (float)x0;
+            for (uint32_t i = 0; i < program->op_count; ++i) {
+                if (program->ops[i].varying) eval_op(&ctx, &program->ops[i], n);
+            }
+            store_chunk(program, regs, row + (size_t)x0 * 4, n);
+        }
+    }
+
+    free(regs);
+}
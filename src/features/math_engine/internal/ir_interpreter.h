@@ -0,0 +1,28 @@
+#ifndef IR_INTERPRETER_H
+#define IR_INTERPRETER_H
+
+#include "shader_ir.h"
+#include "engine/graphics/cpu_compute.h"
+
+// --- IR Interpreter ---
+// Runs ShaderIR on the CPU with the semantics of the GLSL emitter's IMAGE_2D shader
+// (remapped sin/cos, guarded division, abs() into RGBA8). A row is shaded in chunks of
+// IR_INTERP_CHUNK pixels, one instruction at a time over structure-of-arrays registers,
+// so every inner loop is a plain float array loop the compiler can vectorize.
+// Instructions that do not depend on the pixel run once per call, not per chunk.
+
+#define IR_INTERP_CHUNK 64
+
+typedef struct IrProgram IrProgram;
+
+// Returns NULL if the IR samples textures (no CPU sampler) or reads a value that no
+// instruction defines (an unconnected input).
+IrProgram* ir_program_create(const ShaderIR* ir);
+void ir_program_destroy(IrProgram* program);
+
+// CpuComputeKernel.run_rows for an IrProgram. Like the shader, it leaves pixels outside
+// the input's screen size untouched.
+void ir_program_run_rows(const void* program, const GpuInputState* input, const CpuComputeImage* target,
+                         uint32_t row_begin, uint32_t row_end);
+
+#endif // IR_INTERPRETER_H
@@ -125,6 +125,7 @@ typedef struct MathEditor {
 
     bool graph_dirty;
     uint32_t current_pipeline; // Vulkan Compute Pipeline ID for Transpiled Graph
+    uint64_t pending_pipeline; // Compile ticket swapped in once ready (0 = none)
 
     // GPU Picking & Rendering
     struct Stream* gpu_nodes;
@@ -79,6 +79,20 @@ void math_editor_sync_view_data(MathEditor* editor) {
             }
         }
     }
+
+    math_editor_sync_selection(editor);
+}
+
+void math_editor_sync_selection(MathEditor* editor) {
+    MathGraphView* view = editor->view;
+    MathNode* node = math_graph_get_node(editor->graph, view->selected_node_id);
+    if (!node) view->selected_node_id = MATH_NODE_INVALID_ID;
+
+    MathNode* bound = view->selected_nodes_count > 0 ? view->selected_nodes[0] : NULL;
+    if (node != bound) {
+        math_editor_update_selection(editor);
+        view->selection_dirty = false;
+    }
 }
 
 // --- UI Sync ---
@@ -90,7 +104,7 @@ void math_editor_refresh_graph_view(MathEditor* editor) {
     // Sync data before rebuild
     math_editor_sync_view_data(editor);
 
-    SceneNode* canvas = scene_node_find_by_id(root, "canvas_area");
+    SceneNode* canvas = scene_node_find(root, STR_ID("canvas_area"));
     if (canvas) {
         // Declarative Refresh
         ui_node_rebuild_children(canvas, editor->view->ui_instance);
@@ -100,7 +114,8 @@ void math_editor_refresh_graph_view(MathEditor* editor) {
 void math_editor_update_selection(MathEditor* editor) {
     if (!editor) return;
 
-    // 1. Update ViewModel (Selection Array)
+    // 1. Update ViewModel (Selection Array). The pointer is only valid until the node
+    // pool changes; math_editor_sync_selection re-resolves it.
     editor->view->selected_nodes_count = 0;
     if (editor->view->selected_node_id != MATH_NODE_INVALID_ID) {
         MathNode* node = math_graph_get_node(editor->graph, editor->view->selected_node_id);
@@ -116,7 +131,7 @@ void math_editor_update_selection(MathEditor* editor) {
     // 2. Trigger UI Rebuild for Inspector
     SceneNode* root = scene_tree_get_root(editor->view->ui_instance);
     if (root) {
-        SceneNode* inspector = scene_node_find_by_id(root, "inspector_area");
+        SceneNode* inspector = scene_node_find(root, STR_ID("inspector_area"));
         if (inspector) {
              ui_node_rebuild_children(inspector, editor->view->ui_instance);
         }
@@ -21,4 +21,9 @@ void math_editor_refresh_graph_view(MathEditor* editor);
 // Updates selection state and rebuilds Inspector UI
 void math_editor_update_selection(MathEditor* editor);
 
+// Re-resolves selected_node_id through the graph. The inspector binds a MathNode* that
+// moves when the node pool grows or swap-removes, so it is rebuilt when the node moved
+// and cleared when the node is gone.
+void math_editor_sync_selection(MathEditor* editor);
+
 #endif // MATH_EDITOR_VIEW_H
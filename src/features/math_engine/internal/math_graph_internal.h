@@ -2,7 +2,7 @@
 #define MATH_GRAPH_INTERNAL_H
 
 #include "../math_graph.h"
-#include "foundation/memory/pool.h"
+#include "foundation/memory/handle_pool.h"
 #include "foundation/math/coordinate_systems.h"
 
 // --- Internal Types ---
@@ -26,12 +26,13 @@ struct MathNode {
 };
 
 struct MathGraph {
-    struct MemoryPool* node_pool; // From foundation/memory/pool.h
+    // Live nodes, densely packed (iterate with handle_pool_at).
+    // Node pointers move on removal; resolve through the ID table each time.
+    HandlePool* node_pool;
     
-    // Indirection table: ID -> MathNode*
-    // This array grows, but the nodes themselves stay stable in the pool.
-    MathNode** node_ptrs;    // REFLECT
-    uint32_t node_count;     // REFLECT
+    // Indirection table: ID -> Handle (HANDLE_INVALID for removed IDs)
+    Handle* node_handles;
+    uint32_t node_count;     // REFLECT (IDs issued)
     uint32_t node_capacity;  // Capacity
 };
 
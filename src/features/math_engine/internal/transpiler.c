@@ -1,6 +1,7 @@
 #include "transpiler.h"
 #include "math_graph_internal.h"
 #include "shader_ir.h"
+#include "ir_interpreter.h"
 #include "emitters/glsl_emitter.h"
 #include "emitters/c_emitter.h"
 #include "foundation/memory/arena.h"
@@ -18,6 +19,11 @@ static bool is_visited(int* visited, int count, int id) {
     return false;
 }
 
+// Unconnected inputs (MATH_NODE_INVALID_ID) have no inferred type
+static MathDataType input_type(const MathGraph* graph, const MathDataType* inferred_types, MathNodeId id) {
+    return id < graph->node_count ? inferred_types[id] : MATH_DATA_TYPE_UNKNOWN;
+}
+
 static void generate_ir_node(const MathGraph* graph, MathNodeId id, ShaderIR* ir, int* visited, int* visited_count, MathDataType* inferred_types) {
     if (id == MATH_NODE_INVALID_ID) return;
     if (is_visited(visited, *visited_count, (int)id)) return; 
@@ -98,8 +104,8 @@ static void generate_ir_node(const MathGraph* graph, MathNodeId id, ShaderIR* ir
             inst.op1_id = node->inputs[0];
             inst.op2_id = node->inputs[1];
             
-            MathDataType t1 = inferred_types[inst.op1_id];
-            MathDataType t2 = inferred_types[inst.op2_id];
+            MathDataType t1 = input_type(graph, inferred_types, inst.op1_id);
+            MathDataType t2 = input_type(graph, inferred_types, inst.op2_id);
             
             // Simple promotion: max(t1, t2)
             inst.type = (t1 > t2) ? t1 : t2;
@@ -113,7 +119,7 @@ static void generate_ir_node(const MathGraph* graph, MathNodeId id, ShaderIR* ir
             else inst.op = IR_OP_COS;
             
             inst.op1_id = node->inputs[0];
-            inst.type = inferred_types[inst.op1_id]; // Output type same as input
+            inst.type = input_type(graph, inferred_types, inst.op1_id); // Output type same as input
             break;
         }
 
@@ -216,3 +222,25 @@ char* math_graph_transpile(const MathGraph* graph, TranspilerMode mode, ShaderTa
 
     return result;
 }
+
+static void destroy_cpu_program(void* program) {
+    ir_program_destroy((IrProgram*)program);
+}
+
+bool math_graph_build_cpu_kernel(const MathGraph* graph, CpuComputeKernel* out_kernel) {
+    if (!out_kernel) return false;
+    memset(out_kernel, 0, sizeof(*out_kernel));
+    if (!graph) return false;
+
+    ShaderIR ir = math_graph_to_ir(graph);
+    IrProgram* program = ir_program_create(&ir);
+    free_ir(&ir);
+    if (!program) return false;
+
+    out_kernel->run_rows = ir_program_run_rows;
+    out_kernel->destroy = destroy_cpu_program;
+    out_kernel->program = program;
+    out_kernel->local_size_x = 16; // Same work groups as the IMAGE_2D shader
+    out_kernel->local_size_y = 16;
+    return true;
+}
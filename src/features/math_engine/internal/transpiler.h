@@ -18,4 +18,12 @@ typedef enum ShaderTarget {
 // Returns a heap-allocated string that must be freed by the caller.
 char* math_graph_transpile(const MathGraph* graph, TranspilerMode mode, ShaderTarget target);
 
+typedef struct CpuComputeKernel CpuComputeKernel;
+
+// Builds a CPU kernel (engine/graphics/cpu_compute.h) that renders the same image as the
+// TRANSPILE_MODE_IMAGE_2D shader, for backends without a GPU. The kernel owns its program
+// until passed to render_system_create_cpu_compute_pipeline.
+// Returns false if the graph samples textures or is incomplete.
+bool math_graph_build_cpu_kernel(const MathGraph* graph, CpuComputeKernel* out_kernel);
+
 #endif // TRANSPILER_H
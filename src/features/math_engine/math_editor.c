@@ -6,7 +6,9 @@
 #include "foundation/logger/logger.h"
 #include "foundation/platform/platform.h"
 #include "foundation/platform/fs.h"
+#include "foundation/memory/scratch.h"
 #include "foundation/meta/reflection.h"
+#include "foundation/profiler/profiler.h"
 #include "foundation/config/simple_yaml.h"
 #include "foundation/config/config_system.h"
 #include "features/math_engine/internal/transpiler.h"
@@ -17,6 +19,7 @@
 #include "engine/graphics/graphics_types.h"
 #include "engine/graphics/stream.h"
 #include "engine/graphics/compute_graph.h"
+#include "engine/graphics/cpu_compute.h"
 #include "engine/graphics/graphics_types.h"
 #include "engine/text/font.h"
 #include "engine/assets/assets.h"
@@ -49,32 +52,7 @@ static Vec2 text_measure_wrapper(const char* text, float scale, void* user_data)
 
 // --- Recompilation Logic ---
 
-static void math_editor_recompile_graph(MathEditor* editor, RenderSystem* rs) {
-    if (!editor || !rs) return;
-
-    LOG_INFO("Editor: Recompiling Math Graph...");
-
-    // 1. Transpile to GLSL
-    LOG_INFO("Step 1: Transpiling...");
-    char* glsl = math_graph_transpile(editor->graph, TRANSPILE_MODE_IMAGE_2D, SHADER_TARGET_GLSL_VULKAN);
-    if (!glsl) {
-        LOG_ERROR("Transpilation failed.");
-        return;
-    }
-    LOG_INFO("Step 1 Done. GLSL generated.");
-
-    // 2. Create Pipeline (Compiles internally)
-    LOG_INFO("Step 2: Creating Pipeline...");
-    uint32_t new_pipe = render_system_create_compute_pipeline_from_source(rs, glsl);
-    LOG_INFO("Step 2 Done. Pipe ID: %u", new_pipe);
-    free(glsl);
-
-    if (new_pipe == 0) {
-        LOG_ERROR("Failed to create compute pipeline");
-        return;
-    }
-
-    // 3. Swap
+static void math_editor_swap_pipeline(MathEditor* editor, RenderSystem* rs, uint32_t new_pipe) {
     if (editor->logic_compute_graph) {
         render_system_unregister_compute_graph(rs, editor->logic_compute_graph);
         compute_graph_destroy(editor->logic_compute_graph);
@@ -97,6 +75,75 @@ static void math_editor_recompile_graph(MathEditor* editor, RenderSystem* rs) {
     LOG_INFO("Editor: Graph Recompiled Successfully (ID: %u)", new_pipe);
 }
 
+// Swaps the pending pipeline in once its shader is compiled. The old graph keeps
+// running until then, so the frame never waits on the compiler.
+static void math_editor_poll_pipeline(MathEditor* editor, RenderSystem* rs) {
+    if (!editor || !rs || editor->pending_pipeline == 0) return;
+
+    uint64_t ticket = editor->pending_pipeline;
+    uint32_t new_pipe = 0;
+    ShaderCacheStatus status = render_system_poll_compute_pipeline(rs, ticket, &new_pipe);
+    if (status == SHADER_CACHE_PENDING) return;
+
+    editor->pending_pipeline = 0;
+    if (status != SHADER_CACHE_READY) {
+        // A transpiler bug, not a user error: point at the generated line
+        ShaderDiagnostics diagnostics;
+        const ShaderDiagnostic* first = NULL;
+        if (render_system_get_compute_diagnostics(rs, ticket, &diagnostics)) first = shader_diagnostics_first_error(&diagnostics);
+        if (first) {
+            LOG_ERROR("Editor: Graph shader has %u errors. Line %u: %s", diagnostics.error_count, first->line, first->message);
+        } else {
+            LOG_ERROR("Failed to create compute pipeline");
+        }
+        return;
+    }
+    math_editor_swap_pipeline(editor, rs, new_pipe);
+}
+
+static void math_editor_recompile_graph(MathEditor* editor, RenderSystem* rs) {
+    if (!editor || !rs) return;
+
+    LOG_INFO("Editor: Recompiling Math Graph...");
+
+    // Backends without a GPU (headless) run the graph as a CPU kernel instead
+    if (render_system_supports_cpu_compute(rs)) {
+        CpuComputeKernel kernel;
+        if (!math_graph_build_cpu_kernel(editor->graph, &kernel)) {
+            LOG_ERROR("Editor: Graph cannot run on the CPU compute path");
+            return;
+        }
+        uint32_t pipe = render_system_create_cpu_compute_pipeline(rs, &kernel);
+        if (pipe == 0) {
+            kernel.destroy(kernel.program);
+            LOG_ERROR("Failed to create compute pipeline");
+            return;
+        }
+        editor->pending_pipeline = 0;
+        math_editor_swap_pipeline(editor, rs, pipe);
+        return;
+    }
+
+    // 1. Transpile to GLSL
+    char* glsl = math_graph_transpile(editor->graph, TRANSPILE_MODE_IMAGE_2D, SHADER_TARGET_GLSL_VULKAN);
+    if (!glsl) {
+        LOG_ERROR("Transpilation failed.");
+        return;
+    }
+
+    // 2. Request the pipeline (supersedes any compile still in flight)
+    uint64_t ticket = render_system_request_compute_pipeline(rs, glsl);
+    free(glsl);
+    if (ticket == 0) {
+        LOG_ERROR("Failed to create compute pipeline");
+        return;
+    }
+    editor->pending_pipeline = ticket;
+
+    // 3. Swap now if the shader was cached
+    math_editor_poll_pipeline(editor, rs);
+}
+
 // --- Commands ---
 
 UI_COMMAND(cmd_add_node, MathEditor) {
@@ -178,9 +225,9 @@ UI_COMMAND(cmd_load_graph, MathEditor) {
         // Layout info is lost currently (reset to default or grid)
         int x = 50, y = 50;
         for (uint32_t i = 0; i < ctx->graph->node_count; ++i) {
-             MathNodeId id = ctx->graph->node_ptrs[i]->id; // Access internal directly or use helper?
-             // Graph internal access is available here
-             math_editor_add_view(ctx, id, x, y); 
+             const MathNode* node = math_graph_get_node(ctx->graph, i);
+             if (!node) continue; // Removed ID
+             math_editor_add_view(ctx, node->id, x, y); 
              x += 250;
              if (x > 1000) { x = 50; y += 200; }
         }
@@ -527,7 +574,8 @@ void math_editor_render(MathEditor* editor, Scene* scene, const struct Assets* a
     if (editor->nodes_pipeline_id > 0 && editor->view->node_views_count > 0) {
         RenderBatch batch = {0};
         batch.pipeline_id = editor->nodes_pipeline_id;
-        strncpy(batch.draw_list, "SceneBatches", sizeof(batch.draw_list) - 1);
+        batch.draw_list_id = STR_ID("SceneBatches");
+        batch.layer_id = RENDER_LAYER_WORLD;
         batch.vertex_count = 6; 
         batch.instance_count = editor->view->node_views_count;
         
@@ -543,6 +591,7 @@ void math_editor_render(MathEditor* editor, Scene* scene, const struct Assets* a
     // 1.5 Render Wires (Unified Geometry Stream)
     if (editor->primitive_batcher && editor->view->wires_count > 0) {
         primitive_batcher_set_tag(editor->primitive_batcher, "SceneBatches");
+        primitive_batcher_set_layer(editor->primitive_batcher, RENDER_LAYER_WORLD_OVERLAY); // Over the nodes
         primitive_batcher_begin(editor->primitive_batcher);
         
                 for (uint32_t i = 0; i < editor->view->wires_count; ++i) {
@@ -574,6 +623,7 @@ void math_editor_render(MathEditor* editor, Scene* scene, const struct Assets* a
 
 void math_editor_update(MathEditor* editor, Engine* engine) {
     if (!editor) return;
+    PROFILE_BEGIN("math_editor_update");
     
     // Update Logic Graph Constants
     if (editor->logic_pass) {
@@ -604,7 +654,7 @@ void math_editor_update(MathEditor* editor, Engine* engine) {
     math_editor_sync_view_data(editor);
 
     // Toggle Visualizer (Hotkey C) - Action Based
-    if (input_is_action_just_pressed(engine_get_input_system(engine), "ToggleCompute")) {
+    if (input_is_action_just_pressed_id(engine_get_input_system(engine), STR_ID("ToggleCompute"))) {
          bool show = !engine_get_show_compute(engine);
          engine_set_show_compute(engine, show);
          // render_system_set_show_compute removed
@@ -622,6 +672,9 @@ void math_editor_update(MathEditor* editor, Engine* engine) {
         
         // Input Handling
         ui_input_update(editor->view->input_ctx, root, engine_get_input_system(engine));
+
+        // Commands may have added or removed nodes, moving the inspected one
+        math_editor_sync_selection(editor);
         
         // Sync Wires AFTER input (so they attach to new node positions)
         math_editor_sync_wires(editor);
@@ -666,8 +719,9 @@ void math_editor_update(MathEditor* editor, Engine* engine) {
         }
         
         // Layout
-        PlatformWindowSize size = platform_get_framebuffer_size(engine_get_window(engine));
-        ui_system_layout(editor->view->ui_instance, (float)size.width, (float)size.height, render_system_get_frame_count(engine_get_render_system(engine)), text_measure_wrapper, (void*)assets_get_font(engine_get_assets(engine)));
+        int width = 0, height = 0;
+        engine_get_framebuffer_size(engine, &width, &height);
+        ui_system_layout(editor->view->ui_instance, (float)width, (float)height, render_system_get_frame_count(engine_get_render_system(engine)), text_measure_wrapper, (void*)assets_get_font(engine_get_assets(engine)));
     }
 
     // Graph Evaluation (Naive interpretation on CPU for debugging/node values)
@@ -686,11 +740,11 @@ void math_editor_update(MathEditor* editor, Engine* engine) {
 
         if (editor->view->node_views_count > 0) {
             // 1. Upload Node Data
-        // Use scratch memory or malloc
         uint32_t count = editor->view->node_views_count;
         if (count > 4096) count = 4096;
         
-        GpuNodeData* gpu_data = (GpuNodeData*)malloc(count * sizeof(GpuNodeData));
+        Scratch scratch = scratch_begin(NULL, 0);
+        GpuNodeData* gpu_data = (GpuNodeData*)arena_alloc(scratch.arena, count * sizeof(GpuNodeData));
         if (gpu_data) {
             for(uint32_t i=0; i < count; ++i) {
                 MathNodeView* v = &editor->view->node_views[i];
@@ -701,8 +755,8 @@ void math_editor_update(MathEditor* editor, Engine* engine) {
             if (!stream_set_data(editor->gpu_nodes, gpu_data, count)) {
                  LOG_ERROR("Failed to upload node data!");
             }
-            free(gpu_data);
         }
+        scratch_end(scratch);
 
         // 2. Setup Push Constants
         struct { Vec2 mouse; uint32_t count; } push;
@@ -744,9 +798,13 @@ void math_editor_update(MathEditor* editor, Engine* engine) {
 
     // Recompile Compute Shader if dirty
     if (editor->graph_dirty && engine_get_show_compute(engine)) {
+        PROFILE_BEGIN("math_editor_recompile");
         math_editor_recompile_graph(editor, engine_get_render_system(engine));
+        PROFILE_END();
         editor->graph_dirty = false;
     }
+    math_editor_poll_pipeline(editor, engine_get_render_system(engine));
+    PROFILE_END();
 }
 
 void math_editor_destroy(MathEditor* editor) {
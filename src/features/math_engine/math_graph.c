@@ -1,6 +1,6 @@
 #include "math_graph.h"
 #include "internal/math_graph_internal.h"
-#include "foundation/memory/pool.h"
+#include "foundation/memory/handle_pool.h"
 #include "foundation/logger/logger.h"
 #include <string.h>
 #include <math.h>
@@ -9,9 +9,9 @@
 
 // --- Helper: Get Node ---
 MathNode* math_graph_get_node(MathGraph* graph, MathNodeId id) {
-    if (!graph || !graph->node_ptrs || id >= graph->node_count) return NULL;
-    MathNode* node = graph->node_ptrs[id];
-    if (!node) return NULL; // Should not happen if count is correct, unless deleted?
+    if (!graph || !graph->node_handles || id >= graph->node_count) return NULL;
+    MathNode* node = (MathNode*)handle_pool_get(graph->node_pool, graph->node_handles[id]);
+    if (!node) return NULL; // Removed (stale handle)
     if (node->type == MATH_NODE_NONE) return NULL;
     return node;
 }
@@ -27,12 +27,12 @@ MathGraph* math_graph_create(MemoryArena* arena) {
     MathGraph* graph = (MathGraph*)arena_alloc_zero(arena, sizeof(MathGraph));
     // memset(graph, 0, sizeof(MathGraph)); // arena_alloc_zero already clears it
     
-    // Create Pool: Elements are MathNode size, 256 per block
-    graph->node_pool = pool_create(sizeof(MathNode), 256);
+    // Create Pool: dense MathNode storage, grows on demand
+    graph->node_pool = handle_pool_create(sizeof(MathNode), 256);
     
     // Initial capacity for ID table
     graph->node_capacity = 32; 
-    graph->node_ptrs = (MathNode**)calloc(graph->node_capacity, sizeof(MathNode*));
+    graph->node_handles = (Handle*)calloc(graph->node_capacity, sizeof(Handle));
     graph->node_count = 0;
 
     return graph;
@@ -41,13 +41,13 @@ MathGraph* math_graph_create(MemoryArena* arena) {
 void math_graph_destroy(MathGraph* graph) {
     if (!graph) return;
     
-    if (graph->node_ptrs) {
-        free((void*)graph->node_ptrs);
-        graph->node_ptrs = NULL;
+    if (graph->node_handles) {
+        free(graph->node_handles);
+        graph->node_handles = NULL;
     }
     
     if (graph->node_pool) {
-        pool_destroy(graph->node_pool);
+        handle_pool_destroy(graph->node_pool);
         graph->node_pool = NULL;
     }
     
@@ -66,29 +66,30 @@ MathNodeId math_graph_add_node(MathGraph* graph, MathNodeType type) {
         uint32_t new_cap = graph->node_capacity * 2;
         if (new_cap == 0) new_cap = 32;
         
-        MathNode** new_ptrs = (MathNode**)realloc((void*)graph->node_ptrs, sizeof(MathNode*) * new_cap);
-        if (!new_ptrs) {
+        Handle* new_handles = (Handle*)realloc(graph->node_handles, sizeof(Handle) * new_cap);
+        if (!new_handles) {
             LOG_ERROR("MathGraph: Out of memory for ID table!");
             return MATH_NODE_INVALID_ID;
         }
         
-        // Zero out new slots
-        memset((void*)(new_ptrs + graph->node_capacity), 0, (new_cap - graph->node_capacity) * sizeof(MathNode*));
+        // Zero out new slots (HANDLE_INVALID)
+        memset(new_handles + graph->node_capacity, 0, (new_cap - graph->node_capacity) * sizeof(Handle));
         
-        graph->node_ptrs = new_ptrs;
+        graph->node_handles = new_handles;
         graph->node_capacity = new_cap;
         LOG_INFO("MathGraph: Resized ID table to %d", new_cap);
     }
 
     // 2. Alloc from Pool
-    MathNode* node = (MathNode*)pool_alloc(graph->node_pool);
+    MathNode* node = NULL;
+    Handle handle = handle_pool_alloc_zero(graph->node_pool, (void**)&node);
     if (!node) {
         LOG_ERROR("MathGraph: Pool exhausted (System OOM)!");
         return MATH_NODE_INVALID_ID;
     }
 
     MathNodeId id = graph->node_count++;
-    graph->node_ptrs[id] = node;
+    graph->node_handles[id] = handle;
     
     node->id = id;
     node->type = type;
@@ -150,12 +151,11 @@ void math_graph_remove_node(MathGraph* graph, MathNodeId id) {
     MathNode* node = math_graph_get_node(graph, id);
     if (!node) return;
     
-    // Remove connections TO this node first
-    for (uint32_t i = 0; i < graph->node_count; ++i) {
-        // Direct pointer access for speed, skipping NULLs
-        MathNode* other = graph->node_ptrs[i];
-        if (!other || other->type == MATH_NODE_NONE) continue;
-        
+    // Remove connections TO this node first (linear walk over live nodes only)
+    uint32_t live = handle_pool_count(graph->node_pool);
+    MathNode* nodes = (MathNode*)handle_pool_data(graph->node_pool);
+    for (uint32_t i = 0; i < live; ++i) {
+        MathNode* other = &nodes[i];
         for (int k = 0; k < MATH_NODE_MAX_INPUTS; ++k) {
             if (other->inputs[k] == id) {
                 other->inputs[k] = MATH_NODE_INVALID_ID;
@@ -164,22 +164,22 @@ void math_graph_remove_node(MathGraph* graph, MathNodeId id) {
         }
     }
     
-    // Free memory
-    pool_free(graph->node_pool, node);
-    graph->node_ptrs[id] = NULL; // Mark as dead
+    // Free memory (stale handle from now on)
+    handle_pool_free(graph->node_pool, graph->node_handles[id]);
+    graph->node_handles[id] = HANDLE_INVALID;
 }
 
 void math_graph_clear(MathGraph* graph) {
     if (!graph) return;
     
-    // 1. Reset Pool (Recycles all blocks)
+    // 1. Reset Pool (keeps storage, invalidates all handles)
     if (graph->node_pool) {
-        pool_clear(graph->node_pool);
+        handle_pool_clear(graph->node_pool);
     }
     
     // 2. Clear ID Map
-    if (graph->node_ptrs && graph->node_capacity > 0) {
-        memset((void*)graph->node_ptrs, 0, graph->node_capacity * sizeof(MathNode*));
+    if (graph->node_handles && graph->node_capacity > 0) {
+        memset(graph->node_handles, 0, graph->node_capacity * sizeof(Handle));
     }
     
     // 3. Reset Counters
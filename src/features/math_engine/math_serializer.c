@@ -87,9 +87,9 @@ bool math_serializer_save_graph(MathGraph* graph, const char* filepath) {
     NodeNameEntry* name_map = (NodeNameEntry*)calloc(graph->node_capacity, sizeof(NodeNameEntry));
     
     // First pass: Collect basic names and handle duplicates
-    for (uint32_t i = 0; i < graph->node_capacity; ++i) {
-        MathNode* node = graph->node_ptrs[i];
-        if (!node || node->type == MATH_NODE_NONE) continue;
+    for (uint32_t i = 0; i < graph->node_count; ++i) {
+        MathNode* node = math_graph_get_node(graph, i);
+        if (!node) continue;
         
         count++;
         name_map[i].id = i;
@@ -106,7 +106,7 @@ bool math_serializer_save_graph(MathGraph* graph, const char* filepath) {
             unique = true;
             // Check against all PREVIOUS processed nodes
             for (uint32_t k = 0; k < i; ++k) {
-                if (graph->node_ptrs[k] && graph->node_ptrs[k]->type != MATH_NODE_NONE) {
+                if (math_graph_get_node(graph, k)) {
                     if (strcmp(name_map[k].unique_name, name_map[i].unique_name) == 0) {
                         unique = false;
                         duplicate_idx++;
@@ -120,9 +120,9 @@ bool math_serializer_save_graph(MathGraph* graph, const char* filepath) {
     }
 
     // 3. Write Nodes
-    for (uint32_t i = 0; i < graph->node_capacity; ++i) {
-        MathNode* node = graph->node_ptrs[i];
-        if (!node || node->type == MATH_NODE_NONE) continue;
+    for (uint32_t i = 0; i < graph->node_count; ++i) {
+        MathNode* node = math_graph_get_node(graph, i);
+        if (!node) continue;
 
         fprintf(f, "  - name: \"%s\"\n", name_map[i].unique_name);
         fprintf(f, "    type: %s\n", get_node_type_str(node->type));
@@ -155,16 +155,16 @@ bool math_serializer_save_graph(MathGraph* graph, const char* filepath) {
 
     // 4. Write Links
     // We iterate all nodes and their inputs
-    for (uint32_t i = 0; i < graph->node_capacity; ++i) {
-        MathNode* node = graph->node_ptrs[i];
-        if (!node || node->type == MATH_NODE_NONE) continue;
+    for (uint32_t i = 0; i < graph->node_count; ++i) {
+        MathNode* node = math_graph_get_node(graph, i);
+        if (!node) continue;
 
         for (int k = 0; k < MATH_NODE_MAX_INPUTS; ++k) {
             MathNodeId src_id = node->inputs[k];
             if (src_id != MATH_NODE_INVALID_ID) {
                 // Find source name
                 // Safe because src_id must be valid if link exists
-                if (src_id < graph->node_capacity && graph->node_ptrs[src_id]) {
+                if (math_graph_get_node(graph, src_id)) {
                      fprintf(f, "  - src: \"%s\"\n", name_map[src_id].unique_name);
                      fprintf(f, "    dst: [\"%s\", %d]\n", name_map[i].unique_name, k);
                 }
@@ -186,7 +186,10 @@ bool math_serializer_load_graph(MathGraph* graph, const char* filepath) {
     // 1. Read File
     // We need a scratch arena for the parser
     MemoryArena scratch;
-    arena_init(&scratch, 1024 * 1024); // 1MB
+    if (!arena_init_virtual(&scratch, (size_t)256 * 1024 * 1024)) {
+        LOG_ERROR("Serializer: Failed to init scratch arena");
+        return false;
+    }
 
     char* text = fs_read_text(&scratch, filepath);
     if (!text) {
@@ -0,0 +1,287 @@
+#include "config_cache.h"
+#include "foundation/memory/arena.h"
+#include "foundation/platform/fs.h"
+#include "foundation/logger/logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CONFIG_CACHE_MAGIC 0x48434347u // "GCCH"
+#define CONFIG_CACHE_VERSION 2u
+#define CONFIG_CACHE_PAYLOAD_ALIGN 16
+
+#define FNV1A_OFFSET_64 14695981039346656037ull
+#define FNV1A_PRIME_64 1099511628211ull
+
+typedef struct ConfigCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t schema;
+    uint32_t pointer_size;
+    uint32_t dep_count;
+    uint32_t relocation_count;
+    uint64_t payload_offset; // From file start
+    uint64_t payload_size;
+    uint64_t root_offset;    // Within payload
+} ConfigCacheHeader;
+
+// Dependency record: header followed by path_len bytes (no terminator)
+typedef struct ConfigCacheDepRecord {
+    uint64_t hash;
+    uint64_t size;
+    uint64_t mtime_ns;
+    uint32_t path_len;
+    uint32_t _padding;
+} ConfigCacheDepRecord;
+
+static size_t align_up(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// --- Hashing ---
+
+uint64_t config_cache_hash(const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    uint64_t hash = FNV1A_OFFSET_64;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= FNV1A_PRIME_64;
+    }
+    return hash;
+}
+
+bool config_cache_hash_file(const char* path, uint64_t* out_hash) {
+    size_t size = 0;
+    void* data = fs_read_bin(NULL, path, &size);
+    if (!data) return false;
+    *out_hash = config_cache_hash(data, size);
+    free(data);
+    return true;
+}
+
+bool config_cache_dependency_init(ConfigCacheDependency* dep, const char* path) {
+    // Stat first: an edit after it changes the mtime, so the next load rehashes
+    *dep = (ConfigCacheDependency){ .path = path };
+    return platform_file_stat(path, &dep->size, &dep->mtime_ns) && config_cache_hash_file(path, &dep->hash);
+}
+
+void config_cache_path(const char* source_path, const char* ext, char* out_path, size_t out_size) {
+    uint64_t key = config_cache_hash(source_path, strlen(source_path));
+    snprintf(out_path, out_size, "%s/%016llx.%s", CONFIG_CACHE_DIR, (unsigned long long)key, ext ? ext : "bin");
+}
+
+uint32_t config_cache_schema_mix(uint32_t schema, uint64_t value) {
+    uint64_t mixed = config_cache_hash(&value, sizeof(value)) ^ ((uint64_t)schema * FNV1A_PRIME_64);
+    return (uint32_t)(mixed ^ (mixed >> 32));
+}
+
+// --- Writer ---
+
+void config_cache_writer_init(ConfigCacheWriter* writer) {
+    memset(writer, 0, sizeof(*writer));
+}
+
+void config_cache_writer_free(ConfigCacheWriter* writer) {
+    if (!writer) return;
+    free(writer->data);
+    free(writer->relocations);
+    memset(writer, 0, sizeof(*writer));
+}
+
+size_t config_cache_writer_push(ConfigCacheWriter* writer, const void* src, size_t size, size_t alignment) {
+    if (writer->failed) return SIZE_MAX;
+
+    size_t offset = align_up(writer->size, alignment ? alignment : 1);
+    size_t end = offset + size;
+    if (end > writer->capacity) {
+        size_t new_cap = writer->capacity ? writer->capacity * 2 : 4096;
+        while (new_cap < end) new_cap *= 2;
+        uint8_t* data = (uint8_t*)realloc(writer->data, new_cap);
+        if (!data) {
+            writer->failed = true;
+            return SIZE_MAX;
+        }
+        writer->data = data;
+        writer->capacity = new_cap;
+    }
+
+    // Zero alignment padding too, so identical inputs produce identical files
+    memset(writer->data + writer->size, 0, offset - writer->size);
+    if (src) memcpy(writer->data + offset, src, size);
+    else memset(writer->data + offset, 0, size);
+
+    writer->size = end;
+    return offset;
+}
+
+size_t config_cache_writer_push_string(ConfigCacheWriter* writer, const char* str) {
+    if (!str) return SIZE_MAX;
+    return config_cache_writer_push(writer, str, strlen(str) + 1, 1);
+}
+
+void config_cache_writer_set_pointer(ConfigCacheWriter* writer, size_t slot_offset, size_t target_offset) {
+    if (writer->failed || slot_offset == SIZE_MAX) return;
+    if (slot_offset > UINT32_MAX || slot_offset + sizeof(uintptr_t) > writer->size) {
+        writer->failed = true;
+        return;
+    }
+
+    uintptr_t encoded = (target_offset == SIZE_MAX) ? 0 : (uintptr_t)target_offset + 1;
+    memcpy(writer->data + slot_offset, &encoded, sizeof(encoded));
+    if (encoded == 0) return; // NULL needs no relocation
+
+    if (writer->relocation_count == writer->relocation_capacity) {
+        size_t new_cap = writer->relocation_capacity ? writer->relocation_capacity * 2 : 256;
+        uint32_t* relocations = (uint32_t*)realloc(writer->relocations, new_cap * sizeof(uint32_t));
+        if (!relocations) {
+            writer->failed = true;
+            return;
+        }
+        writer->relocations = relocations;
+        writer->relocation_capacity = new_cap;
+    }
+    writer->relocations[writer->relocation_count++] = (uint32_t)slot_offset;
+}
+
+bool config_cache_write(const char* cache_path, uint32_t schema,
+                        const ConfigCacheDependency* deps, size_t dep_count,
+                        const ConfigCacheWriter* writer, size_t root_offset) {
+    if (!cache_path || !writer || writer->failed || root_offset >= writer->size) return false;
+
+    // 1. Size the file
+    size_t deps_size = 0;
+    for (size_t i = 0; i < dep_count; ++i) {
+        deps_size += sizeof(ConfigCacheDepRecord) + strlen(deps[i].path);
+    }
+    size_t payload_offset = align_up(sizeof(ConfigCacheHeader) + deps_size, CONFIG_CACHE_PAYLOAD_ALIGN);
+    size_t relocations_size = writer->relocation_count * sizeof(uint32_t);
+    size_t file_size = payload_offset + writer->size + relocations_size;
+
+    uint8_t* file = (uint8_t*)calloc(1, file_size);
+    if (!file) return false;
+
+    // 2. Header
+    ConfigCacheHeader header = {
+        .magic = CONFIG_CACHE_MAGIC,
+        .version = CONFIG_CACHE_VERSION,
+        .schema = schema,
+        .pointer_size = (uint32_t)sizeof(void*),
+        .dep_count = (uint32_t)dep_count,
+        .relocation_count = (uint32_t)writer->relocation_count,
+        .payload_offset = payload_offset,
+        .payload_size = writer->size,
+        .root_offset = root_offset
+    };
+    memcpy(file, &header, sizeof(header));
+
+    // 3. Dependencies
+    uint8_t* cursor = file + sizeof(header);
+    for (size_t i = 0; i < dep_count; ++i) {
+        ConfigCacheDepRecord record = { deps[i].hash, deps[i].size, deps[i].mtime_ns, (uint32_t)strlen(deps[i].path), 0 };
+        memcpy(cursor, &record, sizeof(record));
+        cursor += sizeof(record);
+        memcpy(cursor, deps[i].path, record.path_len);
+        cursor += record.path_len;
+    }
+
+    // 4. Payload + relocations
+    memcpy(file + payload_offset, writer->data, writer->size);
+    memcpy(file + payload_offset + writer->size, writer->relocations, relocations_size);
+
+    // 5. Write (directories may not exist yet)
+    platform_mkdir("cache");
+    platform_mkdir(CONFIG_CACHE_DIR);
+    bool ok = fs_write_bin(cache_path, file, file_size);
+    if (!ok) {
+        LOG_WARN("ConfigCache: Failed to write '%s'", cache_path);
+    }
+    free(file);
+    return ok;
+}
+
+// --- Loading ---
+
+static bool dependencies_unchanged(const uint8_t* file, size_t file_size, const ConfigCacheHeader* header) {
+    size_t cursor = sizeof(ConfigCacheHeader);
+    for (uint32_t i = 0; i < header->dep_count; ++i) {
+        ConfigCacheDepRecord record;
+        if (cursor + sizeof(record) > file_size) return false;
+        memcpy(&record, file + cursor, sizeof(record));
+        cursor += sizeof(record);
+
+        char path[1024];
+        if (record.path_len >= sizeof(path) || cursor + record.path_len > file_size) return false;
+        memcpy(path, file + cursor, record.path_len);
+        path[record.path_len] = '\0';
+        cursor += record.path_len;
+
+        uint64_t size = 0, mtime_ns = 0;
+        if (!platform_file_stat(path, &size, &mtime_ns) || size != record.size) {
+            LOG_TRACE("ConfigCache: '%s' changed, cache is stale", path);
+            return false;
+        }
+        if (mtime_ns == record.mtime_ns) continue;
+
+        // Touched (checkout, copy): only the contents decide
+        uint64_t current = 0;
+        if (!config_cache_hash_file(path, &current) || current != record.hash) {
+            LOG_TRACE("ConfigCache: '%s' changed, cache is stale", path);
+            return false;
+        }
+    }
+    return cursor <= header->payload_offset;
+}
+
+void* config_cache_load(const char* cache_path, uint32_t schema, MemoryArena* arena) {
+    if (!cache_path || !arena) return NULL;
+
+    size_t file_size = 0;
+    uint8_t* file = (uint8_t*)fs_read_bin(NULL, cache_path, &file_size);
+    if (!file) return NULL; // No cache yet
+
+    void* root = NULL;
+    ConfigCacheHeader header;
+    if (file_size < sizeof(header)) goto done;
+    memcpy(&header, file, sizeof(header));
+
+    // 1. Validate
+    if (header.magic != CONFIG_CACHE_MAGIC || header.version != CONFIG_CACHE_VERSION ||
+        header.schema != schema || header.pointer_size != sizeof(void*)) {
+        goto done;
+    }
+    size_t relocations_size = (size_t)header.relocation_count * sizeof(uint32_t);
+    if (header.payload_offset > file_size || header.payload_size > file_size - header.payload_offset ||
+        relocations_size != file_size - header.payload_offset - header.payload_size ||
+        header.root_offset >= header.payload_size) {
+        LOG_WARN("ConfigCache: '%s' is corrupt, ignoring", cache_path);
+        goto done;
+    }
+    if (!dependencies_unchanged(file, file_size, &header)) goto done;
+
+    // 2. Copy payload
+    size_t payload_size = (size_t)header.payload_size;
+    uint8_t* base = (uint8_t*)arena_alloc_aligned(arena, payload_size, CONFIG_CACHE_PAYLOAD_ALIGN);
+    if (!base) goto done;
+    memcpy(base, file + header.payload_offset, payload_size);
+
+    // 3. Pointer fixup
+    const uint8_t* relocations = file + header.payload_offset + payload_size;
+    for (uint32_t i = 0; i < header.relocation_count; ++i) {
+        uint32_t slot;
+        memcpy(&slot, relocations + (size_t)i * sizeof(uint32_t), sizeof(slot));
+        if ((size_t)slot + sizeof(uintptr_t) > payload_size) goto done;
+
+        uintptr_t encoded;
+        memcpy(&encoded, base + slot, sizeof(encoded));
+        if (encoded == 0 || encoded - 1 >= payload_size) goto done;
+
+        uintptr_t resolved = (uintptr_t)(base + (encoded - 1));
+        memcpy(base + slot, &resolved, sizeof(resolved));
+    }
+
+    root = base + header.root_offset;
+
+done:
+    free(file);
+    return root;
+}
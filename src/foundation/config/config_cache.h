@@ -0,0 +1,89 @@
+#ifndef CONFIG_CACHE_H
+#define CONFIG_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct MemoryArena MemoryArena;
+
+// --- Compiled Config Cache ---
+// Binary snapshots of fully resolved config/asset structures, so loading skips
+// YAML parsing and reflection. File layout:
+//   [ConfigCacheHeader][dependencies][payload (16-byte aligned)][relocations]
+// Pointers inside the payload are stored as (payload offset + 1), 0 = NULL; the
+// relocation table lists every pointer slot so loading is one read, one copy and a
+// fixup pass. A cache is only used if the caller's schema (layout fingerprint) matches
+// and every dependency is unchanged; otherwise it is simply a miss. A dependency whose
+// size and mtime match the recorded ones counts as unchanged without being read; only
+// when those differ is it rehashed.
+
+#define CONFIG_CACHE_DIR "cache/assets"
+
+// Payload builder. Offsets stay valid while the buffer grows.
+typedef struct ConfigCacheWriter {
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+    uint32_t* relocations;
+    size_t relocation_count;
+    size_t relocation_capacity;
+    bool failed; // Sticky OOM flag, checked by config_cache_write
+} ConfigCacheWriter;
+
+// Source file a cache was built from (path as passed to the loader).
+typedef struct ConfigCacheDependency {
+    const char* path;
+    uint64_t hash;
+    uint64_t size;
+    uint64_t mtime_ns;
+} ConfigCacheDependency;
+
+// --- Hashing ---
+
+// FNV-1a 64-bit
+uint64_t config_cache_hash(const void* data, size_t size);
+bool config_cache_hash_file(const char* path, uint64_t* out_hash);
+
+// Records 'path' as a dependency: size and mtime, then the content hash. Returns false
+// if the file cannot be read.
+bool config_cache_dependency_init(ConfigCacheDependency* dep, const char* path);
+
+// Cache file location for a source path: CONFIG_CACHE_DIR/<hash of path>.<ext>
+void config_cache_path(const char* source_path, const char* ext, char* out_path, size_t out_size);
+
+// Layout fingerprint helper: mix a value (struct size, offset, version) into a schema.
+uint32_t config_cache_schema_mix(uint32_t schema, uint64_t value);
+
+// --- Writing ---
+
+void config_cache_writer_init(ConfigCacheWriter* writer);
+void config_cache_writer_free(ConfigCacheWriter* writer);
+
+// Appends 'size' bytes (zeroed if src is NULL) at 'alignment'. Returns the payload offset.
+size_t config_cache_writer_push(ConfigCacheWriter* writer, const void* src, size_t size, size_t alignment);
+
+// Appends a NUL-terminated string. Returns its offset (or SIZE_MAX for NULL).
+size_t config_cache_writer_push_string(ConfigCacheWriter* writer, const char* str);
+
+// Makes the pointer slot at 'slot_offset' point at 'target_offset' (SIZE_MAX = NULL).
+void config_cache_writer_set_pointer(ConfigCacheWriter* writer, size_t slot_offset, size_t target_offset);
+
+/**
+ * @brief Writes the payload plus dependency list to cache_path (atomically).
+ * @param root_offset Payload offset of the object config_cache_load returns.
+ */
+bool config_cache_write(const char* cache_path, uint32_t schema,
+                        const ConfigCacheDependency* deps, size_t dep_count,
+                        const ConfigCacheWriter* writer, size_t root_offset);
+
+// --- Loading ---
+
+/**
+ * @brief Loads a cache file if it matches 'schema' and its dependencies are unchanged.
+ * The payload is copied into 'arena' (16-byte aligned) and relocated in place.
+ * @return Pointer to the root object, or NULL on a miss / stale or corrupt cache.
+ */
+void* config_cache_load(const char* cache_path, uint32_t schema, MemoryArena* arena);
+
+#endif // CONFIG_CACHE_H
@@ -10,6 +10,8 @@
 #include <string.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
 
 #ifdef _WIN32
     #define WIN32_LEAN_AND_MEAN
@@ -118,7 +120,11 @@ void logger_init(const char* log_file_path) {
     unlock_mutex();
 }
 
+static void async_stop(void);
+
 void logger_shutdown(void) {
+    async_stop(); // Drains pending records first
+
     lock_mutex();
     if (g_log_file) {
         fclose(g_log_file);
@@ -153,74 +159,322 @@ double logger_get_trace_interval(void) {
     return g_trace_interval;
 }
 
-void logger_log(LogLevel level, const char* file, int line, const char* fmt, ...) {
-    // Quick check before lock (optimization)
-    // Note: Technically racy but harmless for logging levels
-    if (level < g_console_level && level < g_file_level) {
-        return;
-    }
-
-    // Get time
-    time_t now = time(NULL);
-    struct tm t;
-    safe_localtime(&now, &t);
-    
-    char time_short[16];
-    char time_long[32];
-    strftime(time_short, sizeof(time_short), "%H:%M:%S", &t);
-    strftime(time_long, sizeof(time_long), "%Y-%m-%d %H:%M:%S", &t);
+// --- Output ---
 
-    // Simplify file path
+static const char* short_file_name(const char* file) {
     const char* short_file = strrchr(file, '/');
     if (!short_file) short_file = strrchr(file, '\\'); // Win path support
-    
-    if (short_file) {
-        short_file++; 
-    } else {
-        short_file = file; 
-    }
+    return short_file ? short_file + 1 : file;
+}
 
-    lock_mutex();
+// Caller holds the log lock. Does not flush.
+static void write_record(LogLevel level, time_t when, const char* short_file, int line, const char* message) {
+    struct tm t;
+    safe_localtime(&when, &t);
 
     // Console Output
     if (level >= g_console_level) {
+        char time_short[16];
+        strftime(time_short, sizeof(time_short), "%H:%M:%S", &t);
+
         FILE* out = (level >= LOG_LEVEL_ERROR) ? stderr : stdout;
-        fprintf(out, "%s[%s] [%s]%s %s:%d: ", 
+        fprintf(out, "%s[%s] [%s]%s %s:%d: %s\n", 
             level_colors[level], 
             time_short, 
             level_strings[level],
             reset_color, 
             short_file, 
-            line);
-        
-        va_list args;
-        va_start(args, fmt);
-        vfprintf(out, fmt, args);
-        va_end(args);
-        fprintf(out, "\n");
-        fflush(out); // Ensure console is snappy
+            line,
+            message);
     }
 
     // File Output
     if (g_log_file && level >= g_file_level) {
-        fprintf(g_log_file, "[%s] [%s] %s:%d: ", 
+        char time_long[32];
+        strftime(time_long, sizeof(time_long), "%Y-%m-%d %H:%M:%S", &t);
+
+        fprintf(g_log_file, "[%s] [%s] %s:%d: %s\n", 
             time_long, 
             level_strings[level], 
             short_file, 
-            line);
-        
-        va_list args;
-        va_start(args, fmt);
-        vfprintf(g_log_file, fmt, args);
-        va_end(args);
-        fprintf(g_log_file, "\n");
-        fflush(g_log_file); // Flush file to ensure logs are saved on crash
+            line,
+            message);
+    }
+}
+
+static void flush_outputs(void) {
+    fflush(stdout);
+    fflush(stderr);
+    if (g_log_file) fflush(g_log_file);
+}
+
+// --- Async Ring ---
+// Bounded MPSC queue (sequence-numbered cells). Producers claim a cell with a CAS on
+// the enqueue position and format straight into it; the consumer thread publishes
+// cells back by advancing their sequence. When the ring is full, records below
+// ERROR are dropped and counted, ERROR and above are written synchronously.
+
+typedef struct LogRecord {
+    atomic_size_t sequence;
+    LogLevel level;
+    int line;
+    const char* short_file; // Points into __FILE__ (static storage)
+    time_t time;
+    char message[LOG_MESSAGE_MAX];
+} LogRecord;
+
+typedef struct LogRing {
+    LogRecord* records;
+    size_t mask;
+    atomic_size_t enqueue_pos;
+    atomic_size_t dequeue_pos; // Written by the consumer only
+
+    Thread* consumer;
+    Mutex* wake_lock;
+    ConditionVariable* wake;
+    atomic_bool consumer_sleeping;
+    atomic_bool running;
+} LogRing;
+
+static LogRing g_ring;
+static atomic_bool g_async = false;
+static atomic_uint_fast64_t g_dropped = 0;
+
+static void ring_wake_consumer(void) {
+    // Only pay for the mutex when the consumer is actually parked
+    if (atomic_exchange(&g_ring.consumer_sleeping, false)) {
+        mutex_lock(g_ring.wake_lock);
+        condvar_signal(g_ring.wake);
+        mutex_unlock(g_ring.wake_lock);
+    }
+}
+
+static LogRecord* ring_claim(void) {
+    size_t pos = atomic_load_explicit(&g_ring.enqueue_pos, memory_order_relaxed);
+    for (;;) {
+        LogRecord* record = &g_ring.records[pos & g_ring.mask];
+        size_t seq = atomic_load_explicit(&record->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0) {
+            // seq_cst pairs with the consumer's sleeping-flag store + enqueue_pos re-check
+            if (atomic_compare_exchange_weak_explicit(&g_ring.enqueue_pos, &pos, pos + 1,
+                                                      memory_order_seq_cst, memory_order_relaxed)) {
+                return record;
+            }
+        } else if (diff < 0) {
+            return NULL; // Full
+        } else {
+            pos = atomic_load_explicit(&g_ring.enqueue_pos, memory_order_relaxed);
+        }
+    }
+}
+
+static void ring_publish(LogRecord* record) {
+    size_t pos = atomic_load_explicit(&record->sequence, memory_order_relaxed);
+    atomic_store_explicit(&record->sequence, pos + 1, memory_order_release);
+    ring_wake_consumer();
+}
+
+// Consumer side: writes every ready record under one lock / one flush. Returns count.
+static size_t ring_drain(void) {
+    size_t pos = atomic_load_explicit(&g_ring.dequeue_pos, memory_order_relaxed);
+    size_t written = 0;
+
+    lock_mutex();
+    for (;;) {
+        LogRecord* record = &g_ring.records[pos & g_ring.mask];
+        size_t seq = atomic_load_explicit(&record->sequence, memory_order_acquire);
+        if (seq != pos + 1) break; // Not published yet
+
+        write_record(record->level, record->time, record->short_file, record->line, record->message);
+
+        // Hand the cell back to producers for the next lap
+        atomic_store_explicit(&record->sequence, pos + g_ring.mask + 1, memory_order_release);
+        pos++;
+        written++;
+    }
+    if (written > 0) flush_outputs();
+    unlock_mutex();
+
+    atomic_store_explicit(&g_ring.dequeue_pos, pos, memory_order_release);
+    return written;
+}
+
+static int ring_consumer_main(void* arg) {
+    (void)arg;
+    uint64_t reported_drops = 0;
+
+    while (atomic_load(&g_ring.running)) {
+        if (ring_drain() > 0) continue;
+
+        uint64_t drops = atomic_load(&g_dropped);
+        if (drops != reported_drops) {
+            char message[64];
+            snprintf(message, sizeof(message), "Log ring full: %llu records dropped so far",
+                     (unsigned long long)drops);
+            lock_mutex();
+            write_record(LOG_LEVEL_WARN, time(NULL), short_file_name(__FILE__), __LINE__, message);
+            flush_outputs();
+            unlock_mutex();
+            reported_drops = drops;
+        }
+
+        // Park until a producer publishes (Dekker-style: flag, re-check, wait)
+        mutex_lock(g_ring.wake_lock);
+        atomic_store(&g_ring.consumer_sleeping, true);
+        size_t head = atomic_load(&g_ring.enqueue_pos);
+        if (head == atomic_load(&g_ring.dequeue_pos) && atomic_load(&g_ring.running)) {
+            condvar_wait(g_ring.wake, g_ring.wake_lock);
+        }
+        atomic_store(&g_ring.consumer_sleeping, false);
+        mutex_unlock(g_ring.wake_lock);
     }
 
+    ring_drain(); // Final drain after stop
+    return 0;
+}
+
+static void async_stop(void) {
+    if (!atomic_exchange(&g_async, false)) return;
+
+    mutex_lock(g_ring.wake_lock);
+    atomic_store(&g_ring.running, false);
+    condvar_signal(g_ring.wake);
+    mutex_unlock(g_ring.wake_lock);
+
+    thread_join(g_ring.consumer);
+    condvar_destroy(g_ring.wake);
+    mutex_destroy(g_ring.wake_lock);
+    free(g_ring.records);
+    memset(&g_ring, 0, sizeof(g_ring));
+}
+
+bool logger_set_async(bool enabled) {
+    if (!enabled) {
+        async_stop();
+        return true;
+    }
+    if (atomic_load(&g_async)) return true;
+    if (!g_initialized) return false;
+
+    size_t capacity = LOG_RING_CAPACITY;
+    g_ring.records = (LogRecord*)malloc(capacity * sizeof(LogRecord));
+    g_ring.wake_lock = mutex_create();
+    g_ring.wake = condvar_create();
+    if (!g_ring.records || !g_ring.wake_lock || !g_ring.wake) {
+        fprintf(stderr, "Logger: Failed to allocate async ring\n");
+        free(g_ring.records);
+        if (g_ring.wake) condvar_destroy(g_ring.wake);
+        if (g_ring.wake_lock) mutex_destroy(g_ring.wake_lock);
+        memset(&g_ring, 0, sizeof(g_ring));
+        return false;
+    }
+
+    for (size_t i = 0; i < capacity; ++i) {
+        atomic_init(&g_ring.records[i].sequence, i);
+    }
+    g_ring.mask = capacity - 1;
+    atomic_init(&g_ring.enqueue_pos, 0);
+    atomic_init(&g_ring.dequeue_pos, 0);
+    atomic_init(&g_ring.consumer_sleeping, false);
+    atomic_init(&g_ring.running, true);
+
+    g_ring.consumer = thread_create(ring_consumer_main, NULL);
+    if (!g_ring.consumer) {
+        fprintf(stderr, "Logger: Failed to start async consumer thread\n");
+        condvar_destroy(g_ring.wake);
+        mutex_destroy(g_ring.wake_lock);
+        free(g_ring.records);
+        memset(&g_ring, 0, sizeof(g_ring));
+        return false;
+    }
+
+    atomic_store(&g_async, true);
+    return true;
+}
+
+bool logger_is_async(void) {
+    return atomic_load(&g_async);
+}
+
+uint64_t logger_get_dropped_count(void) {
+    return atomic_load(&g_dropped);
+}
+
+void logger_flush(void) {
+    if (atomic_load(&g_async)) {
+        // Wait until the consumer has written everything enqueued before this call
+        size_t target = atomic_load(&g_ring.enqueue_pos);
+        while (atomic_load_explicit(&g_ring.dequeue_pos, memory_order_acquire) < target) {
+            mutex_lock(g_ring.wake_lock);
+            atomic_store(&g_ring.consumer_sleeping, false);
+            condvar_signal(g_ring.wake);
+            mutex_unlock(g_ring.wake_lock);
+            thread_yield();
+        }
+        return;
+    }
+
+    lock_mutex();
+    flush_outputs();
+    unlock_mutex();
+}
+
+// --- Logging ---
+
+void logger_log(LogLevel level, const char* file, int line, const char* fmt, ...) {
+    // Quick check before lock (optimization)
+    // Note: Technically racy but harmless for logging levels
+    if (level < g_console_level && level < g_file_level) {
+        return;
+    }
+
+    time_t now = time(NULL);
+    const char* short_file = short_file_name(file);
+
+    if (level < LOG_LEVEL_FATAL && atomic_load_explicit(&g_async, memory_order_acquire)) {
+        LogRecord* record = ring_claim();
+        if (record) {
+            record->level = level;
+            record->line = line;
+            record->short_file = short_file;
+            record->time = now;
+            va_list args;
+            va_start(args, fmt);
+            vsnprintf(record->message, sizeof(record->message), fmt, args);
+            va_end(args);
+            ring_publish(record);
+            return;
+        }
+
+        // Ring full: drop low-priority records, never errors
+        if (level < LOG_LEVEL_ERROR) {
+            atomic_fetch_add_explicit(&g_dropped, 1, memory_order_relaxed);
+            return;
+        }
+    }
+
+    // Synchronous path: sync mode, FATAL, or an ERROR that didn't fit the ring
+    char message[LOG_MESSAGE_MAX];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(message, sizeof(message), fmt, args);
+    va_end(args);
+
+    // FATAL: everything logged before it must reach the outputs first
+    if (level == LOG_LEVEL_FATAL) {
+        logger_flush();
+    }
+
+    lock_mutex();
+    write_record(level, now, short_file, line, message);
+    flush_outputs(); // Ensure console is snappy and logs are saved on crash
     unlock_mutex();
 
     if (level == LOG_LEVEL_FATAL) {
-        logger_shutdown(); // Close file properly
+        // The ring stays allocated: other threads may still be formatting into it.
+        // Everything is already flushed, and exit closes the streams.
         exit(1);
     }
 }
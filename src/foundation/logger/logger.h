@@ -1,6 +1,15 @@
 #ifndef LOGGER_H
 #define LOGGER_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
+// Messages longer than this are truncated
+#define LOG_MESSAGE_MAX 1024
+
+// Records buffered in async mode (power of 2)
+#define LOG_RING_CAPACITY 1024
+
 typedef enum LogLevel {
     LOG_LEVEL_TRACE, // Ultra-verbose, per-frame, variable tracing
     LOG_LEVEL_DEBUG, // Diagnostic information for developers
@@ -22,6 +31,23 @@ double logger_get_trace_interval(void);
 
 LogLevel logger_get_level(void); // Gets Console Level
 
+/**
+ * @brief Switches between synchronous and asynchronous output.
+ * In async mode logging threads only format into a lock-free ring; a background
+ * thread does all stdio in batches. When the ring is full, records below ERROR
+ * are dropped (see logger_get_dropped_count). FATAL always flushes before exiting.
+ * Toggle only while no other thread is logging (e.g. right after logger_init).
+ * @return false if the logger is not initialized or the thread could not start.
+ */
+bool logger_set_async(bool enabled);
+bool logger_is_async(void);
+
+// Number of records dropped because the async ring was full.
+uint64_t logger_get_dropped_count(void);
+
+// Blocks until everything logged so far has been written and flushed.
+void logger_flush(void);
+
 // Core logging function
 void logger_log(LogLevel level, const char* file, int line, const char* fmt, ...);
 
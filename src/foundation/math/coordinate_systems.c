@@ -44,13 +44,7 @@ void transform3d_build_matrices(const Transform3D *transform, Mat4 *local_to_wor
     if (safe.scale.y == 0.0f) safe.scale.y = 1.0f;
     if (safe.scale.z == 0.0f) safe.scale.z = 1.0f;
 
-    Mat4 t = mat4_translation(safe.translation);
-    Mat4 r = mat4_rotation_quat(safe.rotation);
-    Mat4 s = mat4_scale(safe.scale);
-
-    Mat4 rs = mat4_multiply(&r, &s);
-    Mat4 trs = mat4_multiply(&t, &rs);
-    if (local_to_world) *local_to_world = trs;
+    if (local_to_world) *local_to_world = mat4_compose(safe.translation, safe.rotation, safe.scale);
 
     Mat4 inv_s = mat4_scale((Vec3){1.0f / safe.scale.x, 1.0f / safe.scale.y, 1.0f / safe.scale.z});
     Mat4 inv_r = mat4_rotation_quat(quat_conjugate(safe.rotation));
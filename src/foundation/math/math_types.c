@@ -1,5 +1,25 @@
 #include "math_types.h"
 #include <math.h>
+#include <string.h>
+
+#if !defined(MATH_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MATH_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif !defined(MATH_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define MATH_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+const char* math_simd_backend(void)
+{
+#if defined(MATH_SIMD_SSE2)
+    return "SSE2";
+#elif defined(MATH_SIMD_NEON)
+    return "NEON";
+#else
+    return "Scalar";
+#endif
+}
 
 Mat4 mat4_identity(void)
 {
@@ -27,7 +47,7 @@ Mat4 mat4_scale(Vec3 s)
     return m;
 }
 
-Quat quat_normalize(Quat q)
+Quat quat_normalize_scalar(Quat q)
 {
     float len = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
     if (len <= 0.0f) {
@@ -37,11 +57,87 @@ Quat quat_normalize(Quat q)
     return (Quat){q.x * inv, q.y * inv, q.z * inv, q.w * inv};
 }
 
+Quat quat_normalize(Quat q)
+{
+#if defined(MATH_SIMD_SSE2)
+    __m128 v = _mm_loadu_ps(&q.x);
+    __m128 sq = _mm_mul_ps(v, v);
+    sq = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(1, 0, 3, 2)));
+    sq = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+    __m128 len = _mm_sqrt_ps(sq);
+    if (_mm_cvtss_f32(len) <= 0.0f) {
+        return (Quat){0.0f, 0.0f, 0.0f, 1.0f};
+    }
+    Quat r;
+    _mm_storeu_ps(&r.x, _mm_div_ps(v, len));
+    return r;
+#elif defined(MATH_SIMD_NEON)
+    float32x4_t v = vld1q_f32(&q.x);
+    float32x4_t sq = vmulq_f32(v, v);
+    float32x2_t half = vadd_f32(vget_low_f32(sq), vget_high_f32(sq));
+    float len = sqrtf(vget_lane_f32(vpadd_f32(half, half), 0));
+    if (len <= 0.0f) {
+        return (Quat){0.0f, 0.0f, 0.0f, 1.0f};
+    }
+    Quat r;
+    vst1q_f32(&r.x, vmulq_n_f32(v, 1.0f / len));
+    return r;
+#else
+    return quat_normalize_scalar(q);
+#endif
+}
+
 Quat quat_conjugate(Quat q)
 {
     return (Quat){-q.x, -q.y, -q.z, q.w};
 }
 
+Quat quat_multiply_scalar(Quat a, Quat b)
+{
+    Quat r;
+    r.x = a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y;
+    r.y = a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x;
+    r.z = a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w;
+    r.w = a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z;
+    return r;
+}
+
+Quat quat_multiply(Quat a, Quat b)
+{
+    // r = a.w * b + a.x * (bw,-bz,by,-bx) + a.y * (bz,bw,-bx,-by) + a.z * (-by,bx,bw,-bz)
+#if defined(MATH_SIMD_SSE2)
+    __m128 vb = _mm_loadu_ps(&b.x);
+    __m128 r = _mm_mul_ps(_mm_set1_ps(a.w), vb);
+    __m128 bx = _mm_mul_ps(_mm_shuffle_ps(vb, vb, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f));
+    __m128 by = _mm_mul_ps(_mm_shuffle_ps(vb, vb, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(1.0f, 1.0f, -1.0f, -1.0f));
+    __m128 bz = _mm_mul_ps(_mm_shuffle_ps(vb, vb, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a.x), bx));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a.y), by));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a.z), bz));
+    Quat out;
+    _mm_storeu_ps(&out.x, r);
+    return out;
+#elif defined(MATH_SIMD_NEON)
+    static const float sign_x[4] = {1.0f, -1.0f, 1.0f, -1.0f};
+    static const float sign_y[4] = {1.0f, 1.0f, -1.0f, -1.0f};
+    static const float sign_z[4] = {-1.0f, 1.0f, 1.0f, -1.0f};
+    float32x4_t vb = vld1q_f32(&b.x);
+    float32x4_t rev = vrev64q_f32(vb);                                       // by bx bw bz
+    float32x4_t bx = vmulq_f32(vextq_f32(rev, rev, 2), vld1q_f32(sign_x));   // bw bz by bx
+    float32x4_t by = vmulq_f32(vextq_f32(vb, vb, 2), vld1q_f32(sign_y));     // bz bw bx by
+    float32x4_t bz = vmulq_f32(rev, vld1q_f32(sign_z));                      // by bx bw bz
+    float32x4_t r = vmulq_n_f32(vb, a.w);
+    r = vmlaq_n_f32(r, bx, a.x);
+    r = vmlaq_n_f32(r, by, a.y);
+    r = vmlaq_n_f32(r, bz, a.z);
+    Quat out;
+    vst1q_f32(&out.x, r);
+    return out;
+#else
+    return quat_multiply_scalar(a, b);
+#endif
+}
+
 Quat quat_from_euler(EulerAngles euler)
 {
     float cy = cosf(euler.yaw * 0.5f);
@@ -93,7 +189,7 @@ Mat4 mat4_rotation_euler(EulerAngles euler)
     return mat4_rotation_quat(quat_from_euler(euler));
 }
 
-Mat4 mat4_multiply(const Mat4 *a, const Mat4 *b)
+Mat4 mat4_multiply_scalar(const Mat4 *a, const Mat4 *b)
 {
     Mat4 r = {0};
     for (int row = 0; row < 4; ++row) {
@@ -107,12 +203,82 @@ Mat4 mat4_multiply(const Mat4 *a, const Mat4 *b)
     return r;
 }
 
+// --- SIMD Kernels ---
+// Each result column is a linear combination of a's columns, weighted by b's column.
+// All of b is read before 'out' is written, so out may alias b.
+
+#if defined(MATH_SIMD_SSE2)
+static inline void mat4_mul_sse(__m128 a0, __m128 a1, __m128 a2, __m128 a3, const float *b, float *out)
+{
+    __m128 r[4];
+    for (int c = 0; c < 4; ++c) {
+        const float *bc = b + c * 4;
+        __m128 v = _mm_mul_ps(a0, _mm_set1_ps(bc[0]));
+        v = _mm_add_ps(v, _mm_mul_ps(a1, _mm_set1_ps(bc[1])));
+        v = _mm_add_ps(v, _mm_mul_ps(a2, _mm_set1_ps(bc[2])));
+        v = _mm_add_ps(v, _mm_mul_ps(a3, _mm_set1_ps(bc[3])));
+        r[c] = v;
+    }
+    _mm_storeu_ps(out + 0, r[0]);
+    _mm_storeu_ps(out + 4, r[1]);
+    _mm_storeu_ps(out + 8, r[2]);
+    _mm_storeu_ps(out + 12, r[3]);
+}
+
+static inline __m128 mat4_apply_sse(__m128 c0, __m128 c1, __m128 c2, __m128 c3, float x, float y, float z, float w)
+{
+    __m128 v = _mm_mul_ps(c0, _mm_set1_ps(x));
+    v = _mm_add_ps(v, _mm_mul_ps(c1, _mm_set1_ps(y)));
+    v = _mm_add_ps(v, _mm_mul_ps(c2, _mm_set1_ps(z)));
+    return _mm_add_ps(v, _mm_mul_ps(c3, _mm_set1_ps(w)));
+}
+#elif defined(MATH_SIMD_NEON)
+static inline void mat4_mul_neon(float32x4_t a0, float32x4_t a1, float32x4_t a2, float32x4_t a3, const float *b, float *out)
+{
+    float32x4_t r[4];
+    for (int c = 0; c < 4; ++c) {
+        const float *bc = b + c * 4;
+        float32x4_t v = vmulq_n_f32(a0, bc[0]);
+        v = vmlaq_n_f32(v, a1, bc[1]);
+        v = vmlaq_n_f32(v, a2, bc[2]);
+        r[c] = vmlaq_n_f32(v, a3, bc[3]);
+    }
+    vst1q_f32(out + 0, r[0]);
+    vst1q_f32(out + 4, r[1]);
+    vst1q_f32(out + 8, r[2]);
+    vst1q_f32(out + 12, r[3]);
+}
+
+static inline float32x4_t mat4_apply_neon(float32x4_t c0, float32x4_t c1, float32x4_t c2, float32x4_t c3, float x, float y, float z, float w)
+{
+    float32x4_t v = vmulq_n_f32(c0, x);
+    v = vmlaq_n_f32(v, c1, y);
+    v = vmlaq_n_f32(v, c2, z);
+    return vmlaq_n_f32(v, c3, w);
+}
+#endif
+
+Mat4 mat4_multiply(const Mat4 *a, const Mat4 *b)
+{
+#if defined(MATH_SIMD_SSE2)
+    Mat4 r;
+    mat4_mul_sse(_mm_loadu_ps(a->m), _mm_loadu_ps(a->m + 4), _mm_loadu_ps(a->m + 8), _mm_loadu_ps(a->m + 12), b->m, r.m);
+    return r;
+#elif defined(MATH_SIMD_NEON)
+    Mat4 r;
+    mat4_mul_neon(vld1q_f32(a->m), vld1q_f32(a->m + 4), vld1q_f32(a->m + 8), vld1q_f32(a->m + 12), b->m, r.m);
+    return r;
+#else
+    return mat4_multiply_scalar(a, b);
+#endif
+}
+
 static float mat4_det3x3(float a1, float a2, float a3, float b1, float b2, float b3, float c1, float c2, float c3)
 {
     return a1 * (b2 * c3 - b3 * c2) - a2 * (b1 * c3 - b3 * c1) + a3 * (b1 * c2 - b2 * c1);
 }
 
-Mat4 mat4_inverse(const Mat4 *m)
+Mat4 mat4_inverse_scalar(const Mat4 *m)
 {
     Mat4 inv;
     float det;
@@ -149,6 +315,87 @@ Mat4 mat4_inverse(const Mat4 *m)
     return inv;
 }
 
+#if defined(MATH_SIMD_SSE2)
+// 2x2 block inverse. Each __m128 holds a 2x2 block; the math is transpose-agnostic,
+// so working on columns yields the column-major inverse directly.
+#define MATH_SHUFFLE(a, b, x, y, z, w) _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x))
+#define MATH_SWIZZLE(v, x, y, z, w) MATH_SHUFFLE(v, v, x, y, z, w)
+
+static inline __m128 mat2_mul(__m128 a, __m128 b)
+{
+    return _mm_add_ps(_mm_mul_ps(a, MATH_SWIZZLE(b, 0, 3, 0, 3)),
+                      _mm_mul_ps(MATH_SWIZZLE(a, 1, 0, 3, 2), MATH_SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+// adj(a) * b
+static inline __m128 mat2_adj_mul(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(MATH_SWIZZLE(a, 3, 3, 0, 0), b),
+                      _mm_mul_ps(MATH_SWIZZLE(a, 1, 1, 2, 2), MATH_SWIZZLE(b, 2, 3, 0, 1)));
+}
+
+// a * adj(b)
+static inline __m128 mat2_mul_adj(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(a, MATH_SWIZZLE(b, 3, 0, 3, 0)),
+                      _mm_mul_ps(MATH_SWIZZLE(a, 1, 0, 3, 2), MATH_SWIZZLE(b, 2, 1, 2, 1)));
+}
+#endif
+
+Mat4 mat4_inverse(const Mat4 *m)
+{
+#if defined(MATH_SIMD_SSE2)
+    __m128 c0 = _mm_loadu_ps(m->m), c1 = _mm_loadu_ps(m->m + 4);
+    __m128 c2 = _mm_loadu_ps(m->m + 8), c3 = _mm_loadu_ps(m->m + 12);
+
+    __m128 a = _mm_movelh_ps(c0, c1);
+    __m128 b = _mm_movehl_ps(c1, c0);
+    __m128 c = _mm_movelh_ps(c2, c3);
+    __m128 d = _mm_movehl_ps(c3, c2);
+
+    // Determinants of the four blocks
+    __m128 det_sub = _mm_sub_ps(_mm_mul_ps(MATH_SHUFFLE(c0, c2, 0, 2, 0, 2), MATH_SHUFFLE(c1, c3, 1, 3, 1, 3)),
+                                _mm_mul_ps(MATH_SHUFFLE(c0, c2, 1, 3, 1, 3), MATH_SHUFFLE(c1, c3, 0, 2, 0, 2)));
+    __m128 det_a = MATH_SWIZZLE(det_sub, 0, 0, 0, 0);
+    __m128 det_b = MATH_SWIZZLE(det_sub, 1, 1, 1, 1);
+    __m128 det_c = MATH_SWIZZLE(det_sub, 2, 2, 2, 2);
+    __m128 det_d = MATH_SWIZZLE(det_sub, 3, 3, 3, 3);
+
+    __m128 d_c = mat2_adj_mul(d, c);
+    __m128 a_b = mat2_adj_mul(a, b);
+    __m128 x = _mm_sub_ps(_mm_mul_ps(det_d, a), mat2_mul(b, d_c));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(det_a, d), mat2_mul(c, a_b));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(det_b, c), mat2_mul_adj(d, a_b));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(det_c, b), mat2_mul_adj(a, d_c));
+
+    __m128 det = _mm_add_ps(_mm_mul_ps(det_a, det_d), _mm_mul_ps(det_b, det_c));
+    __m128 tr = _mm_mul_ps(a_b, MATH_SWIZZLE(d_c, 0, 2, 1, 3));
+    tr = _mm_add_ps(tr, MATH_SWIZZLE(tr, 2, 3, 0, 1));
+    tr = _mm_add_ps(tr, MATH_SWIZZLE(tr, 1, 0, 3, 2));
+    det = _mm_sub_ps(det, tr);
+
+    if (fabsf(_mm_cvtss_f32(det)) < 1e-6f) {
+        return mat4_identity();
+    }
+
+    __m128 inv_det = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+    x = _mm_mul_ps(x, inv_det);
+    y = _mm_mul_ps(y, inv_det);
+    z = _mm_mul_ps(z, inv_det);
+    w = _mm_mul_ps(w, inv_det);
+
+    Mat4 r;
+    _mm_storeu_ps(r.m, MATH_SHUFFLE(x, y, 3, 1, 3, 1));
+    _mm_storeu_ps(r.m + 4, MATH_SHUFFLE(x, y, 2, 0, 2, 0));
+    _mm_storeu_ps(r.m + 8, MATH_SHUFFLE(z, w, 3, 1, 3, 1));
+    _mm_storeu_ps(r.m + 12, MATH_SHUFFLE(z, w, 2, 0, 2, 0));
+    return r;
+#else
+    // NEON: the cofactor expansion auto-vectorizes reasonably; no hand-written path yet
+    return mat4_inverse_scalar(m);
+#endif
+}
+
 Mat4 mat4_perspective(float fov_y_radians, float aspect, float near_z, float far_z)
 {
     float f = 1.0f / tanf(fov_y_radians * 0.5f);
@@ -195,3 +442,141 @@ Vec3 mat4_transform_direction(const Mat4 *m, Vec3 v)
     float z = v.x * m->m[2] + v.y * m->m[6] + v.z * m->m[10];
     return (Vec3){x, y, z};
 }
+
+Vec4 mat4_transform_vec4_scalar(const Mat4 *m, Vec4 v)
+{
+    Vec4 r;
+    r.x = v.x * m->m[0] + v.y * m->m[4] + v.z * m->m[8] + v.w * m->m[12];
+    r.y = v.x * m->m[1] + v.y * m->m[5] + v.z * m->m[9] + v.w * m->m[13];
+    r.z = v.x * m->m[2] + v.y * m->m[6] + v.z * m->m[10] + v.w * m->m[14];
+    r.w = v.x * m->m[3] + v.y * m->m[7] + v.z * m->m[11] + v.w * m->m[15];
+    return r;
+}
+
+Vec4 mat4_transform_vec4(const Mat4 *m, Vec4 v)
+{
+#if defined(MATH_SIMD_SSE2)
+    Vec4 r;
+    _mm_storeu_ps(&r.x, mat4_apply_sse(_mm_loadu_ps(m->m), _mm_loadu_ps(m->m + 4), _mm_loadu_ps(m->m + 8),
+                                       _mm_loadu_ps(m->m + 12), v.x, v.y, v.z, v.w));
+    return r;
+#elif defined(MATH_SIMD_NEON)
+    Vec4 r;
+    vst1q_f32(&r.x, mat4_apply_neon(vld1q_f32(m->m), vld1q_f32(m->m + 4), vld1q_f32(m->m + 8),
+                                    vld1q_f32(m->m + 12), v.x, v.y, v.z, v.w));
+    return r;
+#else
+    return mat4_transform_vec4_scalar(m, v);
+#endif
+}
+
+Mat4 mat4_translation_scale(Vec3 t, Vec3 s)
+{
+    Mat4 m = {0};
+    m.m[0] = s.x;
+    m.m[5] = s.y;
+    m.m[10] = s.z;
+    m.m[12] = t.x;
+    m.m[13] = t.y;
+    m.m[14] = t.z;
+    m.m[15] = 1.0f;
+    return m;
+}
+
+Mat4 mat4_compose(Vec3 t, Quat r, Vec3 s)
+{
+    // R * S scales R's columns; T only fills the last column
+    Mat4 m = mat4_rotation_quat(r);
+    for (int i = 0; i < 3; ++i) {
+        m.m[0 + i] *= s.x;
+        m.m[4 + i] *= s.y;
+        m.m[8 + i] *= s.z;
+    }
+    m.m[12] = t.x;
+    m.m[13] = t.y;
+    m.m[14] = t.z;
+    return m;
+}
+
+// --- GPU Packing ---
+
+uint16_t math_float_to_half(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    uint32_t f_exp = (bits >> 23) & 0xFFu;
+    uint32_t mant = bits & 0x7FFFFFu;
+    int32_t exp = (int32_t)f_exp - 127 + 15;
+
+    if (f_exp == 0xFFu) return (uint16_t)(sign | 0x7C00u | (mant ? 0x200u : 0u)); // Inf / NaN
+    if (exp >= 31) return (uint16_t)(sign | 0x7C00u);                            // Overflow
+    if (exp <= 0) {
+        if (exp < -10) return (uint16_t)sign; // Underflow to signed zero
+        // Subnormal: value = (1.mant) * 2^(exp - 15) = half_mant * 2^-24
+        mant |= 0x800000u;
+        uint32_t shift = (uint32_t)(14 - exp);
+        uint32_t half = mant >> shift;
+        if ((mant >> (shift - 1)) & 1u) half++;
+        return (uint16_t)(sign | half);
+    }
+
+    // Rounding may carry into the exponent, which is the correct result (up to inf)
+    uint32_t half = ((uint32_t)exp << 10) | (mant >> 13);
+    if (mant & 0x1000u) half++;
+    return (uint16_t)(sign | half);
+}
+
+float math_half_to_float(uint16_t half)
+{
+    uint32_t sign = (uint32_t)(half & 0x8000u) << 16;
+    uint32_t exp = (half >> 10) & 0x1Fu;
+    uint32_t mant = half & 0x3FFu;
+    uint32_t bits;
+
+    if (exp == 0) {
+        if (mant == 0) {
+            bits = sign;
+        } else {
+            // Normalize the subnormal
+            exp = 127 - 15 + 1;
+            while (!(mant & 0x400u)) {
+                mant <<= 1;
+                exp--;
+            }
+            bits = sign | (exp << 23) | ((mant & 0x3FFu) << 13);
+        }
+    } else if (exp == 31) {
+        bits = sign | 0x7F800000u | (mant << 13);
+    } else {
+        bits = sign | ((exp - 15 + 127) << 23) | (mant << 13);
+    }
+
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint32_t math_pack_half2(float x, float y)
+{
+    return (uint32_t)math_float_to_half(x) | ((uint32_t)math_float_to_half(y) << 16);
+}
+
+static uint32_t pack_unorm(float v, float scale)
+{
+    if (!(v > 0.0f)) return 0; // Also catches NaN
+    if (v >= 1.0f) return (uint32_t)scale;
+    return (uint32_t)(v * scale + 0.5f);
+}
+
+uint32_t math_pack_unorm2x16(float x, float y)
+{
+    return pack_unorm(x, 65535.0f) | (pack_unorm(y, 65535.0f) << 16);
+}
+
+uint32_t math_pack_unorm4x8(Vec4 v)
+{
+    return pack_unorm(v.x, 255.0f) | (pack_unorm(v.y, 255.0f) << 8) |
+           (pack_unorm(v.z, 255.0f) << 16) | (pack_unorm(v.w, 255.0f) << 24);
+}
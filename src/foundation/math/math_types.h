@@ -1,6 +1,8 @@
 #ifndef MATH_TYPES_H
 #define MATH_TYPES_H
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -47,6 +49,14 @@ typedef struct Mat4 {
     float m[16];
 } Mat4;
 
+// --- SIMD ---
+// Mat4 multiply/inverse, Vec4 transforms and Quat ops use SSE2 (x86-64) or NEON (ARM64)
+// when available, with the scalar implementation as fallback. Define MATH_NO_SIMD to
+// force the scalar path. Matrices are column-major and need no special alignment.
+
+// "SSE2", "NEON" or "Scalar"
+const char* math_simd_backend(void);
+
 Mat4 mat4_identity(void);
 Mat4 mat4_translation(Vec3 t);
 Mat4 mat4_scale(Vec3 s);
@@ -58,10 +68,32 @@ Mat4 mat4_perspective(float fov_y_radians, float aspect, float near_z, float far
 Mat4 mat4_orthographic(float left, float right, float bottom, float top, float near_z, float far_z);
 Vec3 mat4_transform_point(const Mat4 *m, Vec3 p);
 Vec3 mat4_transform_direction(const Mat4 *m, Vec3 v);
+Vec4 mat4_transform_vec4(const Mat4 *m, Vec4 v);
+
+// Closed forms of common products (no matrix multiply)
+Mat4 mat4_translation_scale(Vec3 t, Vec3 s);   // T * S
+Mat4 mat4_compose(Vec3 t, Quat r, Vec3 s);     // T * R * S
 
 Quat quat_from_euler(EulerAngles euler);
 Quat quat_conjugate(Quat q);
 Quat quat_normalize(Quat q);
+Quat quat_multiply(Quat a, Quat b); // Hamilton product: apply b, then a
+
+// --- GPU Packing ---
+// Bit-compatible with GLSL unpackHalf2x16 / unpackUnorm2x16 / unpackUnorm4x8 (x in the low bits).
+uint16_t math_float_to_half(float value); // Round to nearest, overflow -> inf
+float math_half_to_float(uint16_t half);
+uint32_t math_pack_half2(float x, float y);
+uint32_t math_pack_unorm2x16(float x, float y); // Clamped to [0, 1]
+uint32_t math_pack_unorm4x8(Vec4 v);            // Clamped to [0, 1]
+
+// --- Scalar Reference ---
+// Portable implementations; the fallback path and the baseline for accuracy tests.
+Mat4 mat4_multiply_scalar(const Mat4 *a, const Mat4 *b);
+Mat4 mat4_inverse_scalar(const Mat4 *m);
+Vec4 mat4_transform_vec4_scalar(const Mat4 *m, Vec4 v);
+Quat quat_normalize_scalar(Quat q);
+Quat quat_multiply_scalar(Quat a, Quat b);
 
 #ifdef __cplusplus
 }
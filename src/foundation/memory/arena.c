@@ -1,3 +1,7 @@
+#if !defined(_WIN32) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE // NOLINT(bugprone-reserved-identifier): MAP_ANONYMOUS on Linux
+#endif
+
 #include "foundation/memory/arena.h"
 #include <stdlib.h>
 #include <stdint.h>
@@ -5,7 +9,45 @@
 #include <stdio.h>
 #include <stdarg.h>
 
-#define DEFAULT_ALIGNMENT 8
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+
+    static void* vm_reserve(size_t size) {
+        return VirtualAlloc(NULL, size, MEM_RESERVE, PAGE_NOACCESS);
+    }
+
+    static bool vm_commit(void* ptr, size_t size) {
+        return VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) != NULL;
+    }
+
+    static void vm_release(void* ptr, size_t size) {
+        (void)size;
+        VirtualFree(ptr, 0, MEM_RELEASE);
+    }
+#else
+    #include <sys/mman.h>
+
+    #if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+        #define MAP_ANONYMOUS MAP_ANON
+    #endif
+    #ifndef MAP_NORESERVE
+        #define MAP_NORESERVE 0
+    #endif
+
+    static void* vm_reserve(size_t size) {
+        void* ptr = mmap(NULL, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        return ptr == MAP_FAILED ? NULL : ptr;
+    }
+
+    static bool vm_commit(void* ptr, size_t size) {
+        return mprotect(ptr, size, PROT_READ | PROT_WRITE) == 0;
+    }
+
+    static void vm_release(void* ptr, size_t size) {
+        munmap(ptr, size);
+    }
+#endif
 
 static uintptr_t align_forward(uintptr_t ptr, size_t align) {
     uintptr_t p, a, modulo;
@@ -28,39 +70,91 @@ bool arena_init(MemoryArena* arena, size_t size) {
     arena->size = size;
     arena->offset = 0;
     arena->committed = size;
+    arena->is_virtual = false;
+    return true;
+}
+
+bool arena_init_virtual(MemoryArena* arena, size_t reserve_size) {
+    if (!arena || reserve_size == 0) return false;
+    reserve_size = align_forward(reserve_size, ARENA_COMMIT_GRANULARITY);
+    arena->base = (uint8_t*)vm_reserve(reserve_size);
+    if (!arena->base) return false;
+    arena->size = reserve_size;
+    arena->offset = 0;
+    arena->committed = 0;
+    arena->is_virtual = true;
     return true;
 }
 
 void arena_destroy(MemoryArena* arena) {
     if (arena && arena->base) {
-        free(arena->base);
+        if (arena->is_virtual) {
+            vm_release(arena->base, arena->size);
+        } else {
+            free(arena->base);
+        }
         arena->base = NULL;
         arena->size = 0;
         arena->offset = 0;
+        arena->committed = 0;
     }
 }
 
 void arena_reset(MemoryArena* arena) {
+    // Committed pages are kept: next frame reuses them without page faults
     if (arena) arena->offset = 0;
 }
 
-void* arena_alloc(MemoryArena* arena, size_t size) {
-    if (!arena || size == 0) return NULL;
+static bool arena_ensure_committed(MemoryArena* arena, size_t end) {
+    if (end <= arena->committed) return true;
+    if (!arena->is_virtual) return false;
+
+    size_t new_committed = align_forward(end, ARENA_COMMIT_GRANULARITY);
+    if (new_committed > arena->size) new_committed = arena->size;
+
+    if (!vm_commit(arena->base + arena->committed, new_committed - arena->committed)) {
+        return false;
+    }
+    arena->committed = new_committed;
+    return true;
+}
+
+void* arena_alloc_aligned(MemoryArena* arena, size_t size, size_t alignment) {
+    if (!arena || !arena->base || size == 0) return NULL;
     
     // Align current offset
     uintptr_t current_ptr = (uintptr_t)(arena->base + arena->offset);
-    uintptr_t offset = align_forward(current_ptr, DEFAULT_ALIGNMENT);
+    uintptr_t offset = align_forward(current_ptr, alignment);
+    if (offset == 0) return NULL; // Invalid alignment
     offset -= (uintptr_t)arena->base; // Convert back to relative offset
 
-    if (offset + size > arena->size) {
+    if (offset + size > arena->size || offset + size < offset) {
         return NULL; // Out of memory
     }
+    if (!arena_ensure_committed(arena, offset + size)) {
+        return NULL; // OS refused to commit
+    }
 
     void* ptr = arena->base + offset;
     arena->offset = offset + size;
     return ptr;
 }
 
+void* arena_alloc(MemoryArena* arena, size_t size) {
+    return arena_alloc_aligned(arena, size, ARENA_DEFAULT_ALIGNMENT);
+}
+
+ArenaMark arena_mark(MemoryArena* arena) {
+    ArenaMark mark = { arena, arena ? arena->offset : 0 };
+    return mark;
+}
+
+void arena_rewind(ArenaMark mark) {
+    if (mark.arena && mark.offset <= mark.arena->offset) {
+        mark.arena->offset = mark.offset;
+    }
+}
+
 void* arena_alloc_zero(MemoryArena* arena, size_t size) {
     void* ptr = arena_alloc(arena, size);
     if (ptr) {
@@ -77,7 +171,7 @@ char* arena_push_string(MemoryArena* arena, const char* str) {
 
 char* arena_push_string_n(MemoryArena* arena, const char* str, size_t n) {
     if (!arena || !str) return NULL;
-    char* data = (char*)arena_alloc(arena, n + 1);
+    char* data = (char*)arena_alloc_aligned(arena, n + 1, 1);
     if (data) {
         memcpy(data, str, n);
         data[n] = '\0';
@@ -95,7 +189,7 @@ char* arena_sprintf(MemoryArena* arena, const char* fmt, ...) {
 
     if (len < 0) return NULL;
 
-    char* data = (char*)arena_alloc(arena, len + 1);
+    char* data = (char*)arena_alloc_aligned(arena, (size_t)len + 1, 1);
     if (!data) return NULL;
 
     va_start(args, fmt);
@@ -121,36 +215,13 @@ char* arena_printf(MemoryArena* arena, const char* fmt, ...) {
         return NULL;
     }
 
-    // Check capacity
-    if (arena->offset + len + 1 > arena->size) {
-        va_end(args);
-        return NULL;
+    // Goes through the regular allocation path so virtual arenas can commit more pages.
+    // Each call produces its own null-terminated string; use a string builder to concatenate.
+    char* ptr = (char*)arena_alloc_aligned(arena, (size_t)len + 1, 1);
+    if (ptr) {
+        vsnprintf(ptr, (size_t)len + 1, fmt, args);
     }
     
-    // Write directly to current offset
-    char* ptr = (char*)(arena->base + arena->offset);
-    // Note: vsnprintf writes the null terminator, so we will overwrite it on next call if we backup?
-    // Actually, for a string builder, we usually want to overwrite the previous null terminator.
-    // But `arena` logic is append-only.
-    // Let's just write. The user will have a bunch of null-terminated strings one after another.
-    // Wait, for Transpiler we want ONE big string.
-    // So `arena_printf` is NOT suitable for building a single string unless we manually manage the null terminator.
-    
-    // Better approach for Transpiler: Use `arena` as the backing buffer for a custom StringBuilder.
-    // But let's keep it simple.
-    
-    vsnprintf(ptr, len + 1, fmt, args);
-    arena->offset += len; // We advance by len, NOT len+1, to effectively overwrite the null terminator next time? 
-                          // No, `vsnprintf` always writes \0.
-                          // If we want to concatenate, we should probably backup 1 byte if the previous alloc was a string?
-                          // Too complex for generic arena.
-                          
-    // Let's just advance full length including \0.
-    // If the user wants to concatenate, they should use a specific StringBuilder logic.
-    // BUT, for this task, I will implement a `ArenaStringBuilder` in transpiler.c that uses the arena.
-    
-    arena->offset += (len + 1);
-    
     va_end(args);
     return ptr;
 }
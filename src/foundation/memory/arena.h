@@ -5,16 +5,33 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+// Alignment used by arena_alloc (matches malloc guarantees)
+#define ARENA_DEFAULT_ALIGNMENT (_Alignof(max_align_t))
+
+// Virtual arenas commit pages in chunks of this size
+#define ARENA_COMMIT_GRANULARITY (64 * 1024)
+
 typedef struct MemoryArena {
     uint8_t* base;
-    size_t size;
+    size_t size;      // Capacity. For virtual arenas: the reserved address range.
     size_t offset;
-    size_t committed; // For future virtual memory support
+    size_t committed; // Bytes backed by memory (== size for heap arenas)
+    bool is_virtual;
 } MemoryArena;
 
+// Saved arena position. Rewinding frees everything allocated after the mark.
+typedef struct ArenaMark {
+    MemoryArena* arena;
+    size_t offset;
+} ArenaMark;
+
 // Initialize an arena with a fixed size block allocated from heap
 bool arena_init(MemoryArena* arena, size_t size);
 
+// Initialize an arena that reserves 'reserve_size' bytes of address space and
+// commits pages on demand. Allocation only fails once the reservation is exhausted.
+bool arena_init_virtual(MemoryArena* arena, size_t reserve_size);
+
 // Free the underlying memory
 void arena_destroy(MemoryArena* arena);
 
@@ -24,9 +41,16 @@ void arena_reset(MemoryArena* arena);
 // Allocate 'size' bytes from the arena. Returns NULL if out of memory.
 void* arena_alloc(MemoryArena* arena, size_t size);
 
+// Allocate with explicit alignment (must be a power of 2).
+void* arena_alloc_aligned(MemoryArena* arena, size_t size, size_t alignment);
+
 // Allocate and zero-initialize
 void* arena_alloc_zero(MemoryArena* arena, size_t size);
 
+// Temporary allocations: mark, allocate, rewind.
+ArenaMark arena_mark(MemoryArena* arena);
+void arena_rewind(ArenaMark mark);
+
 // Utilities
 char* arena_push_string(MemoryArena* arena, const char* str);
 char* arena_push_string_n(MemoryArena* arena, const char* str, size_t n);
@@ -0,0 +1,185 @@
+#include "handle_pool.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define HANDLE_GENERATION_MAX ((1u << HANDLE_GENERATION_BITS) - 1u)
+#define SLOT_FREE_END 0xFFFFFFFFu
+
+// --- Internal Types ---
+
+struct HandlePool {
+    size_t item_size;
+
+    // Dense: packed live objects + owning slot of each
+    uint8_t* objects;
+    uint32_t* dense_to_slot;
+    uint32_t count;
+
+    // Sparse: per-slot dense index (or next free slot) and generation
+    uint32_t* slot_data;
+    uint32_t* generations;
+    uint32_t slot_count;   // Slots ever handed out
+    uint32_t capacity;     // Allocated slots / dense entries
+    uint32_t free_head;    // Free-list of recycled slots
+};
+
+static Handle make_handle(uint32_t slot, uint32_t generation) {
+    return (generation << HANDLE_INDEX_BITS) | slot;
+}
+
+static bool handle_pool_grow(HandlePool* pool, uint32_t min_capacity) {
+    uint32_t new_cap = pool->capacity ? pool->capacity * 2 : 64;
+    if (new_cap < min_capacity) new_cap = min_capacity;
+    if (new_cap > HANDLE_MAX_COUNT) new_cap = HANDLE_MAX_COUNT;
+    if (new_cap <= pool->capacity) return false; // Index space exhausted
+
+    uint8_t* objects = (uint8_t*)realloc(pool->objects, (size_t)new_cap * pool->item_size);
+    if (!objects) return false;
+    pool->objects = objects;
+
+    uint32_t* dense_to_slot = (uint32_t*)realloc(pool->dense_to_slot, new_cap * sizeof(uint32_t));
+    if (!dense_to_slot) return false;
+    pool->dense_to_slot = dense_to_slot;
+
+    uint32_t* slot_data = (uint32_t*)realloc(pool->slot_data, new_cap * sizeof(uint32_t));
+    if (!slot_data) return false;
+    pool->slot_data = slot_data;
+
+    uint32_t* generations = (uint32_t*)realloc(pool->generations, new_cap * sizeof(uint32_t));
+    if (!generations) return false;
+    pool->generations = generations;
+
+    pool->capacity = new_cap;
+    return true;
+}
+
+// --- Implementation ---
+
+HandlePool* handle_pool_create(size_t item_size, uint32_t initial_capacity) {
+    if (item_size == 0) return NULL;
+
+    HandlePool* pool = (HandlePool*)calloc(1, sizeof(HandlePool));
+    if (!pool) return NULL;
+
+    pool->item_size = item_size;
+    pool->free_head = SLOT_FREE_END;
+
+    if (initial_capacity > 0 && !handle_pool_grow(pool, initial_capacity)) {
+        handle_pool_destroy(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+void handle_pool_destroy(HandlePool* pool) {
+    if (!pool) return;
+    free(pool->objects);
+    free(pool->dense_to_slot);
+    free(pool->slot_data);
+    free(pool->generations);
+    free(pool);
+}
+
+Handle handle_pool_alloc(HandlePool* pool, void** out_ptr) {
+    if (out_ptr) *out_ptr = NULL;
+    if (!pool) return HANDLE_INVALID;
+
+    // 1. Pick a slot: recycled first, then fresh
+    uint32_t slot;
+    if (pool->free_head != SLOT_FREE_END) {
+        slot = pool->free_head;
+        pool->free_head = pool->slot_data[slot];
+    } else {
+        if (pool->slot_count >= pool->capacity && !handle_pool_grow(pool, pool->slot_count + 1)) {
+            return HANDLE_INVALID;
+        }
+        slot = pool->slot_count++;
+        pool->generations[slot] = 1;
+    }
+
+    // 2. Append to dense array (dense count <= slot count <= capacity)
+    uint32_t dense = pool->count++;
+    pool->slot_data[slot] = dense;
+    pool->dense_to_slot[dense] = slot;
+
+    if (out_ptr) *out_ptr = pool->objects + (size_t)dense * pool->item_size;
+    return make_handle(slot, pool->generations[slot]);
+}
+
+Handle handle_pool_alloc_zero(HandlePool* pool, void** out_ptr) {
+    void* ptr = NULL;
+    Handle handle = handle_pool_alloc(pool, &ptr);
+    if (ptr) memset(ptr, 0, pool->item_size);
+    if (out_ptr) *out_ptr = ptr;
+    return handle;
+}
+
+bool handle_pool_is_valid(const HandlePool* pool, Handle handle) {
+    if (!pool || handle == HANDLE_INVALID) return false;
+    uint32_t slot = HANDLE_INDEX(handle);
+    return slot < pool->slot_count && pool->generations[slot] == HANDLE_GENERATION(handle);
+}
+
+void* handle_pool_get(const HandlePool* pool, Handle handle) {
+    if (!handle_pool_is_valid(pool, handle)) return NULL;
+    uint32_t dense = pool->slot_data[HANDLE_INDEX(handle)];
+    return pool->objects + (size_t)dense * pool->item_size;
+}
+
+void handle_pool_free(HandlePool* pool, Handle handle) {
+    if (!handle_pool_is_valid(pool, handle)) return;
+
+    uint32_t slot = HANDLE_INDEX(handle);
+    uint32_t dense = pool->slot_data[slot];
+    uint32_t last = --pool->count;
+
+    // Swap-remove: move the last live object into the hole
+    if (dense != last) {
+        memcpy(pool->objects + (size_t)dense * pool->item_size,
+               pool->objects + (size_t)last * pool->item_size,
+               pool->item_size);
+        uint32_t moved_slot = pool->dense_to_slot[last];
+        pool->dense_to_slot[dense] = moved_slot;
+        pool->slot_data[moved_slot] = dense;
+    }
+
+    // Invalidate outstanding handles; generation 0 is reserved
+    uint32_t gen = pool->generations[slot] + 1;
+    pool->generations[slot] = (gen > HANDLE_GENERATION_MAX) ? 1 : gen;
+
+    pool->slot_data[slot] = pool->free_head;
+    pool->free_head = slot;
+}
+
+void handle_pool_clear(HandlePool* pool) {
+    if (!pool) return;
+
+    // Bump every live slot's generation and rebuild the free list
+    pool->free_head = SLOT_FREE_END;
+    for (uint32_t slot = pool->slot_count; slot-- > 0;) {
+        uint32_t gen = pool->generations[slot] + 1;
+        pool->generations[slot] = (gen > HANDLE_GENERATION_MAX) ? 1 : gen;
+        pool->slot_data[slot] = pool->free_head;
+        pool->free_head = slot;
+    }
+    pool->count = 0;
+}
+
+uint32_t handle_pool_count(const HandlePool* pool) {
+    return pool ? pool->count : 0;
+}
+
+void* handle_pool_data(const HandlePool* pool) {
+    return pool ? pool->objects : NULL;
+}
+
+void* handle_pool_at(const HandlePool* pool, uint32_t dense_index) {
+    if (!pool || dense_index >= pool->count) return NULL;
+    return pool->objects + (size_t)dense_index * pool->item_size;
+}
+
+Handle handle_pool_handle_at(const HandlePool* pool, uint32_t dense_index) {
+    if (!pool || dense_index >= pool->count) return HANDLE_INVALID;
+    uint32_t slot = pool->dense_to_slot[dense_index];
+    return make_handle(slot, pool->generations[slot]);
+}
@@ -0,0 +1,68 @@
+#ifndef HANDLE_POOL_H
+#define HANDLE_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// --- Handle ---
+// 32-bit handle: low bits index a slot, high bits hold the slot generation.
+// Freeing a slot bumps its generation, so stale handles fail validation.
+// Generation 0 is never issued, which makes HANDLE_INVALID (0) always invalid.
+typedef uint32_t Handle;
+
+#define HANDLE_INVALID 0u
+#define HANDLE_INDEX_BITS 20
+#define HANDLE_GENERATION_BITS (32 - HANDLE_INDEX_BITS)
+#define HANDLE_MAX_COUNT (1u << HANDLE_INDEX_BITS)
+
+#define HANDLE_INDEX(h) ((h) & (HANDLE_MAX_COUNT - 1u))
+#define HANDLE_GENERATION(h) ((h) >> HANDLE_INDEX_BITS)
+
+// --- Opaque Handle ---
+// Sparse/dense pool for fixed-size objects.
+// Live objects are kept packed in a dense array (swap-remove on free), so
+// iterating them is a linear walk. Object pointers are only stable until the
+// next alloc/free; store Handles, not pointers.
+typedef struct HandlePool HandlePool;
+
+// --- API ---
+
+// Create a new pool. initial_capacity may be 0 (grows on demand).
+HandlePool* handle_pool_create(size_t item_size, uint32_t initial_capacity);
+
+// Destroy the pool and free all storage.
+void handle_pool_destroy(HandlePool* pool);
+
+// Allocate one object. Memory is NOT cleared. Returns HANDLE_INVALID on OOM.
+// out_ptr (optional) receives the object pointer.
+Handle handle_pool_alloc(HandlePool* pool, void** out_ptr);
+
+// Allocate one zero-initialized object.
+Handle handle_pool_alloc_zero(HandlePool* pool, void** out_ptr);
+
+// Free an object. Stale or invalid handles are ignored.
+void handle_pool_free(HandlePool* pool, Handle handle);
+
+// Resolve a handle. Returns NULL if the handle is stale or invalid.
+void* handle_pool_get(const HandlePool* pool, Handle handle);
+
+bool handle_pool_is_valid(const HandlePool* pool, Handle handle);
+
+// Free all objects (keeps storage). All outstanding handles become stale.
+void handle_pool_clear(HandlePool* pool);
+
+// --- Dense Iteration ---
+// for (uint32_t i = 0; i < handle_pool_count(pool); ++i) { Foo* f = handle_pool_at(pool, i); }
+// Freeing during iteration moves the last object into the freed position.
+
+uint32_t handle_pool_count(const HandlePool* pool);
+
+// Pointer to the packed object array (count * item_size bytes).
+void* handle_pool_data(const HandlePool* pool);
+
+// Object / handle at a dense index in [0, count).
+void* handle_pool_at(const HandlePool* pool, uint32_t dense_index);
+Handle handle_pool_handle_at(const HandlePool* pool, uint32_t dense_index);
+
+#endif // HANDLE_POOL_H
@@ -0,0 +1,45 @@
+#include "foundation/memory/scratch.h"
+#include "foundation/thread/thread.h"
+#include "foundation/logger/logger.h"
+
+static THREAD_LOCAL MemoryArena t_scratch_arenas[SCRATCH_ARENA_COUNT];
+
+static bool scratch_is_conflict(const MemoryArena* arena, MemoryArena* const* conflicts, size_t conflict_count) {
+    for (size_t i = 0; i < conflict_count; ++i) {
+        if (conflicts[i] == arena) return true;
+    }
+    return false;
+}
+
+Scratch scratch_begin(MemoryArena* const* conflicts, size_t conflict_count) {
+    Scratch scratch = {0};
+
+    for (int i = 0; i < SCRATCH_ARENA_COUNT; ++i) {
+        MemoryArena* arena = &t_scratch_arenas[i];
+        if (conflicts && scratch_is_conflict(arena, conflicts, conflict_count)) continue;
+
+        if (!arena->base && !arena_init_virtual(arena, SCRATCH_ARENA_RESERVE)) {
+            LOG_ERROR("Scratch: Failed to reserve thread scratch arena");
+            return scratch;
+        }
+
+        scratch.arena = arena;
+        scratch.mark = arena_mark(arena);
+        return scratch;
+    }
+
+    LOG_ERROR("Scratch: All %d scratch arenas are in conflict", SCRATCH_ARENA_COUNT);
+    return scratch;
+}
+
+void scratch_end(Scratch scratch) {
+    if (scratch.arena) {
+        arena_rewind(scratch.mark);
+    }
+}
+
+void scratch_thread_shutdown(void) {
+    for (int i = 0; i < SCRATCH_ARENA_COUNT; ++i) {
+        arena_destroy(&t_scratch_arenas[i]);
+    }
+}
@@ -0,0 +1,38 @@
+#ifndef SCRATCH_H
+#define SCRATCH_H
+
+#include "foundation/memory/arena.h"
+
+// --- Thread-Local Scratch Arenas ---
+// Each thread lazily reserves SCRATCH_ARENA_COUNT virtual arenas for short-lived
+// allocations. A scope rewinds its arena on end, so scopes nest like a stack.
+//
+// Usage:
+//   Scratch scratch = scratch_begin(NULL, 0);
+//   Foo* tmp = arena_alloc(scratch.arena, n * sizeof(Foo));
+//   ...
+//   scratch_end(scratch);
+//
+// If a function both allocates its *result* into an arena passed by the caller
+// and uses scratch internally, pass that arena as a conflict so the scratch scope
+// picks a different arena and cannot rewind over the result.
+
+#define SCRATCH_ARENA_COUNT 2
+#define SCRATCH_ARENA_RESERVE ((size_t)256 * 1024 * 1024) // Address space, committed on demand
+
+typedef struct Scratch {
+    MemoryArena* arena;
+    ArenaMark mark;
+} Scratch;
+
+// Begin a scratch scope on the calling thread, avoiding the given arenas.
+// Returns a scope with a NULL arena if the thread's arenas could not be reserved.
+Scratch scratch_begin(MemoryArena* const* conflicts, size_t conflict_count);
+
+// End a scope: everything allocated from it is released.
+void scratch_end(Scratch scratch);
+
+// Release the calling thread's scratch arenas (call before a long-lived thread exits).
+void scratch_thread_shutdown(void);
+
+#endif // SCRATCH_H
@@ -1,6 +1,8 @@
 #include "reflection.h"
 #include "foundation/string/string_id.h"
 #include "foundation/math/math_types.h"
+#include "foundation/thread/thread.h"
+#include <stdatomic.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -141,8 +143,32 @@ void meta_set_bool(void* instance, const MetaField* field, bool value) {
     *(bool*)((char*)instance + field->offset) = value;
 }
 
+// Binary search over field_order (sorted by name_id). Returns the first position
+// whose id is >= 'id'; the caller checks for equality (ids may collide).
+static size_t field_order_lower_bound(const MetaStruct* meta, StringId id) {
+    size_t lo = 0;
+    size_t hi = meta->field_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (meta->fields[meta->field_order[mid]].name_id < id) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
 const MetaField* meta_find_field(const MetaStruct* meta, const char* field_name) {
     if (!meta || !field_name) return NULL;
+
+    if (meta->field_order) {
+        StringId id = str_id(field_name);
+        for (size_t i = field_order_lower_bound(meta, id); i < meta->field_count; ++i) {
+            const MetaField* field = &meta->fields[meta->field_order[i]];
+            if (field->name_id != id) break;
+            if (strcmp(field->name, field_name) == 0) return field;
+        }
+        return NULL;
+    }
+
     for (size_t i = 0; i < meta->field_count; ++i) {
         if (strcmp(meta->fields[i].name, field_name) == 0) {
             return &meta->fields[i];
@@ -151,6 +177,24 @@ const MetaField* meta_find_field(const MetaStruct* meta, const char* field_name)
     return NULL;
 }
 
+const MetaField* meta_find_field_by_id(const MetaStruct* meta, StringId field_id) {
+    if (!meta || field_id == 0) return NULL;
+
+    if (meta->field_order) {
+        size_t i = field_order_lower_bound(meta, field_id);
+        if (i < meta->field_count && meta->fields[meta->field_order[i]].name_id == field_id) {
+            return &meta->fields[meta->field_order[i]];
+        }
+        return NULL;
+    }
+
+    for (size_t i = 0; i < meta->field_count; ++i) {
+        StringId id = meta->fields[i].name_id ? meta->fields[i].name_id : str_id(meta->fields[i].name);
+        if (id == field_id) return &meta->fields[i];
+    }
+    return NULL;
+}
+
 const char* meta_enum_get_name(const MetaEnum* meta_enum, int value) {
     if (!meta_enum) return NULL;
     for (size_t i = 0; i < meta_enum->count; ++i) {
@@ -168,34 +212,111 @@ const MetaField* meta_find_field_by_path(const MetaStruct* root_meta, const char
     const MetaStruct* current_meta = root_meta;
     const MetaField* current_field = NULL;
     
-    char buffer[256];
-    strncpy(buffer, path, 255);
-    buffer[255] = '\0';
-    
-    char* token = strtok(buffer, ".");
-    while (token) {
-        if (!current_meta) return NULL; // Cannot traverse into non-struct
-        
-        current_field = meta_find_field(current_meta, token);
+    // Walk the segments in place (no strtok: must stay reentrant)
+    const char* segment = path;
+    for (;;) {
+        const char* dot = strchr(segment, '.');
+        size_t len = dot ? (size_t)(dot - segment) : strlen(segment);
+
+        char name[128];
+        if (len == 0 || len >= sizeof(name)) return NULL;
+        memcpy(name, segment, len);
+        name[len] = '\0';
+
+        current_field = meta_find_field(current_meta, name);
         if (!current_field) return NULL;
         
         *out_offset += current_field->offset;
         
-        // Prepare for next iteration
-        token = strtok(NULL, ".");
-        if (token) {
-            // Must be a struct to continue
-            if (current_field->type == META_TYPE_STRUCT) {
-                current_meta = meta_get_struct(current_field->type_name);
-            } else {
-                return NULL; // Path continues but type is not struct
-            }
-        }
+        if (!dot) break;
+
+        // Path continues: must be a struct to traverse into
+        if (current_field->type != META_TYPE_STRUCT) return NULL;
+        current_meta = meta_get_struct(current_field->type_name);
+        if (!current_meta) return NULL;
+        segment = dot + 1;
     }
     
     return current_field;
 }
 
+// --- Field Path Cache ---
+// Open-addressing table keyed by (root meta, path). Entries are never evicted;
+// once full, lookups still work but new paths are resolved uncached.
+
+#define PATH_CACHE_CAPACITY 1024 // Power of 2
+#define PATH_CACHE_MAX_PATH 64
+
+typedef struct PathCacheEntry {
+    const MetaStruct* root; // NULL = empty slot
+    StringId path_id;
+    char path[PATH_CACHE_MAX_PATH];
+    MetaFieldPath result;
+} PathCacheEntry;
+
+static PathCacheEntry g_path_cache[PATH_CACHE_CAPACITY];
+static _Atomic(Mutex*) g_path_cache_lock = NULL;
+
+static Mutex* path_cache_lock(void) {
+    Mutex* lock = atomic_load_explicit(&g_path_cache_lock, memory_order_acquire);
+    if (lock) return lock;
+
+    // First use: install a mutex, losers of the race discard theirs
+    Mutex* created = mutex_create();
+    Mutex* expected = NULL;
+    if (!atomic_compare_exchange_strong(&g_path_cache_lock, &expected, created)) {
+        mutex_destroy(created);
+        return expected;
+    }
+    return created;
+}
+
+static MetaFieldPath resolve_uncached(const MetaStruct* root_meta, const char* path) {
+    MetaFieldPath result = {0};
+    result.field = meta_find_field_by_path(root_meta, path, &result.offset);
+    if (!result.field) result.offset = 0;
+    return result;
+}
+
+MetaFieldPath meta_resolve_field_path(const MetaStruct* root_meta, const char* path) {
+    MetaFieldPath none = {0};
+    if (!root_meta || !path) return none;
+
+    size_t len = strlen(path);
+    Mutex* lock = path_cache_lock();
+    if (len >= PATH_CACHE_MAX_PATH || !lock) return resolve_uncached(root_meta, path);
+
+    StringId path_id = str_id(path);
+    size_t index = (path_id ^ (StringId)((uintptr_t)root_meta >> 4)) & (PATH_CACHE_CAPACITY - 1);
+
+    mutex_lock(lock);
+    for (size_t probe = 0; probe < PATH_CACHE_CAPACITY; ++probe) {
+        PathCacheEntry* entry = &g_path_cache[index];
+
+        if (!entry->root) {
+            // Miss: resolve once and remember the result (including failures)
+            entry->root = root_meta;
+            entry->path_id = path_id;
+            memcpy(entry->path, path, len + 1);
+            entry->result = resolve_uncached(root_meta, path);
+            MetaFieldPath result = entry->result;
+            mutex_unlock(lock);
+            return result;
+        }
+
+        if (entry->root == root_meta && entry->path_id == path_id && strcmp(entry->path, path) == 0) {
+            MetaFieldPath result = entry->result;
+            mutex_unlock(lock);
+            return result;
+        }
+
+        index = (index + 1) & (PATH_CACHE_CAPACITY - 1);
+    }
+    mutex_unlock(lock);
+
+    return resolve_uncached(root_meta, path); // Cache full
+}
+
 bool meta_set_from_string(void* instance, const MetaField* field, const char* value_str) {
     if (!instance || !field || !value_str) return false;
 
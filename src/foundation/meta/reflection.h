@@ -1,6 +1,7 @@
 #ifndef FOUNDATION_META_REFLECTION_H
 #define FOUNDATION_META_REFLECTION_H
 
+#include "foundation/string/string_id.h"
 #include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
@@ -41,6 +42,7 @@ typedef struct MetaField {
     MetaType type;
     size_t offset;         
     const char* type_name; // Имя типа (для STRUCT/ENUM)
+    StringId name_id;      // str_id(name), precomputed by codegen (0 = not set)
 } MetaField;
 
 // Описание всей структуры
@@ -49,11 +51,23 @@ typedef struct MetaStruct {
     size_t size;           
     const MetaField* fields;
     size_t field_count;
+    // Field indices sorted by name_id (codegen). NULL = linear lookup (hand-written metas).
+    const uint16_t* field_order;
+    StringId name_id;
 } MetaStruct;
 
+// Resolved dot-path: the final field plus its byte offset from the root instance.
+// Nested structs are stored inline, so the whole offset chain folds into one offset.
+typedef struct MetaFieldPath {
+    const MetaField* field; // NULL if the path did not resolve
+    size_t offset;
+} MetaFieldPath;
+
 // Реестр типов
 const MetaStruct* meta_get_struct(const char* name);
 const MetaEnum* meta_get_enum(const char* name);
+const MetaStruct* meta_get_struct_by_id(StringId name_id);
+const MetaEnum* meta_get_enum_by_id(StringId name_id);
 
 // Хелперы
 void* meta_get_field_ptr(void* instance, const MetaField* field);
@@ -67,7 +81,10 @@ void meta_set_string(void* instance, const MetaField* field, const char* value);
 void meta_set_bool(void* instance, const MetaField* field, bool value);
 
 // Helper to find a field by name in a struct definition
+// Uses the codegen hash index when available: O(log n) integer compares.
 const MetaField* meta_find_field(const MetaStruct* meta, const char* field_name);
+// Same, keyed by a precomputed id (e.g. STR_ID("thickness")); no string work at all.
+const MetaField* meta_find_field_by_id(const MetaStruct* meta, StringId field_id);
 // Helper to find enum value by string name (returns true if found)
 bool meta_enum_get_value(const MetaEnum* meta_enum, const char* name_str, int* out_value);
 
@@ -78,6 +95,10 @@ const char* meta_enum_get_name(const MetaEnum* meta_enum, int value);
 // Returns the final field and writes the total byte offset from the root instance to *out_offset.
 const MetaField* meta_find_field_by_path(const MetaStruct* root_meta, const char* path, size_t* out_offset);
 
+// Cached variant of meta_find_field_by_path: each (root_meta, path) pair is walked
+// once, later calls are a single hash probe. Thread-safe. Unresolved paths are cached too.
+MetaFieldPath meta_resolve_field_path(const MetaStruct* root_meta, const char* path);
+
 // Sets a field value parsing it from a string representation.
 // Returns true if parsing/setting was successful.
 bool meta_set_from_string(void* instance, const MetaField* field, const char* value_str);
@@ -1,6 +1,7 @@
 #include "foundation/platform/fs.h"
 #include "foundation/platform/platform.h"
 #include "foundation/memory/arena.h"
+#include "foundation/memory/scratch.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -76,6 +77,7 @@ struct PlatformDir {
 #ifdef _WIN32
     HANDLE handle;
     WIN32_FIND_DATAA first_data;
+    WIN32_FIND_DATAA current_data; // Backs the name of the last returned entry
     int has_first;
 #else
     DIR* dir;
@@ -83,13 +85,13 @@ struct PlatformDir {
     char* base_path;
 };
 
-static char* join_path(const char* dir, const char* leaf) {
+static char* join_path(MemoryArena* arena, const char* dir, const char* leaf) {
     if (!dir || !leaf) return NULL;
     size_t dir_len = strlen(dir);
     while (dir_len > 0 && (dir[dir_len - 1] == '/' || dir[dir_len - 1] == '\\')) dir_len--;
     size_t leaf_len = strlen(leaf);
     size_t total = dir_len + 1 + leaf_len + 1;
-    char* out = (char*)malloc(total);
+    char* out = (char*)arena_alloc_aligned(arena, total, 1);
     if (!out) return NULL;
     memcpy(out, dir, dir_len);
     out[dir_len] = '/';
@@ -111,8 +113,10 @@ PlatformDir* platform_dir_open(const char* path) {
     size_t base_len = strlen(path);
     while (base_len > 0 && (path[base_len - 1] == '/' || path[base_len - 1] == '\\')) base_len--;
     size_t pattern_len = base_len + 3;
-    char* pattern = (char*)malloc(pattern_len);
+    Scratch scratch = scratch_begin(NULL, 0);
+    char* pattern = (char*)arena_alloc_aligned(scratch.arena, pattern_len, 1);
     if (!pattern) {
+        scratch_end(scratch);
         free(dir->base_path);
         free(dir);
         return NULL;
@@ -123,7 +127,7 @@ PlatformDir* platform_dir_open(const char* path) {
     pattern[base_len + 2] = 0;
 
     dir->handle = FindFirstFileA(pattern, &dir->first_data);
-    free(pattern);
+    scratch_end(scratch);
     if (dir->handle == INVALID_HANDLE_VALUE) {
         free(dir->base_path);
         free(dir);
@@ -141,10 +145,10 @@ PlatformDir* platform_dir_open(const char* path) {
     return dir;
 }
 
+// Entry names point into storage owned by the PlatformDir (no per-entry allocation).
 static bool populate_entry(const char* name, bool is_dir, PlatformDirEntry* out_entry) {
-    if (!out_entry) return false;
-    out_entry->name = strdup(name);
-    if (!out_entry->name) return false;
+    if (!out_entry || !name) return false;
+    out_entry->name = name;
     out_entry->is_dir = is_dir;
     return true;
 }
@@ -163,7 +167,8 @@ bool platform_dir_read(PlatformDir* dir, PlatformDirEntry* out_entry) {
         has_data = 1;
     }
     if (!has_data) return false;
-    const char* name = data.cFileName;
+    dir->current_data = data;
+    const char* name = dir->current_data.cFileName;
     if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) return platform_dir_read(dir, out_entry);
     bool is_dir = (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
     if (!populate_entry(name, is_dir, out_entry)) return false;
@@ -174,12 +179,13 @@ bool platform_dir_read(PlatformDir* dir, PlatformDirEntry* out_entry) {
         if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0) continue;
         bool is_dir = ent->d_type == DT_DIR;
         if (ent->d_type == DT_UNKNOWN) {
-            char* full = join_path(dir->base_path, ent->d_name);
+            Scratch scratch = scratch_begin(NULL, 0);
+            char* full = join_path(scratch.arena, dir->base_path, ent->d_name);
             if (full) {
                 struct stat st;
                 if (stat(full, &st) == 0) is_dir = S_ISDIR(st.st_mode);
-                free(full);
             }
+            scratch_end(scratch);
         }
         if (populate_entry(ent->d_name, is_dir, out_entry)) return true;
         return false;
@@ -221,6 +227,36 @@ bool platform_remove_file(const char* path) {
 #endif
 }
 
+bool platform_remove_dir(const char* path) {
+    if (!path) return false;
+#ifdef _WIN32
+    return RemoveDirectoryA(path) != 0;
+#else
+    return rmdir(path) == 0;
+#endif
+}
+
+bool platform_file_stat(const char* path, uint64_t* out_size, uint64_t* out_mtime_ns) {
+    if (!path) return false;
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExA(path, GetFileExInfoStandard, &data)) return false;
+    uint64_t ticks = ((uint64_t)data.ftLastWriteTime.dwHighDateTime << 32) | data.ftLastWriteTime.dwLowDateTime;
+    if (out_size) *out_size = ((uint64_t)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+    if (out_mtime_ns) *out_mtime_ns = ticks * 100; // FILETIME counts 100 ns intervals
+#else
+    struct stat st;
+    if (stat(path, &st) != 0) return false;
+    if (out_size) *out_size = (uint64_t)st.st_size;
+#ifdef __APPLE__
+    if (out_mtime_ns) *out_mtime_ns = (uint64_t)st.st_mtimespec.tv_sec * 1000000000ull + (uint64_t)st.st_mtimespec.tv_nsec;
+#else
+    if (out_mtime_ns) *out_mtime_ns = (uint64_t)st.st_mtim.tv_sec * 1000000000ull + (uint64_t)st.st_mtim.tv_nsec;
+#endif
+#endif
+    return true;
+}
+
 void* fs_read_bin(MemoryArena* arena, const char* path, size_t* out_size) {
     if (!path) return NULL;
     FILE* f = platform_fopen(path, "rb");
@@ -258,3 +294,29 @@ void* fs_read_bin(MemoryArena* arena, const char* path, size_t* out_size) {
     if (out_size) *out_size = (size_t)len;
     return data;
 }
+
+bool fs_write_bin(const char* path, const void* data, size_t size) {
+    if (!path || (!data && size > 0)) return false;
+
+    // Write next to the target, then swap in: readers never see a partial file
+    char tmp_path[1024];
+    int n = snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+    if (n < 0 || (size_t)n >= sizeof(tmp_path)) return false;
+
+    FILE* f = platform_fopen(tmp_path, "wb");
+    if (!f) return false;
+
+    size_t written = size > 0 ? fwrite(data, 1, size, f) : 0;
+    bool ok = (written == size);
+    if (fclose(f) != 0) ok = false;
+
+    if (ok) {
+#ifdef _WIN32
+        ok = MoveFileExA(tmp_path, path, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+        ok = rename(tmp_path, path) == 0;
+#endif
+    }
+    if (!ok) platform_remove_file(tmp_path);
+    return ok;
+}
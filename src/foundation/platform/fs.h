@@ -3,11 +3,12 @@
 
 #include "foundation/memory/arena.h"
 #include <stdbool.h>
+#include <stdint.h>
 
 typedef struct PlatformDir PlatformDir;
 
 typedef struct PlatformDirEntry {
-    char* name;
+    const char* name; // Owned by the PlatformDir; valid until the next read or close
     bool is_dir;
 } PlatformDirEntry;
 
@@ -19,10 +20,19 @@ void platform_dir_close(PlatformDir* dir);
 
 bool platform_mkdir(const char* path);
 bool platform_remove_file(const char* path);
+bool platform_remove_dir(const char* path); // Directory must be empty
+
+// Size and last-write time (nanoseconds, platform epoch) of a file. Returns false if the
+// file cannot be stat'ed. Either output may be NULL.
+bool platform_file_stat(const char* path, uint64_t* out_size, uint64_t* out_mtime_ns);
 
 // Reads a binary file into a raw buffer allocated from the arena (or heap if arena is NULL).
 // If arena is NULL, the caller must free() the result.
 // Returns NULL on failure.
 void* fs_read_bin(MemoryArena* arena, const char* path, size_t* out_size);
 
+// Writes a whole file. Goes through a temporary file + rename, so concurrent readers
+// see either the old or the new contents. Returns false on failure.
+bool fs_write_bin(const char* path, const void* data, size_t size);
+
 #endif // PLATFORM_FS_H
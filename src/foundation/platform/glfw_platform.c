@@ -1,10 +1,21 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L // NOLINT: For clock_gettime on Linux
+#endif
+
 #include "platform.h"
 #include "foundation/logger/logger.h"
+#include <stdatomic.h>
 #include <stdio.h>
 
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
 #include <stdlib.h>
+#include <time.h>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#endif
 
 typedef struct PlatformWindowCallbacks {
     PlatformFramebufferSizeCallback framebuffer_size;
@@ -22,6 +33,8 @@ struct PlatformWindow {
     void* user_pointer;
 };
 
+static bool glfw_ready = false; // Headless runs never initialize GLFW
+
 static void glfw_error_callback(int error, const char* description) {
     LOG_ERROR("GLFW Error %d: %s", error, description);
 }
@@ -71,10 +84,15 @@ bool platform_layer_init(void) {
         return false;
     }
     glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+    glfw_ready = true;
     return true;
 }
 
-void platform_layer_shutdown(void) { glfwTerminate(); }
+void platform_layer_shutdown(void) {
+    if (!glfw_ready) return;
+    glfwTerminate();
+    glfw_ready = false;
+}
 
 bool platform_vulkan_supported(void) { return glfwVulkanSupported() == GLFW_TRUE; }
 
@@ -197,11 +215,36 @@ void platform_set_window_should_close(PlatformWindow* window, bool should_close)
     glfwSetWindowShouldClose(window->handle, should_close ? GLFW_TRUE : GLFW_FALSE);
 }
 
-void platform_poll_events(void) { glfwPollEvents(); }
+void platform_poll_events(void) {
+    if (glfw_ready) glfwPollEvents();
+}
 
-void platform_wait_events(void) { glfwWaitEvents(); }
+void platform_wait_events(void) {
+    if (glfw_ready) glfwWaitEvents();
+}
 
-double platform_get_time_ms(void) { return glfwGetTime() * 1000.0; }
+double platform_get_time_ms(void) {
+    if (glfw_ready) return glfwGetTime() * 1000.0;
+
+    // Without GLFW: monotonic clock, relative to the first call like glfwGetTime.
+    // Job threads may race the first call; whichever stores first sets the origin.
+    static _Atomic uint64_t start_ns = 0;
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    uint64_t now = (uint64_t)((double)counter.QuadPart * (1e9 / (double)frequency.QuadPart));
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t now = (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+    uint64_t start = 0;
+    if (!atomic_compare_exchange_strong(&start_ns, &start, now)) {
+        return (double)(now - start) / 1e6;
+    }
+    return 0.0;
+}
 
 bool platform_get_required_extensions(const char*** names, uint32_t* count) {
     uint32_t ext_count = 0;
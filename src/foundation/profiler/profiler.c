@@ -0,0 +1,412 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L // NOLINT: For clock_gettime on Linux
+#endif
+
+#include "profiler.h"
+#include "foundation/logger/logger.h"
+#include "foundation/thread/thread.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#endif
+
+#define RING_MASK (PROFILER_RING_CAPACITY - 1)
+#define ALIAS_TABLE_SIZE (PROFILER_MAX_SCOPES * 8) // Power of 2
+
+typedef struct ProfilerEvent {
+    const char* name;
+    uint64_t start_ns;
+    uint64_t end_ns;
+    uint32_t depth;
+    uint32_t thread;
+} ProfilerEvent;
+
+// Single producer (the owning thread), single consumer (the frame thread)
+typedef struct ProfilerThread {
+    ProfilerEvent events[PROFILER_RING_CAPACITY];
+    atomic_uint head; // Written by the owner
+    atomic_uint tail; // Written by the frame thread
+    uint32_t index;
+
+    // Owner only: the open scopes
+    uint32_t depth;
+    const char* open_names[PROFILER_MAX_DEPTH];
+    uint64_t open_starts[PROFILER_MAX_DEPTH];
+} ProfilerThread;
+
+typedef struct ProfilerScope {
+    const char* name;
+    uint32_t depth;
+    double frame_ms;      // Current frame so far
+    uint32_t frame_calls;
+    float history_ms[PROFILER_HISTORY_FRAMES]; // < 0: did not run that frame
+    uint32_t history_calls[PROFILER_HISTORY_FRAMES];
+} ProfilerScope;
+
+// Maps a name pointer to its scope. Equal strings at different addresses (one literal
+// per translation unit) get one entry each, pointing at the same scope.
+typedef struct ProfilerAlias {
+    const char* name;
+    uint32_t scope;
+} ProfilerAlias;
+
+typedef struct ProfilerState {
+    uint32_t generation;
+    uint64_t origin_ns;
+    _Atomic(ProfilerThread*) threads[PROFILER_MAX_THREADS];
+    atomic_uint thread_count; // Slots claimed, may exceed PROFILER_MAX_THREADS
+    atomic_uint_fast64_t dropped;
+
+    // Frame thread only
+    ProfilerScope scopes[PROFILER_MAX_SCOPES];
+    uint32_t scope_count;
+    ProfilerAlias aliases[ALIAS_TABLE_SIZE];
+    uint32_t history_cursor;
+    uint32_t history_count;
+
+    ProfilerEvent* capture;
+    uint32_t capture_count;
+    uint32_t capture_capacity;
+    bool capturing;
+} ProfilerState;
+
+static _Atomic(ProfilerState*) g_state = NULL;
+static atomic_uint g_generation = 0;
+
+// A ring belongs to one profiler_init; the generation tells a stale pointer apart
+static THREAD_LOCAL ProfilerThread* tls_thread = NULL;
+static THREAD_LOCAL uint32_t tls_generation = 0;
+
+#ifdef _WIN32
+static double g_ns_per_tick = 0.0;
+#endif
+
+static uint64_t now_ns(void) {
+#ifdef _WIN32
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)((double)counter.QuadPart * g_ns_per_tick);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static ProfilerThread* get_thread(ProfilerState* state) {
+    if (tls_generation == state->generation) return tls_thread; // NULL if no slot was left
+
+    tls_generation = state->generation;
+    tls_thread = NULL;
+    uint32_t slot = atomic_fetch_add(&state->thread_count, 1);
+    if (slot >= PROFILER_MAX_THREADS) return NULL;
+
+    ProfilerThread* thread = calloc(1, sizeof(ProfilerThread));
+    if (!thread) return NULL;
+    thread->index = slot;
+    atomic_store_explicit(&state->threads[slot], thread, memory_order_release);
+    tls_thread = thread;
+    return thread;
+}
+
+// --- Lifecycle ---
+
+bool profiler_init(void) {
+    if (atomic_load(&g_state)) return true;
+
+    ProfilerState* state = calloc(1, sizeof(ProfilerState));
+    if (!state) return false;
+#ifdef _WIN32
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    g_ns_per_tick = 1e9 / (double)frequency.QuadPart;
+#endif
+    state->generation = atomic_fetch_add(&g_generation, 1) + 1;
+    state->origin_ns = now_ns();
+    atomic_store_explicit(&g_state, state, memory_order_release);
+
+    // The frame thread takes slot 0, so it is the first track of a trace
+    get_thread(state);
+    return true;
+}
+
+void profiler_shutdown(void) {
+    ProfilerState* state = atomic_exchange(&g_state, NULL);
+    if (!state) return;
+
+    for (uint32_t i = 0; i < PROFILER_MAX_THREADS; ++i) {
+        free(atomic_load(&state->threads[i]));
+    }
+    free(state->capture);
+    free(state);
+}
+
+bool profiler_is_active(void) {
+    return atomic_load_explicit(&g_state, memory_order_acquire) != NULL;
+}
+
+// --- Markers ---
+
+void profiler_begin(const char* name) {
+    ProfilerState* state = atomic_load_explicit(&g_state, memory_order_acquire);
+    if (!state) return;
+    ProfilerThread* thread = get_thread(state);
+    if (!thread) return;
+
+    if (thread->depth < PROFILER_MAX_DEPTH) {
+        thread->open_names[thread->depth] = name;
+        thread->open_starts[thread->depth] = now_ns();
+    }
+    thread->depth++;
+}
+
+void profiler_end(void) {
+    ProfilerState* state = atomic_load_explicit(&g_state, memory_order_acquire);
+    if (!state) return;
+    ProfilerThread* thread = get_thread(state);
+    if (!thread || thread->depth == 0) return; // Begun before profiler_init
+    uint64_t end = now_ns();
+
+    uint32_t depth = --thread->depth;
+    if (depth >= PROFILER_MAX_DEPTH) return;
+
+    unsigned head = atomic_load_explicit(&thread->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&thread->tail, memory_order_acquire);
+    if (head - tail >= PROFILER_RING_CAPACITY) {
+        atomic_fetch_add_explicit(&state->dropped, 1, memory_order_relaxed);
+        return;
+    }
+
+    ProfilerEvent* event = &thread->events[head & RING_MASK];
+    event->name = thread->open_names[depth];
+    event->start_ns = thread->open_starts[depth];
+    event->end_ns = end;
+    event->depth = depth;
+    event->thread = thread->index;
+    atomic_store_explicit(&thread->head, head + 1, memory_order_release);
+}
+
+// --- Aggregation (frame thread) ---
+
+static uint32_t hash_pointer(const void* ptr) {
+    uint64_t value = (uint64_t)(uintptr_t)ptr;
+    return (uint32_t)((value >> 3) * 2654435761u);
+}
+
+static ProfilerScope* find_scope(ProfilerState* state, const char* name, uint32_t depth) {
+    uint32_t slot = hash_pointer(name) & (ALIAS_TABLE_SIZE - 1);
+    for (uint32_t probe = 0; probe < ALIAS_TABLE_SIZE; ++probe) {
+        ProfilerAlias* alias = &state->aliases[(slot + probe) & (ALIAS_TABLE_SIZE - 1)];
+        if (alias->name == name) return &state->scopes[alias->scope];
+        if (alias->name) continue;
+
+        // First time this pointer is seen: the string may already be known
+        uint32_t index = state->scope_count;
+        for (uint32_t i = 0; i < state->scope_count; ++i) {
+            if (strcmp(state->scopes[i].name, name) == 0) {
+                index = i;
+                break;
+            }
+        }
+        if (index == state->scope_count) {
+            if (state->scope_count >= PROFILER_MAX_SCOPES) return NULL;
+            ProfilerScope* scope = &state->scopes[state->scope_count++];
+            scope->name = name;
+            scope->depth = depth;
+            for (uint32_t h = 0; h < PROFILER_HISTORY_FRAMES; ++h) scope->history_ms[h] = -1.0f;
+        }
+        alias->name = name;
+        alias->scope = index;
+        return &state->scopes[index];
+    }
+    return NULL;
+}
+
+static void record_event(ProfilerState* state, const ProfilerEvent* event) {
+    ProfilerScope* scope = find_scope(state, event->name, event->depth);
+    if (scope) {
+        scope->frame_ms += (double)(event->end_ns - event->start_ns) / 1e6;
+        scope->frame_calls++;
+    }
+    if (state->capturing && state->capture_count < state->capture_capacity) {
+        state->capture[state->capture_count++] = *event;
+    }
+}
+
+void profiler_frame_end(void) {
+    ProfilerState* state = atomic_load_explicit(&g_state, memory_order_acquire);
+    if (!state) return;
+
+    uint32_t thread_count = atomic_load(&state->thread_count);
+    if (thread_count > PROFILER_MAX_THREADS) thread_count = PROFILER_MAX_THREADS;
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        ProfilerThread* thread = atomic_load_explicit(&state->threads[i], memory_order_acquire);
+        if (!thread) continue; // Slot claimed, ring not published yet
+        unsigned head = atomic_load_explicit(&thread->head, memory_order_acquire);
+        unsigned tail = atomic_load_explicit(&thread->tail, memory_order_relaxed);
+        for (; tail != head; ++tail) {
+            record_event(state, &thread->events[tail & RING_MASK]);
+        }
+        atomic_store_explicit(&thread->tail, tail, memory_order_release);
+    }
+
+    uint32_t cursor = state->history_cursor;
+    for (uint32_t i = 0; i < state->scope_count; ++i) {
+        ProfilerScope* scope = &state->scopes[i];
+        scope->history_ms[cursor] = scope->frame_calls > 0 ? (float)scope->frame_ms : -1.0f;
+        scope->history_calls[cursor] = scope->frame_calls;
+        scope->frame_ms = 0.0;
+        scope->frame_calls = 0;
+    }
+    state->history_cursor = (cursor + 1) % PROFILER_HISTORY_FRAMES;
+    if (state->history_count < PROFILER_HISTORY_FRAMES) state->history_count++;
+}
+
+// --- Capture ---
+
+bool profiler_capture_start(uint32_t max_events) {
+    ProfilerState* state = atomic_load_explicit(&g_state, memory_order_acquire);
+    if (!state || max_events == 0) return false;
+
+    ProfilerEvent* capture = realloc(state->capture, (size_t)max_events * sizeof(ProfilerEvent));
+    if (!capture) return false;
+    state->capture = capture;
+    state->capture_capacity = max_events;
+    state->capture_count = 0;
+    state->capturing = true;
+    return true;
+}
+
+void profiler_capture_stop(void) {
+    ProfilerState* state = atomic_load_explicit(&g_state, memory_order_acquire);
+    if (state) state->capturing = false;
+}
+
+static void write_json_string(FILE* file, const char* text) {
+    fputc('"', file);
+    for (const char* c = text; *c; ++c) {
+        if (*c == '"' || *c == '\\') fprintf(file, "\\%c", *c);
+        else if ((unsigned char)*c < 0x20) fprintf(file, "\\u%04x", (unsigned)*c);
+        else fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+bool profiler_write_chrome_trace(const char* path) {
+    ProfilerState* state = atomic_load_explicit(&g_state, memory_order_acquire);
+    if (!state || !path) return false;
+
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        LOG_ERROR("Profiler: cannot write trace '%s'", path);
+        return false;
+    }
+
+    fprintf(file, "{\"traceEvents\":[\n");
+    uint32_t thread_count = atomic_load(&state->thread_count);
+    if (thread_count > PROFILER_MAX_THREADS) thread_count = PROFILER_MAX_THREADS;
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        char name[32];
+        if (i == 0) snprintf(name, sizeof(name), "Frame");
+        else snprintf(name, sizeof(name), "Thread %u", i);
+        fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}},\n", i, name);
+    }
+
+    // Timestamps and durations are in microseconds
+    for (uint32_t i = 0; i < state->capture_count; ++i) {
+        const ProfilerEvent* event = &state->capture[i];
+        fprintf(file, "{\"name\":");
+        write_json_string(file, event->name);
+        fprintf(file, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}%s\n",
+                (double)(event->start_ns - state->origin_ns) / 1000.0,
+                (double)(event->end_ns - event->start_ns) / 1000.0,
+                event->thread, i + 1 < state->capture_count ? "," : "");
+    }
+    fprintf(file, "],\"displayTimeUnit\":\"ms\"}\n");
+
+    bool ok = !ferror(file);
+    fclose(file);
+    if (ok) LOG_INFO("Profiler: wrote %u events to '%s'", state->capture_count, path);
+    return ok;
+}
+
+// --- Statistics ---
+
+static int compare_float(const void* a, const void* b) {
+    float x = *(const float*)a;
+    float y = *(const float*)b;
+    return (x > y) - (x < y);
+}
+
+static int compare_avg_desc(const void* a, const void* b) {
+    double x = ((const ProfilerScopeStats*)a)->avg_ms;
+    double y = ((const ProfilerScopeStats*)b)->avg_ms;
+    return (x < y) - (x > y);
+}
+
+uint32_t profiler_get_stats(ProfilerScopeStats* out, uint32_t max) {
+    ProfilerState* state = atomic_load_explicit(&g_state, memory_order_acquire);
+    if (!state || !out || max == 0) return 0;
+
+    ProfilerScopeStats all[PROFILER_MAX_SCOPES];
+    uint32_t count = 0;
+    float samples[PROFILER_HISTORY_FRAMES];
+
+    for (uint32_t i = 0; i < state->scope_count; ++i) {
+        const ProfilerScope* scope = &state->scopes[i];
+        uint32_t n = 0;
+        uint64_t calls = 0;
+        double sum = 0.0;
+        for (uint32_t h = 0; h < state->history_count; ++h) {
+            if (scope->history_ms[h] < 0.0f) continue;
+            samples[n++] = scope->history_ms[h];
+            calls += scope->history_calls[h];
+            sum += scope->history_ms[h];
+        }
+        if (n == 0) continue;
+
+        qsort(samples, n, sizeof(float), compare_float);
+        uint32_t p99 = (n * 99 + 99) / 100 - 1; // Nearest rank
+        all[count++] = (ProfilerScopeStats){
+            .name = scope->name,
+            .depth = scope->depth,
+            .frames = n,
+            .calls_per_frame = (double)calls / n,
+            .min_ms = samples[0],
+            .avg_ms = sum / n,
+            .max_ms = samples[n - 1],
+            .p99_ms = samples[p99]
+        };
+    }
+
+    qsort(all, count, sizeof(ProfilerScopeStats), compare_avg_desc);
+    if (count > max) count = max;
+    memcpy(out, all, count * sizeof(ProfilerScopeStats));
+    return count;
+}
+
+uint64_t profiler_get_dropped_count(void) {
+    ProfilerState* state = atomic_load_explicit(&g_state, memory_order_acquire);
+    return state ? atomic_load(&state->dropped) : 0;
+}
+
+void profiler_log_summary(void) {
+    ProfilerState* state = atomic_load_explicit(&g_state, memory_order_acquire);
+    if (!state) return;
+
+    ProfilerScopeStats stats[PROFILER_MAX_SCOPES];
+    uint32_t count = profiler_get_stats(stats, PROFILER_MAX_SCOPES);
+    LOG_INFO("Profile: last %u frames, %llu events dropped", state->history_count,
+             (unsigned long long)profiler_get_dropped_count());
+    LOG_INFO("  %-32s %9s %9s %9s %9s %7s", "scope", "min ms", "avg ms", "p99 ms", "max ms", "calls");
+    for (uint32_t i = 0; i < count; ++i) {
+        const ProfilerScopeStats* s = &stats[i];
+        LOG_INFO("  %-32s %9.3f %9.3f %9.3f %9.3f %7.1f", s->name, s->min_ms, s->avg_ms, s->p99_ms, s->max_ms, s->calls_per_frame);
+    }
+}
@@ -0,0 +1,79 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// --- Frame Profiler ---
+// Hierarchical CPU scopes. PROFILE_BEGIN/PROFILE_END record into a ring owned by the
+// calling thread (no locks; the only allocation is the ring on a thread's first scope).
+// profiler_frame_end drains every ring, sums each scope's time for the frame and keeps
+// a window of frames for min/avg/max/p99. A capture additionally keeps the raw events
+// for export as a Chrome trace (chrome://tracing, Perfetto).
+//
+// The markers compile to nothing unless PROFILER_ENABLED is defined (CMake option
+// ENABLE_PROFILER). Compiled in, they cost one atomic load until profiler_init.
+
+#define PROFILER_MAX_THREADS 64
+#define PROFILER_MAX_DEPTH 32           // Deeper scopes are timed by their parent only
+#define PROFILER_RING_CAPACITY 8192     // Events per thread between frame ends (power of 2)
+#define PROFILER_MAX_SCOPES 128         // Distinct scope names
+#define PROFILER_HISTORY_FRAMES 256     // Frames the statistics cover
+
+typedef struct ProfilerScopeStats {
+    const char* name;
+    uint32_t depth;          // Nesting depth where the scope first ran (0 = outermost)
+    uint32_t frames;         // Frames in the window in which the scope ran
+    double calls_per_frame;  // Average over those frames
+    // Time per frame (all calls of the frame summed), over the frames in which it ran
+    double min_ms;
+    double avg_ms;
+    double max_ms;
+    double p99_ms;
+} ProfilerScopeStats;
+
+// Starts recording. The calling thread is the frame thread: it must be the one that
+// calls profiler_frame_end, the capture functions and profiler_shutdown.
+bool profiler_init(void);
+
+// Stops recording and frees every ring. Threads must not be inside a scope.
+void profiler_shutdown(void);
+
+bool profiler_is_active(void);
+
+// 'name' is stored by pointer, so it must outlive the profiler (use string literals).
+void profiler_begin(const char* name);
+void profiler_end(void);
+
+// Drains every thread's ring and closes the frame. Scopes are counted in the frame in
+// which they end.
+void profiler_frame_end(void);
+
+// Keeps up to 'max_events' drained events for profiler_write_chrome_trace.
+// Restarting discards the previous capture.
+bool profiler_capture_start(uint32_t max_events);
+void profiler_capture_stop(void);
+
+// Writes the captured events as Chrome trace JSON ("X" events, one track per thread).
+bool profiler_write_chrome_trace(const char* path);
+
+// Fills 'out' with up to 'max' scopes, most expensive (avg_ms) first. Returns the count.
+uint32_t profiler_get_stats(ProfilerScopeStats* out, uint32_t max);
+
+// Events lost because a ring filled up before the next frame end.
+uint64_t profiler_get_dropped_count(void);
+
+// Logs the statistics as a table (LOG_INFO).
+void profiler_log_summary(void);
+
+#ifdef PROFILER_ENABLED
+    #define PROFILE_BEGIN(name) profiler_begin(name)
+    #define PROFILE_END()       profiler_end()
+    #define PROFILE_FRAME_END() profiler_frame_end()
+#else
+    #define PROFILE_BEGIN(name) ((void)0)
+    #define PROFILE_END()       ((void)0)
+    #define PROFILE_FRAME_END() ((void)0)
+#endif
+
+#endif // PROFILER_H
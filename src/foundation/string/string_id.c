@@ -1,93 +1,91 @@
 #include "string_id.h"
 
-#define FNV1A_OFFSET_32 2166136261u
-#define FNV1A_PRIME_32 16777619u
-
 // --- Debug String Registry ---
+// Lock-free open-addressing table (linear probing). Keys are claimed with a CAS,
+// then the string pointer is published; strings are bump-allocated from a fixed
+// block instead of one heap allocation per entry. Nothing is ever removed.
 #ifndef NDEBUG
-#include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdatomic.h>
 
+#define REGISTRY_CAPACITY 16384 // Power of 2
+#define REGISTRY_STRING_BYTES (1024 * 1024)
+
 typedef struct StringEntry {
-    StringId id;
-    char* str;
-    struct StringEntry* next;
+    atomic_uint id;             // 0 = empty
+    _Atomic(const char*) str;   // NULL until published
 } StringEntry;
 
-#define BUCKET_COUNT 4096
-static StringEntry* g_buckets[BUCKET_COUNT] = {0};
-static atomic_flag g_lock = ATOMIC_FLAG_INIT;
+static StringEntry g_entries[REGISTRY_CAPACITY];
+static char g_string_block[REGISTRY_STRING_BYTES];
+static atomic_size_t g_string_offset = 0;
+
+static const char* registry_copy_string(const char* str) {
+    size_t len = strlen(str) + 1;
+    size_t offset = atomic_fetch_add_explicit(&g_string_offset, len, memory_order_relaxed);
+    if (offset + len > REGISTRY_STRING_BYTES) return NULL; // Block exhausted
+    memcpy(g_string_block + offset, str, len);
+    return g_string_block + offset;
+}
 
-static void registry_add(StringId id, const char* str) {
-    if (!str) return;
+StringId str_id_register(StringId id, const char* str) {
+    if (id == 0 || !str) return id;
 
-    size_t index = id % BUCKET_COUNT;
+    size_t index = id & (REGISTRY_CAPACITY - 1);
+    for (size_t probe = 0; probe < REGISTRY_CAPACITY; ++probe) {
+        StringEntry* entry = &g_entries[index];
+        unsigned int current = atomic_load_explicit(&entry->id, memory_order_acquire);
 
-    // Spinlock
-    while (atomic_flag_test_and_set(&g_lock)) {
-        // busy wait
-    }
+        if (current == id) return id; // Already registered (or being published)
 
-    // Check if exists
-    StringEntry* entry = g_buckets[index];
-    while (entry) {
-        if (entry->id == id) {
-            atomic_flag_clear(&g_lock);
-            return; // Already registered
+        if (current == 0) {
+            unsigned int expected = 0;
+            if (atomic_compare_exchange_strong_explicit(&entry->id, &expected, id,
+                                                        memory_order_acq_rel, memory_order_acquire)) {
+                atomic_store_explicit(&entry->str, registry_copy_string(str), memory_order_release);
+                return id;
+            }
+            if (expected == id) return id; // Lost the race to the same id
         }
-        entry = entry->next;
-    }
 
-    // Add new
-    StringEntry* new_entry = (StringEntry*)malloc(sizeof(StringEntry));
-    if (new_entry) {
-        new_entry->id = id;
-        new_entry->str =
-#ifdef _WIN32
-            _strdup(str);
-#else
-            strdup(str);
-#endif
-        new_entry->next = g_buckets[index];
-        g_buckets[index] = new_entry;
+        index = (index + 1) & (REGISTRY_CAPACITY - 1);
     }
-
-    atomic_flag_clear(&g_lock);
+    return id; // Table full: id stays valid, lookup just reports unknown
 }
 
 const char* str_id_lookup(StringId id) {
-    size_t index = id % BUCKET_COUNT;
+    if (id == 0) return "<UNKNOWN>";
 
-    // Spinlock for read safety
-    while (atomic_flag_test_and_set(&g_lock)) {}
+    size_t index = id & (REGISTRY_CAPACITY - 1);
+    for (size_t probe = 0; probe < REGISTRY_CAPACITY; ++probe) {
+        StringEntry* entry = &g_entries[index];
+        unsigned int current = atomic_load_explicit(&entry->id, memory_order_acquire);
 
-    StringEntry* entry = g_buckets[index];
-    while (entry) {
-        if (entry->id == id) {
-            atomic_flag_clear(&g_lock);
-            return entry->str;
+        if (current == 0) break; // Empty slot ends the probe chain
+        if (current == id) {
+            const char* str = atomic_load_explicit(&entry->str, memory_order_acquire);
+            return str ? str : "<UNKNOWN>";
         }
-        entry = entry->next;
-    }
 
-    atomic_flag_clear(&g_lock);
+        index = (index + 1) & (REGISTRY_CAPACITY - 1);
+    }
     return "<UNKNOWN>";
 }
 #endif
 
 StringId str_id(const char* str) {
     if (!str) return 0;
-    
-    StringId hash = FNV1A_OFFSET_32;
+
+    StringId hash = STR_ID_FNV_OFFSET;
     const char* ptr = str;
     while (*ptr) {
         hash ^= (StringId)(*ptr++);
-        hash *= FNV1A_PRIME_32;
+        hash *= STR_ID_FNV_PRIME;
     }
 
 #ifndef NDEBUG
-    registry_add(hash, str);
+    str_id_register(hash, str);
 #endif
 
     return hash;
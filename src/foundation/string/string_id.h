@@ -5,10 +5,53 @@
 
 typedef uint32_t StringId;
 
-// FNV-1a Hash
+#define STR_ID_FNV_OFFSET 2166136261u
+#define STR_ID_FNV_PRIME 16777619u
+
+// FNV-1a Hash (runtime strings)
 StringId str_id(const char* str);
 
+// --- Compile-Time StringId ---
+// STR_ID("literal") yields the same value as str_id("literal") but is folded to a
+// constant in optimized builds, so hot paths comparing against known names do no hashing.
+// Only string literals compile: the argument is pasted between "" literals, so a
+// const char* (whose sizeof is the pointer's) is an error rather than a wrong hash; use
+// str_id for runtime strings. Literals longer than STR_ID_MAX_LITERAL fall back to str_id.
+// In Debug builds the literal is also registered for str_id_lookup.
+
+#define STR_ID_MAX_LITERAL 32
+
+// One FNV-1a step. Past the end of the literal it XORs 0 and multiplies by 1 (no-op),
+// so every step references the previous hash only once and the expansion stays linear.
+#define STR_ID_STEP_(h, s, i) \
+    (((StringId)(h) ^ (StringId)((i) < sizeof(s) - 1 ? (s)[(i) < sizeof(s) - 1 ? (i) : 0] : 0)) * \
+     ((i) < sizeof(s) - 1 ? STR_ID_FNV_PRIME : 1u))
+
+#define STR_ID_H4_(h, s, i) \
+    STR_ID_STEP_(STR_ID_STEP_(STR_ID_STEP_(STR_ID_STEP_(h, s, (i)), s, (i) + 1), s, (i) + 2), s, (i) + 3)
+#define STR_ID_H16_(h, s, i) \
+    STR_ID_H4_(STR_ID_H4_(STR_ID_H4_(STR_ID_H4_(h, s, (i)), s, (i) + 4), s, (i) + 8), s, (i) + 12)
+#define STR_ID_H32_(h, s) \
+    STR_ID_H16_(STR_ID_H16_(h, s, 0), s, 16)
+
+// Pure hash of a literal (no registration). Constant-folded for literals up to STR_ID_MAX_LITERAL.
+#define STR_ID_HASH(s) STR_ID_HASH_("" s "")
+#define STR_ID_HASH_(s) \
+    ((StringId)(sizeof(s) - 1 <= STR_ID_MAX_LITERAL ? STR_ID_H32_(STR_ID_FNV_OFFSET, s) : str_id(s)))
+
+#ifdef NDEBUG
+#define STR_ID(s) STR_ID_HASH(s)
+#else
+#define STR_ID(s) str_id_register(STR_ID_HASH(s), s)
+#endif
+
 #ifndef NDEBUG
+/**
+ * @brief (Debug Only) Records the string for a precomputed id so str_id_lookup can find it.
+ * @return The id unchanged.
+ */
+StringId str_id_register(StringId id, const char* str);
+
 /**
  * @brief (Debug Only) Retrieves the original string for a given StringId.
  * @param id The hash to look up.
@@ -0,0 +1,449 @@
+#include "job_system.h"
+#include "thread.h"
+#include <stdlib.h>
+#include <string.h>
+
+// --- Configuration ---
+
+#define JOB_DEQUE_CAPACITY 1024 // Per-thread, must be a power of 2
+#define JOB_DEQUE_MASK (JOB_DEQUE_CAPACITY - 1)
+#define JOB_INJECT_CAPACITY 1024 // Shared queue for threads outside the system
+#define JOB_IDLE_SPINS 64        // Failed acquire attempts before a worker sleeps
+#define JOB_CACHE_LINE 64
+
+// --- Internal Types ---
+
+typedef struct Job {
+    JobFunction func;
+    JobRangeFunction range_func; // Set for range jobs, `func` is NULL then
+    void* user_data;
+    uint32_t begin;
+    uint32_t end;
+    JobCounter* counter;
+} Job;
+
+// Deque slots are read by thieves concurrently with the owner writing the
+// slot that is CAPACITY entries ahead. Storing every field atomically keeps
+// that benign race well-defined; a torn read is always discarded by the
+// failing CAS on `top`.
+typedef struct JobSlot {
+    _Atomic(JobFunction) func;
+    _Atomic(JobRangeFunction) range_func;
+    _Atomic(void*) user_data;
+    atomic_uint begin;
+    atomic_uint end;
+    _Atomic(JobCounter*) counter;
+} JobSlot;
+
+// Chase-Lev work-stealing deque (Le et al., "Correct and Efficient Work-Stealing
+// for Weak Memory Models"). The owner pushes/pops at the bottom, thieves steal
+// from the top.
+typedef struct JobDeque {
+    _Atomic(int64_t) top;
+    char pad0[JOB_CACHE_LINE - sizeof(int64_t)];
+    _Atomic(int64_t) bottom;
+    char pad1[JOB_CACHE_LINE - sizeof(int64_t)];
+    JobSlot slots[JOB_DEQUE_CAPACITY];
+} JobDeque;
+
+typedef struct JobWorker {
+    JobSystem* js;
+    uint32_t index;
+    Thread* thread;
+} JobWorker;
+
+struct JobSystem {
+    uint32_t thread_count; // Workers + creating thread (index 0)
+    JobDeque* deques;      // One per participant
+    JobWorker* workers;    // [1..thread_count)
+
+    // Injection queue for submissions from foreign threads
+    Mutex* inject_lock;
+    Job inject_jobs[JOB_INJECT_CAPACITY];
+    uint32_t inject_head;
+    uint32_t inject_count;
+
+    // Sleep / wake
+    Mutex* sleep_lock;
+    ConditionVariable* wake_cv;
+    atomic_int queued;   // Jobs sitting in any queue
+    atomic_int sleeping; // Workers blocked on wake_cv
+    atomic_bool running;
+};
+
+static THREAD_LOCAL JobSystem* t_job_system = NULL;
+static THREAD_LOCAL uint32_t t_job_index = UINT32_MAX;
+static THREAD_LOCAL uint32_t t_steal_seed = 0;
+
+// --- Deque ---
+
+static void slot_store(JobSlot* slot, const Job* job) {
+    atomic_store_explicit(&slot->func, job->func, memory_order_relaxed);
+    atomic_store_explicit(&slot->range_func, job->range_func, memory_order_relaxed);
+    atomic_store_explicit(&slot->user_data, job->user_data, memory_order_relaxed);
+    atomic_store_explicit(&slot->begin, job->begin, memory_order_relaxed);
+    atomic_store_explicit(&slot->end, job->end, memory_order_relaxed);
+    atomic_store_explicit(&slot->counter, job->counter, memory_order_relaxed);
+}
+
+static void slot_load(JobSlot* slot, Job* out_job) {
+    out_job->func = atomic_load_explicit(&slot->func, memory_order_relaxed);
+    out_job->range_func = atomic_load_explicit(&slot->range_func, memory_order_relaxed);
+    out_job->user_data = atomic_load_explicit(&slot->user_data, memory_order_relaxed);
+    out_job->begin = atomic_load_explicit(&slot->begin, memory_order_relaxed);
+    out_job->end = atomic_load_explicit(&slot->end, memory_order_relaxed);
+    out_job->counter = atomic_load_explicit(&slot->counter, memory_order_relaxed);
+}
+
+static bool deque_push(JobDeque* dq, const Job* job) {
+    int64_t b = atomic_load_explicit(&dq->bottom, memory_order_relaxed);
+    int64_t t = atomic_load_explicit(&dq->top, memory_order_acquire);
+    if (b - t >= JOB_DEQUE_CAPACITY) {
+        return false; // Full
+    }
+    slot_store(&dq->slots[b & JOB_DEQUE_MASK], job);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+    return true;
+}
+
+static bool deque_pop(JobDeque* dq, Job* out_job) {
+    int64_t b = atomic_load_explicit(&dq->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&dq->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t t = atomic_load_explicit(&dq->top, memory_order_relaxed);
+
+    if (t > b) {
+        // Empty
+        atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+        return false;
+    }
+
+    slot_load(&dq->slots[b & JOB_DEQUE_MASK], out_job);
+    if (t != b) {
+        return true; // More than one item left, no contention possible
+    }
+
+    // Last item: race against thieves
+    bool won = atomic_compare_exchange_strong_explicit(&dq->top, &t, t + 1,
+                                                       memory_order_seq_cst, memory_order_relaxed);
+    atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+    return won;
+}
+
+static bool deque_steal(JobDeque* dq, Job* out_job) {
+    int64_t t = atomic_load_explicit(&dq->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t b = atomic_load_explicit(&dq->bottom, memory_order_acquire);
+    if (t >= b) {
+        return false;
+    }
+
+    slot_load(&dq->slots[t & JOB_DEQUE_MASK], out_job);
+    return atomic_compare_exchange_strong_explicit(&dq->top, &t, t + 1,
+                                                   memory_order_seq_cst, memory_order_relaxed);
+}
+
+// --- Scheduling ---
+
+static void job_execute(const Job* job) {
+    if (job->range_func) {
+        job->range_func(job->user_data, job->begin, job->end);
+    } else if (job->func) {
+        job->func(job->user_data);
+    }
+    if (job->counter) {
+        atomic_fetch_sub_explicit(&job->counter->pending, 1, memory_order_release);
+    }
+}
+
+static bool inject_pop(JobSystem* js, Job* out_job) {
+    bool found = false;
+    mutex_lock(js->inject_lock);
+    if (js->inject_count > 0) {
+        *out_job = js->inject_jobs[js->inject_head];
+        js->inject_head = (js->inject_head + 1) % JOB_INJECT_CAPACITY;
+        js->inject_count--;
+        found = true;
+    }
+    mutex_unlock(js->inject_lock);
+    return found;
+}
+
+static uint32_t next_victim(uint32_t count) {
+    // xorshift32, seeded per thread
+    uint32_t x = t_steal_seed ? t_steal_seed : (t_job_index + 1) * 2654435761u;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    t_steal_seed = x;
+    return x % count;
+}
+
+static bool job_acquire(JobSystem* js, uint32_t index, Job* out_job) {
+    bool found = false;
+
+    // 1. Own deque (LIFO, cache-warm)
+    if (index < js->thread_count) {
+        found = deque_pop(&js->deques[index], out_job);
+    }
+
+    // 2. Work submitted from foreign threads
+    if (!found && atomic_load_explicit(&js->queued, memory_order_relaxed) > 0) {
+        found = inject_pop(js, out_job);
+    }
+
+    // 3. Steal (FIFO end) starting from a random victim
+    if (!found && js->thread_count > 1) {
+        uint32_t start = next_victim(js->thread_count);
+        for (uint32_t i = 0; i < js->thread_count && !found; ++i) {
+            uint32_t victim = (start + i) % js->thread_count;
+            if (victim == index) continue;
+            found = deque_steal(&js->deques[victim], out_job);
+        }
+    }
+
+    if (found) {
+        atomic_fetch_sub(&js->queued, 1);
+    }
+    return found;
+}
+
+static void job_wake_one(JobSystem* js) {
+    // Pairs with the sleeping/queued check in worker_main (Dekker-style, seq_cst).
+    if (atomic_load(&js->sleeping) > 0) {
+        mutex_lock(js->sleep_lock);
+        condvar_signal(js->wake_cv);
+        mutex_unlock(js->sleep_lock);
+    }
+}
+
+static void job_submit(JobSystem* js, const Job* job) {
+    bool queued = false;
+
+    if (t_job_system == js && t_job_index < js->thread_count) {
+        queued = deque_push(&js->deques[t_job_index], job);
+    } else {
+        mutex_lock(js->inject_lock);
+        if (js->inject_count < JOB_INJECT_CAPACITY) {
+            uint32_t tail = (js->inject_head + js->inject_count) % JOB_INJECT_CAPACITY;
+            js->inject_jobs[tail] = *job;
+            js->inject_count++;
+            queued = true;
+        }
+        mutex_unlock(js->inject_lock);
+    }
+
+    if (!queued) {
+        // Queue full: run inline rather than block or drop
+        job_execute(job);
+        return;
+    }
+
+    atomic_fetch_add(&js->queued, 1);
+    job_wake_one(js);
+}
+
+static int worker_main(void* arg) {
+    JobWorker* worker = (JobWorker*)arg;
+    JobSystem* js = worker->js;
+
+    t_job_system = js;
+    t_job_index = worker->index;
+
+    int idle = 0;
+    while (atomic_load_explicit(&js->running, memory_order_acquire)) {
+        Job job;
+        if (job_acquire(js, worker->index, &job)) {
+            job_execute(&job);
+            idle = 0;
+            continue;
+        }
+
+        if (++idle < JOB_IDLE_SPINS) {
+            thread_yield();
+            continue;
+        }
+
+        mutex_lock(js->sleep_lock);
+        atomic_fetch_add(&js->sleeping, 1);
+        while (atomic_load(&js->queued) == 0 && atomic_load(&js->running)) {
+            condvar_wait(js->wake_cv, js->sleep_lock);
+        }
+        atomic_fetch_sub(&js->sleeping, 1);
+        mutex_unlock(js->sleep_lock);
+        idle = 0;
+    }
+
+    t_job_system = NULL;
+    t_job_index = UINT32_MAX;
+    return 0;
+}
+
+// --- Lifecycle ---
+
+JobSystem* job_system_create(uint32_t worker_count) {
+    if (worker_count == 0) {
+        unsigned int hw = thread_hardware_concurrency();
+        worker_count = hw > 1 ? hw - 1 : 0;
+    }
+    if (worker_count > JOB_SYSTEM_MAX_WORKERS) {
+        worker_count = JOB_SYSTEM_MAX_WORKERS;
+    }
+
+    JobSystem* js = (JobSystem*)calloc(1, sizeof(JobSystem));
+    if (!js) return NULL;
+
+    js->thread_count = worker_count + 1;
+    js->deques = (JobDeque*)calloc(js->thread_count, sizeof(JobDeque));
+    js->workers = (JobWorker*)calloc(js->thread_count, sizeof(JobWorker));
+    js->inject_lock = mutex_create();
+    js->sleep_lock = mutex_create();
+    js->wake_cv = condvar_create();
+
+    if (!js->deques || !js->workers || !js->inject_lock || !js->sleep_lock || !js->wake_cv) {
+        condvar_destroy(js->wake_cv);
+        mutex_destroy(js->sleep_lock);
+        mutex_destroy(js->inject_lock);
+        free(js->workers);
+        free(js->deques);
+        free(js);
+        return NULL;
+    }
+
+    atomic_init(&js->queued, 0);
+    atomic_init(&js->sleeping, 0);
+    atomic_init(&js->running, true);
+
+    // The creating thread participates as index 0
+    t_job_system = js;
+    t_job_index = 0;
+
+    for (uint32_t i = 1; i < js->thread_count; ++i) {
+        JobWorker* worker = &js->workers[i];
+        worker->js = js;
+        worker->index = i;
+        worker->thread = thread_create(worker_main, worker);
+        if (!worker->thread) {
+            // Run with whatever we managed to start; unstarted deques are only stolen from.
+            js->thread_count = i;
+            break;
+        }
+    }
+
+    return js;
+}
+
+void job_system_destroy(JobSystem* js) {
+    if (!js) return;
+
+    mutex_lock(js->sleep_lock);
+    atomic_store(&js->running, false);
+    condvar_broadcast(js->wake_cv);
+    mutex_unlock(js->sleep_lock);
+
+    for (uint32_t i = 1; i < js->thread_count; ++i) {
+        thread_join(js->workers[i].thread);
+    }
+
+    if (t_job_system == js) {
+        t_job_system = NULL;
+        t_job_index = UINT32_MAX;
+    }
+
+    condvar_destroy(js->wake_cv);
+    mutex_destroy(js->sleep_lock);
+    mutex_destroy(js->inject_lock);
+    free(js->workers);
+    free(js->deques);
+    free(js);
+}
+
+uint32_t job_system_thread_count(const JobSystem* js) {
+    return js ? js->thread_count : 1;
+}
+
+uint32_t job_system_thread_index(const JobSystem* js) {
+    return (js && t_job_system == js) ? t_job_index : UINT32_MAX;
+}
+
+// --- Submission ---
+
+void job_system_run(JobSystem* js, JobFunction func, void* user_data, JobCounter* counter) {
+    if (!func) return;
+
+    Job job = {
+        .func = func,
+        .user_data = user_data,
+        .counter = counter
+    };
+    if (counter) {
+        atomic_fetch_add_explicit(&counter->pending, 1, memory_order_relaxed);
+    }
+
+    if (!js) {
+        job_execute(&job);
+        return;
+    }
+    job_submit(js, &job);
+}
+
+void job_system_run_range(JobSystem* js, uint32_t count, uint32_t batch_size,
+                          JobRangeFunction func, void* user_data, JobCounter* counter) {
+    if (!func || count == 0) return;
+
+    if (batch_size == 0) {
+        // ~4 batches per thread leaves room for stealing to even out imbalance
+        uint32_t target = job_system_thread_count(js) * 4;
+        batch_size = (count + target - 1) / target;
+    }
+
+    uint32_t batch_count = (count + batch_size - 1) / batch_size;
+    if (counter) {
+        atomic_fetch_add_explicit(&counter->pending, (int)batch_count, memory_order_relaxed);
+    }
+
+    for (uint32_t begin = 0; begin < count; begin += batch_size) {
+        uint32_t end = (count - begin > batch_size) ? begin + batch_size : count;
+        Job job = {
+            .range_func = func,
+            .user_data = user_data,
+            .begin = begin,
+            .end = end,
+            .counter = counter
+        };
+        if (js) {
+            job_submit(js, &job);
+        } else {
+            job_execute(&job);
+        }
+    }
+}
+
+void job_system_wait(JobSystem* js, JobCounter* counter) {
+    if (!counter) return;
+
+    uint32_t index = job_system_thread_index(js);
+    while (atomic_load_explicit(&counter->pending, memory_order_acquire) > 0) {
+        Job job;
+        if (js && job_acquire(js, index, &job)) {
+            job_execute(&job);
+        } else {
+            thread_yield();
+        }
+    }
+}
+
+void job_system_parallel_for(JobSystem* js, uint32_t count, uint32_t batch_size,
+                             JobRangeFunction func, void* user_data) {
+    if (!func || count == 0) return;
+
+    if (!js || js->thread_count == 1) {
+        func(user_data, 0, count);
+        return;
+    }
+
+    JobCounter counter = {0};
+    job_system_run_range(js, count, batch_size, func, user_data, &counter);
+    job_system_wait(js, &counter);
+}
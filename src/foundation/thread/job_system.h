@@ -0,0 +1,91 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+// Opaque handle
+typedef struct JobSystem JobSystem;
+
+// Upper bound on worker threads (excluding the thread that created the system).
+#define JOB_SYSTEM_MAX_WORKERS 63
+
+// --- Job Types ---
+typedef void (*JobFunction)(void* user_data);
+
+// Processes the half-open index range [begin, end).
+typedef void (*JobRangeFunction)(void* user_data, uint32_t begin, uint32_t end);
+
+/**
+ * @brief Completion counter shared by a group of jobs.
+ * Incremented on submit, decremented when a job finishes.
+ * Zero-initialize before use (e.g. `JobCounter counter = {0};`).
+ */
+typedef struct JobCounter {
+    atomic_int pending;
+} JobCounter;
+
+// --- Lifecycle ---
+
+/**
+ * @brief Creates a job system and starts its worker threads.
+ * The calling thread becomes participant 0 and executes jobs while it waits.
+ * @param worker_count Number of background workers. 0 = hardware concurrency - 1.
+ * @return Pointer to the job system, or NULL on failure.
+ */
+JobSystem* job_system_create(uint32_t worker_count);
+
+/**
+ * @brief Stops and joins all workers. Pending jobs are discarded.
+ * Must be called from the thread that created the system.
+ * @param js The job system to destroy.
+ */
+void job_system_destroy(JobSystem* js);
+
+/**
+ * @brief Returns the number of threads executing jobs (workers + creating thread).
+ */
+uint32_t job_system_thread_count(const JobSystem* js);
+
+/**
+ * @brief Returns the participant index of the calling thread, in [0, thread_count).
+ * Threads that do not belong to the system return UINT32_MAX.
+ */
+uint32_t job_system_thread_index(const JobSystem* js);
+
+// --- Submission ---
+
+/**
+ * @brief Schedules a job. Never blocks; if the local queue is full the job runs inline.
+ * @param js The job system.
+ * @param func Function to execute.
+ * @param user_data Argument passed to the function.
+ * @param counter Optional counter to wait on (may be NULL).
+ */
+void job_system_run(JobSystem* js, JobFunction func, void* user_data, JobCounter* counter);
+
+/**
+ * @brief Schedules `func` over [0, count) split into batches of `batch_size` indices.
+ * Returns immediately; wait on `counter` for completion.
+ * @param batch_size Indices per job. 0 picks a size based on the thread count.
+ */
+void job_system_run_range(JobSystem* js, uint32_t count, uint32_t batch_size,
+                          JobRangeFunction func, void* user_data, JobCounter* counter);
+
+/**
+ * @brief Blocks until the counter reaches zero.
+ * The calling thread executes queued jobs while waiting, so it is safe to wait from inside a job.
+ * @param js The job system.
+ * @param counter The counter to wait on.
+ */
+void job_system_wait(JobSystem* js, JobCounter* counter);
+
+/**
+ * @brief Runs `func` over [0, count) in parallel and waits for completion.
+ * With a NULL job system the whole range runs on the calling thread.
+ */
+void job_system_parallel_for(JobSystem* js, uint32_t count, uint32_t batch_size,
+                             JobRangeFunction func, void* user_data);
+
+#endif // JOB_SYSTEM_H
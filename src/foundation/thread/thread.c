@@ -15,6 +15,10 @@
         SRWLOCK handle;
     };
 
+    struct ConditionVariable {
+        CONDITION_VARIABLE handle;
+    };
+
     struct Thread {
         HANDLE handle;
         unsigned int id;
@@ -48,6 +52,37 @@
         }
     }
 
+    ConditionVariable* condvar_create(void) {
+        ConditionVariable* cv = (ConditionVariable*)malloc(sizeof(ConditionVariable));
+        if (cv) {
+            InitializeConditionVariable(&cv->handle);
+        }
+        return cv;
+    }
+
+    void condvar_destroy(ConditionVariable* cv) {
+        // Condition variables don't need explicit destruction in Win32
+        free(cv);
+    }
+
+    void condvar_wait(ConditionVariable* cv, Mutex* mutex) {
+        if (cv && mutex) {
+            SleepConditionVariableSRW(&cv->handle, &mutex->handle, INFINITE, 0);
+        }
+    }
+
+    void condvar_signal(ConditionVariable* cv) {
+        if (cv) {
+            WakeConditionVariable(&cv->handle);
+        }
+    }
+
+    void condvar_broadcast(ConditionVariable* cv) {
+        if (cv) {
+            WakeAllConditionVariable(&cv->handle);
+        }
+    }
+
     // Thread wrapper to match signature
     typedef struct {
         ThreadFunction func;
@@ -110,6 +145,10 @@
         Sleep(milliseconds);
     }
 
+    void thread_yield(void) {
+        SwitchToThread();
+    }
+
     unsigned int thread_hardware_concurrency(void) {
         SYSTEM_INFO sysinfo;
         GetSystemInfo(&sysinfo);
@@ -118,6 +157,7 @@
 
 #else
     #include <pthread.h>
+    #include <sched.h>
     #include <unistd.h>
     #include <time.h>
 
@@ -125,6 +165,10 @@
         pthread_mutex_t handle;
     };
 
+    struct ConditionVariable {
+        pthread_cond_t handle;
+    };
+
     struct Thread {
         pthread_t handle;
     };
@@ -172,6 +216,39 @@
         }
     }
 
+    ConditionVariable* condvar_create(void) {
+        ConditionVariable* cv = (ConditionVariable*)malloc(sizeof(ConditionVariable));
+        if (cv) {
+            pthread_cond_init(&cv->handle, NULL);
+        }
+        return cv;
+    }
+
+    void condvar_destroy(ConditionVariable* cv) {
+        if (cv) {
+            pthread_cond_destroy(&cv->handle);
+            free(cv);
+        }
+    }
+
+    void condvar_wait(ConditionVariable* cv, Mutex* mutex) {
+        if (cv && mutex) {
+            pthread_cond_wait(&cv->handle, &mutex->handle);
+        }
+    }
+
+    void condvar_signal(ConditionVariable* cv) {
+        if (cv) {
+            pthread_cond_signal(&cv->handle);
+        }
+    }
+
+    void condvar_broadcast(ConditionVariable* cv) {
+        if (cv) {
+            pthread_cond_broadcast(&cv->handle);
+        }
+    }
+
     Thread* thread_create(ThreadFunction func, void* arg) {
         Thread* t = (Thread*)malloc(sizeof(Thread));
         if (!t) return NULL;
@@ -217,6 +294,10 @@
         nanosleep(&ts, NULL);
     }
 
+    void thread_yield(void) {
+        sched_yield();
+    }
+
     unsigned int thread_hardware_concurrency(void) {
         long nprocs = -1;
         #ifdef _SC_NPROCESSORS_ONLN
@@ -3,8 +3,16 @@
 
 #include <stdbool.h>
 
+// Thread-local storage specifier (C11 _Thread_local is not available on MSVC)
+#if defined(_MSC_VER)
+    #define THREAD_LOCAL __declspec(thread)
+#else
+    #define THREAD_LOCAL _Thread_local
+#endif
+
 // Opaque handles
 typedef struct Mutex Mutex;
+typedef struct ConditionVariable ConditionVariable;
 typedef struct Thread Thread;
 
 // --- Mutex ---
@@ -32,6 +40,40 @@ void mutex_lock(Mutex* mutex);
  */
 void mutex_unlock(Mutex* mutex);
 
+// --- Condition Variable ---
+/**
+ * @brief Creates a new condition variable.
+ * @return Pointer to the condition variable, or NULL on failure.
+ */
+ConditionVariable* condvar_create(void);
+
+/**
+ * @brief Destroys a condition variable.
+ * @param cv The condition variable to destroy.
+ */
+void condvar_destroy(ConditionVariable* cv);
+
+/**
+ * @brief Atomically releases the mutex and blocks until signaled.
+ * The mutex is re-acquired before returning. Spurious wakeups are possible,
+ * so callers must re-check their predicate in a loop.
+ * @param cv The condition variable to wait on.
+ * @param mutex A mutex locked by the calling thread.
+ */
+void condvar_wait(ConditionVariable* cv, Mutex* mutex);
+
+/**
+ * @brief Wakes one thread waiting on the condition variable.
+ * @param cv The condition variable to signal.
+ */
+void condvar_signal(ConditionVariable* cv);
+
+/**
+ * @brief Wakes all threads waiting on the condition variable.
+ * @param cv The condition variable to broadcast.
+ */
+void condvar_broadcast(ConditionVariable* cv);
+
 // --- Thread ---
 typedef int (*ThreadFunction)(void* arg);
 
@@ -63,6 +105,11 @@ int thread_join(Thread* thread);
  */
 void thread_sleep(unsigned int milliseconds);
 
+/**
+ * @brief Yields the remainder of the current time slice to other threads.
+ */
+void thread_yield(void);
+
 /**
  * @brief Returns the number of concurrent threads supported by hardware.
  * @return Number of threads (e.g., cores).
@@ -1,10 +1,13 @@
 #include "test_framework.h"
 #include "foundation/config/config_system.h"
 #include "foundation/config/simple_yaml.h"
+#include "foundation/config/config_cache.h"
 #include "foundation/memory/arena.h"
 #include "foundation/meta/reflection.h"
 #include "foundation/math/math_types.h"
 #include "foundation/string/string_id.h"
+#include "foundation/platform/fs.h"
+#include <stdio.h>
 
 // --- Mock Data ---
 
@@ -20,37 +23,72 @@ typedef struct TestColor {
     Vec4 color;
 } TestColor;
 
+typedef struct TestItem {
+    int id;
+    TestColor tint;
+} TestItem;
+
+// Hand-written metas: no name ids or field order (linear lookup path)
 static MetaField test_node_fields[] = {
-    { "id", META_TYPE_INT, offsetof(TestNode, id), "int" },
-    { "value", META_TYPE_FLOAT, offsetof(TestNode, value), "float" },
-    { "name", META_TYPE_STRING, offsetof(TestNode, name), "string" },
-    { "children", META_TYPE_POINTER_ARRAY, offsetof(TestNode, children), "TestNode" },
-    { "child_count", META_TYPE_INT, offsetof(TestNode, child_count), "int" },
+    { "id", META_TYPE_INT, offsetof(TestNode, id), "int", 0 },
+    { "value", META_TYPE_FLOAT, offsetof(TestNode, value), "float", 0 },
+    { "name", META_TYPE_STRING, offsetof(TestNode, name), "string", 0 },
+    { "children", META_TYPE_POINTER_ARRAY, offsetof(TestNode, children), "TestNode", 0 },
+    { "child_count", META_TYPE_INT, offsetof(TestNode, child_count), "int", 0 },
 };
 
 static MetaStruct test_node_meta = {
     "TestNode",
     sizeof(TestNode),
     test_node_fields,
-    5
+    5,
+    NULL,
+    0
 };
 
 static MetaField test_color_fields[] = {
-    { "color", META_TYPE_VEC4, offsetof(TestColor, color), "Vec4" },
+    { "color", META_TYPE_VEC4, offsetof(TestColor, color), "Vec4", 0 },
 };
 
 static MetaStruct test_color_meta = {
     "TestColor",
     sizeof(TestColor),
     test_color_fields,
-    1
+    1,
+    NULL,
+    0
+};
+
+// Codegen-style meta: ids and field order filled in at startup (see init_indexed_meta)
+static MetaField test_item_fields[] = {
+    { "id", META_TYPE_INT, offsetof(TestItem, id), NULL, 0 },
+    { "tint", META_TYPE_STRUCT, offsetof(TestItem, tint), "TestColor", 0 },
+};
+static uint16_t test_item_order[2];
+
+static MetaStruct test_item_meta = {
+    "TestItem",
+    sizeof(TestItem),
+    test_item_fields,
+    2,
+    test_item_order,
+    0
 };
 
+static void init_indexed_meta(void) {
+    test_item_fields[0].name_id = str_id("id");
+    test_item_fields[1].name_id = str_id("tint");
+    bool swap = test_item_fields[0].name_id > test_item_fields[1].name_id;
+    test_item_order[0] = swap ? 1 : 0;
+    test_item_order[1] = swap ? 0 : 1;
+}
+
 // --- Mock Registry ---
 
 const MetaStruct* meta_get_struct(const char* name) {
     if (strcmp(name, "TestNode") == 0) return &test_node_meta;
     if (strcmp(name, "TestColor") == 0) return &test_color_meta;
+    if (strcmp(name, "TestItem") == 0) return &test_item_meta;
     return NULL;
 }
 
@@ -163,10 +201,129 @@ int test_hex_color(void) {
     return 1;
 }
 
+int test_field_lookup(void) {
+    init_indexed_meta();
+
+    // Indexed (binary search) and linear metas resolve the same way
+    ASSERT_TRUE(meta_find_field(&test_item_meta, "tint") == &test_item_fields[1]);
+    ASSERT_TRUE(meta_find_field(&test_item_meta, "id") == &test_item_fields[0]);
+    ASSERT_TRUE(meta_find_field(&test_item_meta, "missing") == NULL);
+    ASSERT_TRUE(meta_find_field(&test_node_meta, "child_count") == &test_node_fields[4]);
+
+    StringId tint_id = STR_ID("tint");
+    StringId child_count_id = STR_ID("child_count");
+    ASSERT_TRUE(meta_find_field_by_id(&test_item_meta, tint_id) == &test_item_fields[1]);
+    ASSERT_TRUE(meta_find_field_by_id(&test_node_meta, child_count_id) == &test_node_fields[4]);
+    ASSERT_TRUE(meta_find_field_by_id(&test_item_meta, 0) == NULL);
+    return 1;
+}
+
+int test_field_path_resolver(void) {
+    init_indexed_meta();
+
+    size_t offset = 0;
+    const MetaField* direct = meta_find_field_by_path(&test_item_meta, "tint.color", &offset);
+    ASSERT_TRUE(direct == &test_color_fields[0]);
+    ASSERT_EQ_INT(offsetof(TestItem, tint) + offsetof(TestColor, color), offset);
+
+    // Cached resolver returns the same chain, repeatedly
+    for (int i = 0; i < 3; ++i) {
+        MetaFieldPath path = meta_resolve_field_path(&test_item_meta, "tint.color");
+        ASSERT_TRUE(path.field == direct);
+        ASSERT_EQ_INT(offset, path.offset);
+    }
+
+    // Same path on another root is a different cache entry
+    MetaFieldPath other = meta_resolve_field_path(&test_node_meta, "tint.color");
+    ASSERT_TRUE(other.field == NULL);
+
+    // Failures: missing segment, traversal into a non-struct, empty segment
+    ASSERT_TRUE(meta_resolve_field_path(&test_item_meta, "tint.missing").field == NULL);
+    ASSERT_TRUE(meta_resolve_field_path(&test_item_meta, "id.x").field == NULL);
+    ASSERT_TRUE(meta_resolve_field_path(&test_item_meta, "tint..color").field == NULL);
+    return 1;
+}
+
+static int test_compiled_cache(void) {
+    const char* source_path = "config_cache_test_source.yaml";
+    const char* source_v1 = "name: root\n";
+    ASSERT_TRUE(fs_write_bin(source_path, source_v1, strlen(source_v1)));
+
+    // Root with one child; pointers and strings go through the writer
+    ConfigCacheWriter w;
+    config_cache_writer_init(&w);
+
+    TestNode node = { 7, 1.5f, NULL, NULL, 1 };
+    size_t root = config_cache_writer_push(&w, &node, sizeof(TestNode), _Alignof(TestNode));
+    config_cache_writer_set_pointer(&w, root + offsetof(TestNode, name), config_cache_writer_push_string(&w, "root"));
+
+    size_t children = config_cache_writer_push(&w, NULL, sizeof(TestNode*), _Alignof(TestNode*));
+    config_cache_writer_set_pointer(&w, root + offsetof(TestNode, children), children);
+
+    TestNode child = { 8, 2.5f, NULL, NULL, 0 };
+    size_t child_at = config_cache_writer_push(&w, &child, sizeof(TestNode), _Alignof(TestNode));
+    config_cache_writer_set_pointer(&w, children, child_at);
+    config_cache_writer_set_pointer(&w, child_at + offsetof(TestNode, name), SIZE_MAX);
+    config_cache_writer_set_pointer(&w, child_at + offsetof(TestNode, children), SIZE_MAX);
+    ASSERT_TRUE(!w.failed);
+
+    ConfigCacheDependency dep;
+    ASSERT_TRUE(config_cache_dependency_init(&dep, source_path));
+
+    char cache_path[256];
+    config_cache_path(source_path, "test", cache_path, sizeof(cache_path));
+    ASSERT_TRUE(config_cache_write(cache_path, 42, &dep, 1, &w, root));
+
+    // Same payload recorded with a wrong hash: it only hits if size + mtime skip the read
+    char unread_path[256];
+    config_cache_path(source_path, "test_unread", unread_path, sizeof(unread_path));
+    ConfigCacheDependency unread = dep;
+    unread.hash ^= 1;
+    ASSERT_TRUE(config_cache_write(unread_path, 42, &unread, 1, &w, root));
+    config_cache_writer_free(&w);
+
+    MemoryArena arena;
+    arena_init(&arena, 4096);
+
+    // Round trip with pointer fixup
+    TestNode* loaded = (TestNode*)config_cache_load(cache_path, 42, &arena);
+    ASSERT_TRUE(loaded != NULL);
+    ASSERT_EQ_INT(7, loaded->id);
+    ASSERT_STR_EQ("root", loaded->name);
+    ASSERT_EQ_INT(1, (int)loaded->child_count);
+    ASSERT_EQ_INT(8, loaded->children[0]->id);
+    ASSERT_TRUE(loaded->children[0]->name == NULL);
+    ASSERT_TRUE(loaded->children[0]->children == NULL);
+    ASSERT_TRUE((char*)loaded->children[0] > (char*)loaded && (char*)loaded->children[0] < (char*)arena.base + arena.offset);
+
+    // Schema mismatch is a miss
+    ASSERT_TRUE(config_cache_load(cache_path, 43, &arena) == NULL);
+
+    ASSERT_TRUE(config_cache_load(unread_path, 42, &arena) != NULL);
+
+    // Rewriting identical contents (new mtime) still hits through the hash
+    ASSERT_TRUE(fs_write_bin(source_path, source_v1, strlen(source_v1)));
+    ASSERT_TRUE(config_cache_load(cache_path, 42, &arena) != NULL);
+
+    // Editing the source invalidates the cache
+    const char* source_v2 = "name: changed\n";
+    ASSERT_TRUE(fs_write_bin(source_path, source_v2, strlen(source_v2)));
+    ASSERT_TRUE(config_cache_load(cache_path, 42, &arena) == NULL);
+
+    arena_destroy(&arena);
+    remove(cache_path);
+    remove(unread_path);
+    remove(source_path);
+    return 1;
+}
+
 int main(void) {
     TEST_INIT("Config Deserializer");
     TEST_RUN(test_simple_struct);
     TEST_RUN(test_nested_array);
     TEST_RUN(test_hex_color);
+    TEST_RUN(test_field_lookup);
+    TEST_RUN(test_field_path_resolver);
+    TEST_RUN(test_compiled_cache);
     TEST_REPORT();
 }
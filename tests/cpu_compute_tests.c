@@ -0,0 +1,234 @@
+#include "test_framework.h"
+#include "features/math_engine/math_graph.h"
+#include "features/math_engine/internal/transpiler.h"
+#include "engine/graphics/render_system.h"
+#include "engine/graphics/compute_graph.h"
+#include "engine/graphics/stream.h"
+#include "engine/graphics/cpu_compute.h"
+#include "engine/graphics/internal/backend/null/null_renderer.h"
+#include "engine/assets/assets.h"
+#include "foundation/thread/job_system.h"
+#include "foundation/memory/arena.h"
+#include "foundation/platform/platform.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TARGET NULL_COMPUTE_TARGET_SIZE
+
+// Runs 'graph' through the headless backend the way the math editor does (32x32 groups
+// of 16x16) and returns the compute target
+static bool run_graph(RenderSystem* rs, MathGraph* graph, const GpuInputState* input, CpuComputeImage* out) {
+    CpuComputeKernel kernel;
+    if (!math_graph_build_cpu_kernel(graph, &kernel)) return false;
+    uint32_t pipeline = render_system_create_cpu_compute_pipeline(rs, &kernel);
+    if (pipeline == 0) {
+        kernel.destroy(kernel.program);
+        return false;
+    }
+
+    // The render system only creates its input stream once assets are bound, so bind our own
+    Stream* input_stream = stream_create(rs, STREAM_CUSTOM, 1, sizeof(GpuInputState));
+    stream_set_data(input_stream, input, 1);
+
+    ComputeGraph* compute = compute_graph_create();
+    ComputePass* pass = compute_graph_add_pass(compute, pipeline, 32, 32, 1);
+    compute_pass_bind_stream(pass, 1, input_stream);
+    compute_graph_execute(compute, rs);
+    compute_graph_destroy(compute);
+    render_system_destroy_compute_pipeline(rs, pipeline);
+    stream_destroy(input_stream);
+
+    return null_renderer_get_compute_target(render_system_get_backend(rs), out);
+}
+
+static const uint8_t* pixel(const CpuComputeImage* image, uint32_t x, uint32_t y) {
+    return image->pixels + (size_t)y * image->stride + (size_t)x * 4;
+}
+
+static uint8_t unorm8(float v) {
+    v = fabsf(v);
+    return (uint8_t)((v < 1.0f ? v : 1.0f) * 255.0f + 0.5f);
+}
+
+static RenderSystem* make_headless(void) {
+    RenderSystemConfig config = { .window = NULL, .backend_type = "null", .width = TARGET, .height = TARGET };
+    return render_system_create(&config);
+}
+
+static int test_uv_gradient(void) {
+    MemoryArena arena;
+    arena_init(&arena, 1024 * 1024);
+    MathGraph* graph = math_graph_create(&arena);
+    MathNodeId uv = math_graph_add_node(graph, MATH_NODE_UV);
+    MathNodeId output = math_graph_add_node(graph, MATH_NODE_OUTPUT);
+    math_graph_connect(graph, output, 0, uv);
+
+    RenderSystem* rs = make_headless();
+    TEST_ASSERT(rs != NULL);
+    TEST_ASSERT(render_system_supports_cpu_compute(rs));
+
+    GpuInputState input = { .screen_width = TARGET, .screen_height = TARGET };
+    CpuComputeImage image;
+    TEST_ASSERT(run_graph(rs, graph, &input, &image));
+
+    // vec2 -> (|u|, |v|, 0, 1)
+    const uint32_t probes[][2] = { {0, 0}, {511, 0}, {128, 384}, {300, 77}, {511, 511} };
+    for (size_t i = 0; i < sizeof(probes) / sizeof(probes[0]); ++i) {
+        uint32_t x = probes[i][0], y = probes[i][1];
+        const uint8_t* p = pixel(&image, x, y);
+        TEST_ASSERT_INT_EQ(unorm8((float)x / TARGET), p[0]);
+        TEST_ASSERT_INT_EQ(unorm8((float)y / TARGET), p[1]);
+        TEST_ASSERT_INT_EQ(0, p[2]);
+        TEST_ASSERT_INT_EQ(255, p[3]);
+    }
+
+    NullRendererStats stats;
+    null_renderer_get_stats(render_system_get_backend(rs), &stats);
+    TEST_ASSERT_INT_EQ(1, (int)stats.cpu_dispatches);
+    TEST_ASSERT_INT_EQ(TARGET * TARGET, (int)stats.cpu_pixels);
+    TEST_ASSERT_INT_EQ(0, (int)stats.live_pipelines);
+
+    render_system_destroy(rs);
+    math_graph_destroy(graph);
+    arena_destroy(&arena);
+    return 1;
+}
+
+// sin(uv * time) / (mouse_buttons + 2) against the same expression evaluated per pixel,
+// with the GLSL emitter's remapped sin and guarded division
+static int test_matches_reference(void) {
+    MemoryArena arena;
+    arena_init(&arena, 1024 * 1024);
+    MathGraph* graph = math_graph_create(&arena);
+    MathNodeId uv = math_graph_add_node(graph, MATH_NODE_UV);
+    MathNodeId time = math_graph_add_node(graph, MATH_NODE_TIME);
+    MathNodeId mul = math_graph_add_node(graph, MATH_NODE_MUL);
+    MathNodeId sine = math_graph_add_node(graph, MATH_NODE_SIN);
+    MathNodeId buttons = math_graph_add_node(graph, MATH_NODE_MOUSE_BUTTONS);
+    MathNodeId two = math_graph_add_node(graph, MATH_NODE_VALUE);
+    MathNodeId add = math_graph_add_node(graph, MATH_NODE_ADD);
+    MathNodeId div = math_graph_add_node(graph, MATH_NODE_DIV);
+    MathNodeId output = math_graph_add_node(graph, MATH_NODE_OUTPUT);
+    math_graph_set_value(graph, two, 2.0f);
+    math_graph_connect(graph, mul, 0, uv);
+    math_graph_connect(graph, mul, 1, time);
+    math_graph_connect(graph, sine, 0, mul);
+    math_graph_connect(graph, add, 0, buttons);
+    math_graph_connect(graph, add, 1, two);
+    math_graph_connect(graph, div, 0, sine);
+    math_graph_connect(graph, div, 1, add);
+    math_graph_connect(graph, output, 0, div);
+
+    RenderSystem* rs = make_headless();
+    // Only the top-left 300x200 is on screen; the shader leaves the rest untouched
+    GpuInputState input = { .time = 7.5f, .screen_width = 300, .screen_height = 200, .mouse_buttons = 1 };
+    CpuComputeImage image;
+
+    double start = platform_get_time_ms();
+    TEST_ASSERT(run_graph(rs, graph, &input, &image));
+    printf("  CPU dispatch (300x200): %.3f ms\n", platform_get_time_ms() - start);
+
+    int mismatches = 0;
+    for (uint32_t y = 0; y < 200; y += 7) {
+        for (uint32_t x = 0; x < 300; x += 5) {
+            float u = (float)x / 300.0f * input.time;
+            float v = (float)y / 200.0f * input.time;
+            float r = (sinf(u) * 0.5f + 0.5f) / (3.0f + 0.0001f);
+            float g = (sinf(v) * 0.5f + 0.5f) / (3.0f + 0.0001f);
+            const uint8_t* p = pixel(&image, x, y);
+            if (abs((int)p[0] - unorm8(r)) > 1 || abs((int)p[1] - unorm8(g)) > 1 || p[2] != 0 || p[3] != 255) mismatches++;
+        }
+    }
+    TEST_ASSERT_INT_EQ(0, mismatches);
+    TEST_ASSERT_INT_EQ(0, pixel(&image, 300, 10)[3]);
+    TEST_ASSERT_INT_EQ(0, pixel(&image, 10, 200)[3]);
+
+    render_system_destroy(rs);
+    math_graph_destroy(graph);
+    arena_destroy(&arena);
+    return 1;
+}
+
+// The engine's job system reaches the backend when it initializes (once assets are
+// bound); splitting rows over its workers must not change a pixel
+static int test_job_system_dispatch(void) {
+    MemoryArena arena;
+    arena_init(&arena, 1024 * 1024);
+    MathGraph* graph = math_graph_create(&arena);
+    MathNodeId uv = math_graph_add_node(graph, MATH_NODE_UV);
+    MathNodeId time = math_graph_add_node(graph, MATH_NODE_TIME);
+    MathNodeId mul = math_graph_add_node(graph, MATH_NODE_MUL);
+    MathNodeId sine = math_graph_add_node(graph, MATH_NODE_SIN);
+    MathNodeId output = math_graph_add_node(graph, MATH_NODE_OUTPUT);
+    math_graph_connect(graph, mul, 0, uv);
+    math_graph_connect(graph, mul, 1, time);
+    math_graph_connect(graph, sine, 0, mul);
+    math_graph_connect(graph, output, 0, sine);
+    GpuInputState input = { .time = 3.25f, .screen_width = TARGET, .screen_height = TARGET };
+
+    RenderSystem* serial = make_headless();
+    CpuComputeImage image;
+    TEST_ASSERT(run_graph(serial, graph, &input, &image));
+    size_t size = (size_t)image.stride * TARGET;
+    uint8_t* expected = malloc(size);
+    TEST_ASSERT(expected != NULL);
+    memcpy(expected, image.pixels, size);
+    render_system_destroy(serial);
+
+    JobSystem* jobs = job_system_create(3);
+    TEST_ASSERT(jobs != NULL);
+    Assets* assets = assets_create("cpu_compute_tests_assets"); // Missing dir: no shaders, no font
+    TEST_ASSERT(assets != NULL);
+    RenderSystemConfig config = { .backend_type = "null", .width = TARGET, .height = TARGET, .jobs = jobs };
+    RenderSystem* threaded = render_system_create(&config);
+    TEST_ASSERT(threaded != NULL);
+    render_system_bind_assets(threaded, assets);
+    TEST_ASSERT(run_graph(threaded, graph, &input, &image));
+    TEST_ASSERT(memcmp(expected, image.pixels, size) == 0);
+
+    render_system_destroy(threaded);
+    assets_destroy(assets);
+    job_system_destroy(jobs);
+    free(expected);
+    math_graph_destroy(graph);
+    arena_destroy(&arena);
+    return 1;
+}
+
+static int test_unsupported_graphs(void) {
+    MemoryArena arena;
+    arena_init(&arena, 1024 * 1024);
+    MathGraph* graph = math_graph_create(&arena);
+    CpuComputeKernel kernel;
+
+    // No CPU sampler
+    MathNodeId tex = math_graph_add_node(graph, MATH_NODE_TEXTURE_PARAM);
+    MathNodeId uv = math_graph_add_node(graph, MATH_NODE_UV);
+    MathNodeId sample = math_graph_add_node(graph, MATH_NODE_TEXTURE_SAMPLE);
+    math_graph_connect(graph, sample, 0, tex);
+    math_graph_connect(graph, sample, 1, uv);
+    TEST_ASSERT(!math_graph_build_cpu_kernel(graph, &kernel));
+    TEST_ASSERT(kernel.program == NULL);
+
+    // Unconnected operand
+    math_graph_clear(graph);
+    MathNodeId value = math_graph_add_node(graph, MATH_NODE_VALUE);
+    MathNodeId add = math_graph_add_node(graph, MATH_NODE_ADD);
+    math_graph_connect(graph, add, 0, value);
+    TEST_ASSERT(!math_graph_build_cpu_kernel(graph, &kernel));
+
+    math_graph_destroy(graph);
+    arena_destroy(&arena);
+    return 1;
+}
+
+int main(void) {
+    TEST_INIT("CPU Compute");
+    TEST_RUN(test_uv_gradient);
+    TEST_RUN(test_matches_reference);
+    TEST_RUN(test_job_system_dispatch);
+    TEST_RUN(test_unsupported_graphs);
+    TEST_REPORT();
+}
@@ -0,0 +1,204 @@
+#include "test_framework.h"
+#include "engine/graphics/internal/gpu_allocator.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Fake Heap ---
+// Blocks are plain host memory, so placements can be checked by writing into them.
+
+typedef struct FakeHeap {
+    int live_blocks;
+    int total_allocs;
+    uint64_t budget; // Bytes the heap may still hand out
+} FakeHeap;
+
+static bool fake_allocate(void* user, uint32_t memory_type, uint64_t size, uint64_t* out_memory, void** out_mapped) {
+    (void)memory_type;
+    FakeHeap* heap = (FakeHeap*)user;
+    if (size > heap->budget) return false;
+    void* mem = calloc(1, (size_t)size);
+    if (!mem) return false;
+    heap->budget -= size;
+    heap->live_blocks++;
+    heap->total_allocs++;
+    *out_memory = (uint64_t)(uintptr_t)mem;
+    *out_mapped = mem;
+    return true;
+}
+
+static void fake_free(void* user, uint32_t memory_type, uint64_t memory) {
+    (void)memory_type;
+    FakeHeap* heap = (FakeHeap*)user;
+    heap->live_blocks--;
+    free((void*)(uintptr_t)memory);
+}
+
+static GpuAllocator* make_allocator(FakeHeap* heap, uint64_t block_size) {
+    memset(heap, 0, sizeof(*heap));
+    heap->budget = (uint64_t)1 << 30;
+    GpuAllocatorConfig config = {
+        .heap = { .user = heap, .allocate = fake_allocate, .free = fake_free },
+        .block_size = block_size,
+        .frame_count = 2,
+    };
+    return gpu_allocator_create(&config);
+}
+
+static bool overlaps(const GpuAllocation* a, const GpuAllocation* b) {
+    if (a->memory != b->memory) return false;
+    return a->offset < b->offset + b->size && b->offset < a->offset + a->size;
+}
+
+static int test_alignment_and_overlap(void) {
+    FakeHeap heap;
+    GpuAllocator* alloc = make_allocator(&heap, 1 << 20);
+    TEST_ASSERT(alloc != NULL);
+
+    enum { COUNT = 64 };
+    GpuAllocation allocs[COUNT];
+    for (int i = 0; i < COUNT; ++i) {
+        uint64_t alignment = (uint64_t)1 << (i % 9); // 1..256
+        uint64_t size = 1 + (uint64_t)((i * 977) % 5000);
+        TEST_ASSERT(gpu_allocator_alloc(alloc, 0, size, alignment, GPU_RESOURCE_LINEAR, &allocs[i]));
+        TEST_ASSERT_INT_EQ(0, (int)(allocs[i].offset % alignment));
+        TEST_ASSERT((uint8_t*)allocs[i].mapped == (uint8_t*)(uintptr_t)allocs[i].memory + allocs[i].offset);
+        memset(allocs[i].mapped, i, (size_t)size);
+    }
+    for (int i = 0; i < COUNT; ++i) {
+        for (int j = i + 1; j < COUNT; ++j) TEST_ASSERT(!overlaps(&allocs[i], &allocs[j]));
+    }
+    TEST_ASSERT_INT_EQ(1, heap.live_blocks); // All fit in one shared block
+
+    gpu_allocator_destroy(alloc);
+    TEST_ASSERT_INT_EQ(0, heap.live_blocks);
+    return 1;
+}
+
+static int test_coalescing(void) {
+    FakeHeap heap;
+    GpuAllocator* alloc = make_allocator(&heap, 1 << 16);
+
+    // Fill the block exactly, free in a scattered order, then it must fit whole again
+    GpuAllocation allocs[16];
+    for (int i = 0; i < 16; ++i) {
+        TEST_ASSERT(gpu_allocator_alloc(alloc, 0, 4096, 16, GPU_RESOURCE_LINEAR, &allocs[i]));
+    }
+    TEST_ASSERT_INT_EQ(1, heap.live_blocks);
+    GpuAllocatorStats stats = gpu_allocator_get_stats(alloc);
+    TEST_ASSERT_INT_EQ(16, (int)stats.allocation_count);
+    TEST_ASSERT(stats.bytes_used == stats.bytes_reserved);
+
+    static const int order[16] = { 3, 9, 0, 15, 4, 8, 1, 14, 2, 10, 7, 12, 6, 13, 5, 11 };
+    for (int i = 0; i < 16; ++i) gpu_allocator_free(alloc, &allocs[order[i]]);
+
+    stats = gpu_allocator_get_stats(alloc);
+    TEST_ASSERT_INT_EQ(0, (int)stats.allocation_count);
+    TEST_ASSERT_INT_EQ(1, (int)stats.block_count); // Last shared block is kept
+
+    GpuAllocation whole;
+    TEST_ASSERT(gpu_allocator_alloc(alloc, 0, 1 << 15, 1 << 15, GPU_RESOURCE_LINEAR, &whole));
+    TEST_ASSERT_INT_EQ(0, (int)whole.offset);
+    GpuAllocation rest;
+    TEST_ASSERT(gpu_allocator_alloc(alloc, 0, 1 << 15, 16, GPU_RESOURCE_LINEAR, &rest));
+    TEST_ASSERT_INT_EQ(1, heap.total_allocs); // No new block was needed
+
+    gpu_allocator_destroy(alloc);
+    return 1;
+}
+
+static int test_block_pools(void) {
+    FakeHeap heap;
+    GpuAllocator* alloc = make_allocator(&heap, 1 << 16);
+
+    // Buffers and optimal images never share a block (bufferImageGranularity)
+    GpuAllocation buffer, image, other_type;
+    TEST_ASSERT(gpu_allocator_alloc(alloc, 0, 256, 16, GPU_RESOURCE_LINEAR, &buffer));
+    TEST_ASSERT(gpu_allocator_alloc(alloc, 0, 256, 16, GPU_RESOURCE_OPTIMAL, &image));
+    TEST_ASSERT(gpu_allocator_alloc(alloc, 1, 256, 16, GPU_RESOURCE_LINEAR, &other_type));
+    TEST_ASSERT(buffer.memory != image.memory);
+    TEST_ASSERT(buffer.memory != other_type.memory);
+    TEST_ASSERT_INT_EQ(3, heap.live_blocks);
+
+    // Requests over half a block get their own block, released on free
+    GpuAllocation big;
+    TEST_ASSERT(gpu_allocator_alloc(alloc, 0, 3 << 14, 256, GPU_RESOURCE_LINEAR, &big));
+    TEST_ASSERT(big.memory != buffer.memory);
+    TEST_ASSERT_INT_EQ(4, heap.live_blocks);
+    gpu_allocator_free(alloc, &big);
+    TEST_ASSERT_INT_EQ(3, heap.live_blocks);
+
+    // A full block spills into a second one, which goes away once empty
+    GpuAllocation fill[4];
+    for (int i = 0; i < 4; ++i) {
+        TEST_ASSERT(gpu_allocator_alloc(alloc, 0, 1 << 14, 16, GPU_RESOURCE_LINEAR, &fill[i]));
+    }
+    TEST_ASSERT_INT_EQ(4, heap.live_blocks);
+    for (int i = 0; i < 4; ++i) gpu_allocator_free(alloc, &fill[i]);
+    TEST_ASSERT_INT_EQ(3, heap.live_blocks);
+
+    gpu_allocator_destroy(alloc);
+    TEST_ASSERT_INT_EQ(0, heap.live_blocks);
+    return 1;
+}
+
+static int test_transient_frames(void) {
+    FakeHeap heap;
+    GpuAllocator* alloc = make_allocator(&heap, 1 << 16);
+
+    GpuAllocation a, b, c;
+    TEST_ASSERT(gpu_allocator_alloc_transient(alloc, 0, 0, 100, 64, &a));
+    TEST_ASSERT(gpu_allocator_alloc_transient(alloc, 0, 0, 100, 64, &b));
+    TEST_ASSERT(a.memory == b.memory);
+    TEST_ASSERT_INT_EQ(0, (int)(b.offset % 64));
+    TEST_ASSERT(!overlaps(&a, &b));
+
+    // Another frame slot has its own memory
+    TEST_ASSERT(gpu_allocator_alloc_transient(alloc, 1, 0, 100, 64, &c));
+    TEST_ASSERT(c.memory != a.memory);
+
+    // Rewinding frame 0 reuses its memory without touching the heap
+    int allocs_before = heap.total_allocs;
+    gpu_allocator_begin_frame(alloc, 0);
+    GpuAllocation again;
+    TEST_ASSERT(gpu_allocator_alloc_transient(alloc, 0, 0, 100, 64, &again));
+    TEST_ASSERT(again.memory == a.memory);
+    TEST_ASSERT_INT_EQ(0, (int)again.offset);
+    TEST_ASSERT_INT_EQ(allocs_before, heap.total_allocs);
+
+    TEST_ASSERT(!gpu_allocator_alloc_transient(alloc, 5, 0, 100, 16, &again)); // Bad frame slot
+
+    gpu_allocator_destroy(alloc);
+    TEST_ASSERT_INT_EQ(0, heap.live_blocks);
+    return 1;
+}
+
+static int test_heap_exhaustion(void) {
+    FakeHeap heap;
+    GpuAllocator* alloc = make_allocator(&heap, 1 << 16);
+    heap.budget = 1 << 16;
+
+    GpuAllocation a, b;
+    TEST_ASSERT(gpu_allocator_alloc(alloc, 0, 1 << 15, 16, GPU_RESOURCE_LINEAR, &a));
+    TEST_ASSERT(gpu_allocator_alloc(alloc, 0, 1 << 15, 16, GPU_RESOURCE_LINEAR, &b));
+    GpuAllocation fail;
+    TEST_ASSERT(!gpu_allocator_alloc(alloc, 0, 16, 16, GPU_RESOURCE_LINEAR, &fail));
+    TEST_ASSERT(!gpu_allocator_alloc(alloc, 0, 16, 3, GPU_RESOURCE_LINEAR, &fail)); // Bad alignment
+
+    // Freeing makes room again
+    gpu_allocator_free(alloc, &a);
+    TEST_ASSERT(gpu_allocator_alloc(alloc, 0, 16, 16, GPU_RESOURCE_LINEAR, &a));
+
+    gpu_allocator_destroy(alloc);
+    return 1;
+}
+
+int main(void) {
+    TEST_INIT("GPU Memory Allocator");
+    TEST_RUN(test_alignment_and_overlap);
+    TEST_RUN(test_coalescing);
+    TEST_RUN(test_block_pools);
+    TEST_RUN(test_transient_frames);
+    TEST_RUN(test_heap_exhaustion);
+    TEST_REPORT();
+}
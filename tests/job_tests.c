@@ -0,0 +1,201 @@
+#include "test_framework.h"
+#include "foundation/thread/job_system.h"
+#include "foundation/thread/thread.h"
+#include <stdint.h>
+#include <time.h>
+
+#define ITEM_COUNT 100000
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// --- Workloads ---
+
+static void square_range(void* user_data, uint32_t begin, uint32_t end) {
+    uint64_t* values = (uint64_t*)user_data;
+    for (uint32_t i = begin; i < end; ++i) {
+        values[i] = (uint64_t)i * i;
+    }
+}
+
+static void increment_job(void* user_data) {
+    atomic_fetch_add((atomic_int*)user_data, 1);
+}
+
+typedef struct NestedContext {
+    JobSystem* js;
+    atomic_int leaves;
+} NestedContext;
+
+static void nested_parent_job(void* user_data) {
+    NestedContext* ctx = (NestedContext*)user_data;
+    JobCounter children = {0};
+    for (int i = 0; i < 16; ++i) {
+        job_system_run(ctx->js, increment_job, &ctx->leaves, &children);
+    }
+    // Waiting inside a job must not deadlock: the worker helps instead of blocking
+    job_system_wait(ctx->js, &children);
+}
+
+typedef struct BusyContext {
+    float* out;
+    uint32_t iterations;
+} BusyContext;
+
+static void busy_range(void* user_data, uint32_t begin, uint32_t end) {
+    BusyContext* ctx = (BusyContext*)user_data;
+    for (uint32_t i = begin; i < end; ++i) {
+        float x = (float)i;
+        for (uint32_t k = 0; k < ctx->iterations; ++k) {
+            x = x * 0.999f + 1.0f;
+        }
+        ctx->out[i] = x;
+    }
+}
+
+typedef struct ForeignContext {
+    JobSystem* js;
+    JobCounter* counter;
+    atomic_int* value;
+} ForeignContext;
+
+static int foreign_submitter(void* arg) {
+    ForeignContext* ctx = (ForeignContext*)arg;
+    for (int i = 0; i < 100; ++i) {
+        job_system_run(ctx->js, increment_job, ctx->value, ctx->counter);
+    }
+    return 0;
+}
+
+// --- Tests ---
+
+int test_parallel_for_correctness(void) {
+    // Fixed worker count so stealing is exercised even on single-core machines
+    JobSystem* js = job_system_create(3);
+    ASSERT_TRUE(js != NULL);
+    ASSERT_EQ_INT(0, job_system_thread_index(js));
+
+    uint64_t* values = (uint64_t*)calloc(ITEM_COUNT, sizeof(uint64_t));
+    ASSERT_TRUE(values != NULL);
+
+    // Odd batch sizes exercise the tail batch
+    uint32_t batch_sizes[] = {0, 1, 7, 1000, ITEM_COUNT * 2};
+    for (size_t b = 0; b < sizeof(batch_sizes) / sizeof(batch_sizes[0]); ++b) {
+        memset(values, 0, ITEM_COUNT * sizeof(uint64_t));
+        job_system_parallel_for(js, ITEM_COUNT, batch_sizes[b], square_range, values);
+        for (uint32_t i = 0; i < ITEM_COUNT; ++i) {
+            if (values[i] != (uint64_t)i * i) {
+                fprintf(stderr, "  Mismatch at %u (batch %u)\n", i, batch_sizes[b]);
+                free(values);
+                job_system_destroy(js);
+                return 0;
+            }
+        }
+    }
+
+    free(values);
+    job_system_destroy(js);
+    return 1;
+}
+
+int test_counter_and_nested_wait(void) {
+    JobSystem* js = job_system_create(3);
+    ASSERT_TRUE(js != NULL);
+
+    atomic_int value;
+    atomic_init(&value, 0);
+    JobCounter counter = {0};
+    // More jobs than a single deque holds: overflow must run inline, not drop
+    for (int i = 0; i < 5000; ++i) {
+        job_system_run(js, increment_job, &value, &counter);
+    }
+    job_system_wait(js, &counter);
+    ASSERT_EQ_INT(5000, atomic_load(&value));
+    ASSERT_EQ_INT(0, atomic_load(&counter.pending));
+
+    NestedContext ctx = {.js = js};
+    atomic_init(&ctx.leaves, 0);
+    JobCounter parents = {0};
+    for (int i = 0; i < 32; ++i) {
+        job_system_run(js, nested_parent_job, &ctx, &parents);
+    }
+    job_system_wait(js, &parents);
+    ASSERT_EQ_INT(32 * 16, atomic_load(&ctx.leaves));
+
+    job_system_destroy(js);
+    return 1;
+}
+
+int test_foreign_thread_submission(void) {
+    JobSystem* js = job_system_create(2);
+    ASSERT_TRUE(js != NULL);
+
+    atomic_int value;
+    atomic_init(&value, 0);
+    JobCounter counter = {0};
+    ForeignContext ctx = {js, &counter, &value};
+
+    Thread* t = thread_create(foreign_submitter, &ctx);
+    ASSERT_TRUE(t != NULL);
+    thread_join(t);
+
+    job_system_wait(js, &counter);
+    ASSERT_EQ_INT(100, atomic_load(&value));
+
+    job_system_destroy(js);
+    return 1;
+}
+
+int test_null_system_runs_inline(void) {
+    uint64_t values[64] = {0};
+    job_system_parallel_for(NULL, 64, 8, square_range, values);
+    ASSERT_TRUE(values[63] == 63u * 63u);
+    return 1;
+}
+
+int test_parallel_for_scaling(void) {
+    unsigned int hw = thread_hardware_concurrency();
+
+    float* out = (float*)malloc(ITEM_COUNT * sizeof(float));
+    ASSERT_TRUE(out != NULL);
+    BusyContext ctx = {out, 500};
+
+    double start = now_seconds();
+    busy_range(&ctx, 0, ITEM_COUNT);
+    double serial_time = now_seconds() - start;
+
+    JobSystem* js = job_system_create(0);
+    ASSERT_TRUE(js != NULL);
+    start = now_seconds();
+    job_system_parallel_for(js, ITEM_COUNT, 0, busy_range, &ctx);
+    double parallel_time = now_seconds() - start;
+    uint32_t threads = job_system_thread_count(js);
+    job_system_destroy(js);
+    free(out);
+
+    double speedup = serial_time / (parallel_time > 0.0 ? parallel_time : 1e-9);
+    printf("  threads=%u serial=%.2fms parallel=%.2fms speedup=%.2fx\n",
+           threads, serial_time * 1000.0, parallel_time * 1000.0, speedup);
+
+    // Only meaningful with real cores; conservative bound to stay stable on shared CI machines
+    if (hw >= 4) {
+        ASSERT_TRUE(speedup > 1.5);
+    }
+    return 1;
+}
+
+int main(void) {
+    TEST_INIT("Foundation Jobs");
+
+    TEST_RUN(test_parallel_for_correctness);
+    TEST_RUN(test_counter_and_nested_wait);
+    TEST_RUN(test_foreign_thread_submission);
+    TEST_RUN(test_null_system_runs_inline);
+    TEST_RUN(test_parallel_for_scaling);
+
+    TEST_REPORT();
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include "test_framework.h"
+#include "foundation/logger/logger.h"
+#include "foundation/thread/thread.h"
+#include <string.h>
+
+#define LOG_PATH "test_logs/logger_tests.log"
+#define PRODUCER_THREADS 4
+#define MESSAGES_PER_THREAD 2000
+
+typedef struct ProducerArgs {
+    int thread_index;
+    LogLevel level;
+} ProducerArgs;
+
+static int producer_main(void* arg) {
+    ProducerArgs* args = (ProducerArgs*)arg;
+    for (int i = 0; i < MESSAGES_PER_THREAD; ++i) {
+        logger_log(args->level, __FILE__, __LINE__, "producer %d level %d msg %d",
+                   args->thread_index, (int)args->level, i);
+    }
+    return 0;
+}
+
+static void run_producers(LogLevel level) {
+    Thread* threads[PRODUCER_THREADS];
+    ProducerArgs args[PRODUCER_THREADS];
+    for (int t = 0; t < PRODUCER_THREADS; ++t) {
+        args[t] = (ProducerArgs){t, level};
+        threads[t] = thread_create(producer_main, &args[t]);
+    }
+    for (int t = 0; t < PRODUCER_THREADS; ++t) {
+        if (threads[t]) thread_join(threads[t]);
+    }
+}
+
+// Counts file lines containing 'needle'
+static int count_lines(const char* needle) {
+    FILE* f = fopen(LOG_PATH, "r");
+    if (!f) return -1;
+    char line[LOG_MESSAGE_MAX + 128];
+    int count = 0;
+    while (fgets(line, sizeof(line), f)) {
+        if (strstr(line, needle)) count++;
+    }
+    fclose(f);
+    return count;
+}
+
+int test_logger_async_multi_producer(void) {
+    ASSERT_TRUE(logger_set_async(true));
+    ASSERT_TRUE(logger_is_async());
+
+    uint64_t drops_before = logger_get_dropped_count();
+    run_producers(LOG_LEVEL_INFO);
+    logger_flush();
+
+    // Every INFO record is either written or counted as dropped
+    int written = count_lines("level 2 msg");
+    uint64_t dropped = logger_get_dropped_count() - drops_before;
+    printf("  written=%d dropped=%llu\n", written, (unsigned long long)dropped);
+    ASSERT_EQ_INT(PRODUCER_THREADS * MESSAGES_PER_THREAD, written + (int)dropped);
+    return 1;
+}
+
+int test_logger_async_never_drops_errors(void) {
+    ASSERT_TRUE(logger_set_async(true));
+
+    run_producers(LOG_LEVEL_ERROR);
+    logger_flush();
+
+    ASSERT_EQ_INT(PRODUCER_THREADS * MESSAGES_PER_THREAD, count_lines("level 4 msg"));
+    return 1;
+}
+
+int test_logger_sync_mode(void) {
+    ASSERT_TRUE(logger_set_async(false));
+    ASSERT_TRUE(!logger_is_async());
+
+    LOG_WARN("sync marker %d", 42);
+    // Sync mode writes before returning
+    ASSERT_EQ_INT(1, count_lines("sync marker 42"));
+    return 1;
+}
+
+int main(void) {
+    TEST_INIT("Foundation Logger");
+
+    logger_init(LOG_PATH);
+    logger_set_console_level(LOG_LEVEL_FATAL); // Keep test output readable
+    logger_set_file_level(LOG_LEVEL_TRACE);
+
+    TEST_RUN(test_logger_async_multi_producer);
+    TEST_RUN(test_logger_async_never_drops_errors);
+    TEST_RUN(test_logger_sync_mode);
+
+    logger_shutdown();
+
+    TEST_REPORT();
+    return 0;
+}
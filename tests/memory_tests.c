@@ -1,5 +1,7 @@
 #include "test_framework.h"
 #include "foundation/memory/arena.h"
+#include "foundation/memory/scratch.h"
+#include "foundation/memory/handle_pool.h"
 #include <string.h>
 
 int test_arena_init_destroy(void) {
@@ -84,6 +86,197 @@ int test_arena_strings(void) {
     return 1;
 }
 
+int test_arena_alignment(void) {
+    MemoryArena arena;
+    arena_init(&arena, 1024);
+
+    arena_alloc_aligned(&arena, 1, 1);
+    void* p16 = arena_alloc_aligned(&arena, 16, 16);
+    ASSERT_TRUE(((uintptr_t)p16 & 15) == 0);
+
+    arena_alloc_aligned(&arena, 3, 1);
+    void* p256 = arena_alloc_aligned(&arena, 8, 256);
+    ASSERT_TRUE(((uintptr_t)p256 & 255) == 0);
+
+    // Non power-of-two alignment is rejected
+    ASSERT_TRUE(arena_alloc_aligned(&arena, 8, 24) == NULL);
+
+    arena_destroy(&arena);
+    return 1;
+}
+
+int test_arena_mark_rewind(void) {
+    MemoryArena arena;
+    arena_init(&arena, 256);
+
+    arena_alloc(&arena, 32);
+    ArenaMark mark = arena_mark(&arena);
+    size_t saved = arena.offset;
+
+    char* temp = (char*)arena_alloc(&arena, 100);
+    ASSERT_TRUE(temp != NULL);
+    ArenaMark inner = arena_mark(&arena);
+    arena_alloc(&arena, 50);
+    arena_rewind(inner);
+    ASSERT_EQ_INT(saved + 100, arena.offset);
+
+    arena_rewind(mark);
+    ASSERT_EQ_INT(saved, arena.offset);
+
+    // Space is reused after rewinding
+    char* again = (char*)arena_alloc(&arena, 100);
+    ASSERT_TRUE(again == temp);
+
+    arena_destroy(&arena);
+    return 1;
+}
+
+int test_arena_virtual_growth(void) {
+    MemoryArena arena;
+    size_t reserve = (size_t)1024 * 1024 * 1024; // 1GB of address space
+    ASSERT_TRUE(arena_init_virtual(&arena, reserve));
+    ASSERT_TRUE(arena.is_virtual);
+    ASSERT_EQ_INT(0, arena.committed);
+
+    // Small allocation commits a single chunk, not the reservation
+    char* small = (char*)arena_alloc(&arena, 100);
+    ASSERT_TRUE(small != NULL);
+    memset(small, 0xAB, 100);
+    ASSERT_EQ_INT(ARENA_COMMIT_GRANULARITY, arena.committed);
+
+    // Grow well past the first chunk
+    for (int i = 0; i < 64; ++i) {
+        char* block = (char*)arena_alloc(&arena, 1024 * 1024);
+        ASSERT_TRUE(block != NULL);
+        block[0] = 1;
+        block[1024 * 1024 - 1] = 1;
+    }
+    ASSERT_TRUE(arena.committed >= arena.offset);
+    ASSERT_TRUE(arena.committed < arena.offset + ARENA_COMMIT_GRANULARITY);
+
+    // Reset keeps pages committed for reuse
+    size_t committed = arena.committed;
+    arena_reset(&arena);
+    ASSERT_EQ_INT(committed, arena.committed);
+    ASSERT_TRUE(arena_alloc(&arena, 1024) == small);
+
+    // Exhausting the reservation still fails cleanly
+    ASSERT_TRUE(arena_alloc(&arena, reserve) == NULL);
+
+    arena_destroy(&arena);
+    ASSERT_TRUE(arena.base == NULL);
+    return 1;
+}
+
+static char* callee_build_string(MemoryArena* out, const char* text) {
+    // Uses scratch internally while writing its result into the caller's arena
+    Scratch scratch = scratch_begin(&out, 1);
+    char* temp = arena_push_string(scratch.arena, text);
+    char* result = arena_push_string(out, temp);
+    scratch_end(scratch);
+    return result;
+}
+
+int test_scratch_scopes(void) {
+    Scratch outer = scratch_begin(NULL, 0);
+    ASSERT_TRUE(outer.arena != NULL);
+    size_t base = outer.arena->offset;
+
+    int* values = (int*)arena_alloc(outer.arena, 16 * sizeof(int));
+    ASSERT_TRUE(values != NULL);
+    values[15] = 42;
+
+    // Nested scope on the same arena rewinds only its own allocations
+    Scratch inner = scratch_begin(NULL, 0);
+    ASSERT_TRUE(inner.arena == outer.arena);
+    arena_alloc(inner.arena, 1024);
+    scratch_end(inner);
+    ASSERT_EQ_INT(base + 16 * sizeof(int), outer.arena->offset);
+    ASSERT_EQ_INT(42, values[15]);
+
+    // A callee given our scratch arena as output must pick a different one
+    char* result = callee_build_string(outer.arena, "persist");
+    ASSERT_STR_EQ("persist", result);
+    char* clobber = (char*)arena_alloc(outer.arena, 8);
+    ASSERT_TRUE(clobber > result);
+
+    // Every arena in conflict: no scratch available
+    Scratch blocked_a = scratch_begin(NULL, 0);
+    Scratch blocked_b = scratch_begin(&blocked_a.arena, 1);
+    MemoryArena* all[2] = {blocked_a.arena, blocked_b.arena};
+    Scratch none = scratch_begin(all, 2);
+    ASSERT_TRUE(none.arena == NULL);
+    scratch_end(none);
+    scratch_end(blocked_b);
+    scratch_end(blocked_a);
+
+    scratch_end(outer);
+    ASSERT_EQ_INT(base, outer.arena->offset);
+
+    scratch_thread_shutdown();
+    return 1;
+}
+
+typedef struct PoolItem {
+    int value;
+    float pad[3];
+} PoolItem;
+
+int test_handle_pool(void) {
+    HandlePool* pool = handle_pool_create(sizeof(PoolItem), 0);
+    ASSERT_TRUE(pool != NULL);
+
+    // Grow past the initial capacity
+    Handle handles[200];
+    for (int i = 0; i < 200; ++i) {
+        PoolItem* item = NULL;
+        handles[i] = handle_pool_alloc_zero(pool, (void**)&item);
+        ASSERT_TRUE(handles[i] != HANDLE_INVALID);
+        ASSERT_TRUE(item != NULL);
+        ASSERT_EQ_INT(0, item->value);
+        item->value = i;
+    }
+    ASSERT_EQ_INT(200, handle_pool_count(pool));
+
+    // Free every even item; the dense array stays packed
+    for (int i = 0; i < 200; i += 2) {
+        handle_pool_free(pool, handles[i]);
+    }
+    ASSERT_EQ_INT(100, handle_pool_count(pool));
+
+    int sum = 0;
+    for (uint32_t i = 0; i < handle_pool_count(pool); ++i) {
+        PoolItem* item = (PoolItem*)handle_pool_at(pool, i);
+        ASSERT_TRUE(item->value % 2 == 1);
+        // Dense handle resolves back to the same object
+        ASSERT_TRUE(handle_pool_get(pool, handle_pool_handle_at(pool, i)) == item);
+        sum += item->value;
+    }
+    ASSERT_EQ_INT(100 * 100, sum); // 1 + 3 + ... + 199
+
+    // Stale handles fail even after the slot is reused
+    ASSERT_TRUE(handle_pool_get(pool, handles[0]) == NULL);
+    Handle reused = handle_pool_alloc(pool, NULL);
+    ASSERT_EQ_INT(HANDLE_INDEX(handles[198]), HANDLE_INDEX(reused)); // LIFO free list
+    ASSERT_TRUE(!handle_pool_is_valid(pool, handles[198]));
+    ASSERT_TRUE(handle_pool_is_valid(pool, reused));
+    ASSERT_EQ_INT(51, ((PoolItem*)handle_pool_get(pool, handles[51]))->value);
+
+    // Double free is ignored
+    handle_pool_free(pool, handles[0]);
+    ASSERT_EQ_INT(101, handle_pool_count(pool));
+    ASSERT_TRUE(handle_pool_get(pool, HANDLE_INVALID) == NULL);
+
+    // Clear invalidates everything
+    handle_pool_clear(pool);
+    ASSERT_EQ_INT(0, handle_pool_count(pool));
+    ASSERT_TRUE(handle_pool_get(pool, handles[51]) == NULL);
+    ASSERT_TRUE(handle_pool_get(pool, reused) == NULL);
+
+    handle_pool_destroy(pool);
+    return 1;
+}
+
 int main(void) {
     TEST_INIT("Foundation Memory");
     
@@ -92,6 +285,11 @@ int main(void) {
     TEST_RUN(test_arena_alloc_zero);
     TEST_RUN(test_arena_reset);
     TEST_RUN(test_arena_strings);
+    TEST_RUN(test_arena_alignment);
+    TEST_RUN(test_arena_mark_rewind);
+    TEST_RUN(test_arena_virtual_growth);
+    TEST_RUN(test_scratch_scopes);
+    TEST_RUN(test_handle_pool);
     
     TEST_REPORT();
     return 0;
@@ -0,0 +1,149 @@
+#include "test_framework.h"
+#include "engine/graphics/render_system.h"
+#include "engine/graphics/stream.h"
+#include "engine/graphics/internal/backend/renderer_backend.h"
+#include "engine/graphics/internal/backend/null/null_renderer.h"
+#include "engine/assets/assets.h"
+#include <string.h>
+
+static RenderSystem* make_headless(void) {
+    RenderSystemConfig config = { .window = NULL, .backend_type = "null", .width = 64, .height = 32 };
+    return render_system_create(&config);
+}
+
+static int test_instances(void) {
+    RenderSystem* a = make_headless();
+    RenderSystem* b = make_headless();
+    TEST_ASSERT(a != NULL && b != NULL);
+
+    // Each render system owns its backend, so destroying one leaves the other usable
+    RendererBackend* backend_a = render_system_get_backend(a);
+    TEST_ASSERT(backend_a != render_system_get_backend(b));
+    TEST_ASSERT_STR_EQ("null", backend_a->id);
+    render_system_destroy(b);
+
+    NullRendererStats stats;
+    TEST_ASSERT(null_renderer_get_stats(backend_a, &stats));
+    TEST_ASSERT(renderer_backend_create("no-such-backend") == NULL);
+
+    render_system_destroy(a);
+    return 1;
+}
+
+static int test_buffers(void) {
+    RenderSystem* rs = make_headless();
+    RendererBackend* backend = render_system_get_backend(rs);
+
+    float data[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    float back[4] = { 0 };
+    Stream* stream = stream_create(rs, STREAM_FLOAT, 4, 0);
+    TEST_ASSERT(stream != NULL);
+    TEST_ASSERT(stream_set_data(stream, data, 4));
+    TEST_ASSERT(stream_read_back(stream, back, 4));
+    TEST_ASSERT(memcmp(data, back, sizeof(data)) == 0);
+
+    // Mapped streams write straight into the CPU copy
+    Stream* mapped = stream_create_mapped(rs, STREAM_UINT, 2, 0);
+    TEST_ASSERT(mapped != NULL);
+    uint32_t* words = stream_get_mapped(mapped);
+    TEST_ASSERT(words != NULL);
+    words[1] = 42;
+    uint32_t read[2] = { 0 };
+    TEST_ASSERT(stream_read_back(mapped, read, 2));
+    TEST_ASSERT_INT_EQ(42, (int)read[1]);
+
+    NullRendererStats stats;
+    null_renderer_get_stats(backend, &stats);
+    TEST_ASSERT_INT_EQ(2, (int)stats.live_buffers);
+    TEST_ASSERT_INT_EQ((int)sizeof(data), (int)stats.bytes_uploaded);
+
+    stream_destroy(stream);
+    stream_destroy(mapped);
+    null_renderer_get_stats(backend, &stats);
+    TEST_ASSERT_INT_EQ(0, (int)stats.live_buffers);
+
+    render_system_destroy(rs);
+    return 1;
+}
+
+static int test_commands_counted(void) {
+    RenderSystem* rs = make_headless();
+    RendererBackend* backend = render_system_get_backend(rs);
+
+    RenderCommand commands[3];
+    memset(commands, 0, sizeof(commands));
+    commands[0].type = RENDER_CMD_BEGIN_PASS;
+    commands[1].type = RENDER_CMD_DRAW;
+    commands[1].draw.vertex_count = 6;
+    commands[1].draw.instance_count = 10;
+    commands[2].type = RENDER_CMD_END_PASS;
+    RenderCommandList list = { .commands = commands, .capacity = 3, .count = 3 };
+    backend->submit_commands(backend, &list);
+    backend->submit_commands(backend, &list);
+
+    uint32_t pipeline = backend->compute_pipeline_create(backend, "spv", 4, NULL, 0);
+    TEST_ASSERT(pipeline > 0);
+    backend->compute_dispatch(backend, pipeline, 8, 8, 1, NULL, 0);
+    backend->compute_pipeline_destroy(backend, pipeline);
+    render_system_resize(rs, 320, 200);
+
+    NullRendererStats stats;
+    null_renderer_get_stats(backend, &stats);
+    TEST_ASSERT_INT_EQ(2, (int)stats.frames);
+    TEST_ASSERT_INT_EQ(6, (int)stats.commands);
+    TEST_ASSERT_INT_EQ(2, (int)stats.command_counts[RENDER_CMD_DRAW]);
+    TEST_ASSERT_INT_EQ(20, (int)stats.instances);
+    TEST_ASSERT_INT_EQ(1, (int)stats.compute_dispatches);
+    TEST_ASSERT_INT_EQ(0, (int)stats.live_pipelines);
+    TEST_ASSERT_INT_EQ(320, (int)stats.width);
+
+    // The last frame is kept as a copy
+    const RenderCommandList* recorded = null_renderer_last_commands(backend);
+    TEST_ASSERT_INT_EQ(3, (int)recorded->count);
+    TEST_ASSERT_INT_EQ(10, (int)recorded->commands[1].draw.instance_count);
+
+    render_system_destroy(rs);
+    return 1;
+}
+
+static int s_begin_frame_calls = 0;
+
+static uint32_t fake_begin_frame(RendererBackend* backend) {
+    (void)backend;
+    s_begin_frame_calls++;
+    return 1; // A slot held back, e.g. by a failed present
+}
+
+static int test_frame_slots(void) {
+    RenderSystem* rs = make_headless();
+
+    // Without a begin_frame hook the slot follows the frame count
+    render_system_begin_frame(rs, 0.0);
+    uint32_t first = render_system_get_frame_slot(rs);
+    render_system_begin_frame(rs, 0.0);
+    TEST_ASSERT(first < RENDER_FRAMES_IN_FLIGHT);
+    TEST_ASSERT_INT_EQ((int)((first + 1) % RENDER_FRAMES_IN_FLIGHT), (int)render_system_get_frame_slot(rs));
+
+    // Once the backend is up, the slot is whatever its begin_frame waited on
+    Assets* assets = assets_create("null_backend_tests_assets"); // Missing dir: no shaders needed headless
+    render_system_bind_assets(rs, assets);
+    TEST_ASSERT(render_system_is_ready(rs));
+    render_system_get_backend(rs)->begin_frame = fake_begin_frame;
+    render_system_begin_frame(rs, 0.0);
+    render_system_begin_frame(rs, 0.0);
+    TEST_ASSERT_INT_EQ(2, s_begin_frame_calls);
+    TEST_ASSERT_INT_EQ(1, (int)render_system_get_frame_slot(rs));
+
+    render_system_destroy(rs);
+    assets_destroy(assets);
+    return 1;
+}
+
+int main(void) {
+    TEST_INIT("Null Backend");
+    TEST_RUN(test_instances);
+    TEST_RUN(test_buffers);
+    TEST_RUN(test_commands_counted);
+    TEST_RUN(test_frame_slots);
+    TEST_REPORT();
+}
@@ -0,0 +1,132 @@
+#include "test_framework.h"
+#include "foundation/profiler/profiler.h"
+#include "foundation/thread/thread.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WORKER_COUNT 4
+#define WORKER_SCOPES 100
+
+static void spin_us(uint32_t us) {
+    // Busy work the optimizer cannot drop, roughly 'us' long
+    volatile uint32_t sink = 0;
+    for (uint32_t i = 0; i < us * 200; ++i) sink += i;
+}
+
+static const ProfilerScopeStats* find_stats(const ProfilerScopeStats* stats, uint32_t count, const char* name) {
+    for (uint32_t i = 0; i < count; ++i) {
+        if (strcmp(stats[i].name, name) == 0) return &stats[i];
+    }
+    return NULL;
+}
+
+static int test_nested_scopes(void) {
+    TEST_ASSERT(profiler_init());
+
+    for (int frame = 0; frame < 10; ++frame) {
+        profiler_begin("outer");
+        for (int i = 0; i < 3; ++i) {
+            profiler_begin("inner");
+            spin_us(50);
+            profiler_end();
+        }
+        if (frame % 2 == 0) {
+            profiler_begin("even_frames");
+            profiler_end();
+        }
+        profiler_end();
+        profiler_frame_end();
+    }
+
+    ProfilerScopeStats stats[PROFILER_MAX_SCOPES];
+    uint32_t count = profiler_get_stats(stats, PROFILER_MAX_SCOPES);
+    TEST_ASSERT_INT_EQ(3, (int)count);
+
+    const ProfilerScopeStats* outer = find_stats(stats, count, "outer");
+    const ProfilerScopeStats* inner = find_stats(stats, count, "inner");
+    const ProfilerScopeStats* even = find_stats(stats, count, "even_frames");
+    TEST_ASSERT(outer && inner && even);
+
+    // Sorted by average, and a parent covers its children
+    TEST_ASSERT(stats[0].avg_ms >= stats[1].avg_ms && stats[1].avg_ms >= stats[2].avg_ms);
+    TEST_ASSERT(outer->avg_ms >= inner->avg_ms);
+    TEST_ASSERT_INT_EQ(0, (int)outer->depth);
+    TEST_ASSERT_INT_EQ(1, (int)inner->depth);
+
+    TEST_ASSERT_INT_EQ(10, (int)inner->frames);
+    TEST_ASSERT(inner->calls_per_frame == 3.0);
+    TEST_ASSERT_INT_EQ(5, (int)even->frames);
+    TEST_ASSERT(inner->min_ms <= inner->avg_ms && inner->avg_ms <= inner->p99_ms && inner->p99_ms <= inner->max_ms);
+    TEST_ASSERT(inner->p99_ms == inner->max_ms); // 10 samples: the 99th percentile is the largest
+
+    // Unbalanced end is ignored
+    profiler_end();
+    TEST_ASSERT_INT_EQ(0, (int)profiler_get_dropped_count());
+
+    profiler_shutdown();
+    TEST_ASSERT(!profiler_is_active());
+    TEST_ASSERT_INT_EQ(0, (int)profiler_get_stats(stats, PROFILER_MAX_SCOPES));
+    return 1;
+}
+
+static int worker_func(void* arg) {
+    (void)arg;
+    for (int i = 0; i < WORKER_SCOPES; ++i) {
+        profiler_begin("worker_job");
+        profiler_end();
+    }
+    return 0;
+}
+
+static int test_threads_and_trace(void) {
+    TEST_ASSERT(profiler_init());
+    TEST_ASSERT(profiler_capture_start(4096));
+
+    profiler_begin("frame");
+    Thread* threads[WORKER_COUNT];
+    for (int i = 0; i < WORKER_COUNT; ++i) threads[i] = thread_create(worker_func, NULL);
+    for (int i = 0; i < WORKER_COUNT; ++i) thread_join(threads[i]);
+    profiler_end();
+    profiler_frame_end();
+    profiler_capture_stop();
+
+    ProfilerScopeStats stats[PROFILER_MAX_SCOPES];
+    uint32_t count = profiler_get_stats(stats, PROFILER_MAX_SCOPES);
+    const ProfilerScopeStats* job = find_stats(stats, count, "worker_job");
+    TEST_ASSERT(job != NULL);
+    TEST_ASSERT(job->calls_per_frame == (double)(WORKER_COUNT * WORKER_SCOPES));
+
+    const char* path = "profiler_test_trace.json";
+    TEST_ASSERT(profiler_write_chrome_trace(path));
+
+    FILE* file = fopen(path, "rb");
+    TEST_ASSERT(file != NULL);
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char* text = malloc((size_t)size + 1);
+    TEST_ASSERT(text != NULL);
+    size_t read = fread(text, 1, (size_t)size, file);
+    text[read] = '\0';
+    fclose(file);
+    remove(path);
+
+    int events = 0;
+    for (const char* p = text; (p = strstr(p, "\"ph\":\"X\"")) != NULL; ++p) events++;
+    TEST_ASSERT_INT_EQ(WORKER_COUNT * WORKER_SCOPES + 1, events);
+    TEST_ASSERT(strstr(text, "\"traceEvents\"") != NULL);
+    TEST_ASSERT(strstr(text, "\"thread_name\"") != NULL);
+    TEST_ASSERT(strstr(text, "\"tid\":4") != NULL); // Main thread + 4 workers
+    free(text);
+
+    profiler_shutdown();
+    return 1;
+}
+
+int main(void) {
+    TEST_INIT("Profiler");
+    TEST_RUN(test_nested_scopes);
+    TEST_RUN(test_threads_and_trace);
+    TEST_REPORT();
+}
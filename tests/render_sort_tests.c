@@ -0,0 +1,260 @@
+#include "test_framework.h"
+#include "engine/graphics/render_sort.h"
+#include "engine/scene/render_packet.h"
+#include "engine/graphics/render_system.h"
+#include "engine/graphics/primitive_batcher.h"
+#include <stdio.h>
+#include <string.h>
+
+// Fake streams: only their addresses take part in the bindings hash
+static int g_stream_a;
+static int g_stream_b;
+
+static RenderBatch make_batch(uint32_t pipeline, uint32_t layer, void* binding, float depth, StringId draw_list) {
+    RenderBatch batch = {0};
+    batch.pipeline_id = pipeline;
+    batch.layer_id = layer;
+    batch.sort_key = depth;
+    if (binding) {
+        batch.bind_buffers[0] = (Stream*)binding;
+        batch.bind_slots[0] = 0;
+        batch.bind_count = 1;
+    }
+    batch.draw_list_id = draw_list;
+    return batch;
+}
+
+// Executed order has no state bounce: each pipeline/binding pair forms one run
+static int count_state_changes(const RenderBatch* batches, const uint32_t* order, size_t count) {
+    int changes = 0;
+    for (size_t i = 1; i < count; ++i) {
+        const RenderBatch* a = &batches[order[i - 1]];
+        const RenderBatch* b = &batches[order[i]];
+        if (a->pipeline_id != b->pipeline_id || a->bind_buffers[0] != b->bind_buffers[0]) changes++;
+    }
+    return changes;
+}
+
+static int test_key_fields(void) {
+    RenderBatch base = make_batch(1, 0, &g_stream_a, 0.0f, 0);
+    RenderBatch higher_layer = make_batch(0, 1, NULL, -100.0f, 0);
+    RenderBatch other_pipeline = make_batch(2, 0, &g_stream_a, 0.0f, 0);
+    RenderBatch nearer = make_batch(1, 0, &g_stream_a, -1.0f, 0);
+    RenderBatch farther = make_batch(1, 0, &g_stream_a, 5.0f, 0);
+
+    // Pass dominates everything, then layer, then pipeline
+    TEST_ASSERT(render_sort_key(&higher_layer, 0) < render_sort_key(&base, 1));
+    TEST_ASSERT(render_sort_key(&base, 0) < render_sort_key(&higher_layer, 0));
+    TEST_ASSERT(render_sort_key(&base, 0) < render_sort_key(&other_pipeline, 0));
+
+    // Depth is order-preserving for negative and positive values
+    TEST_ASSERT(render_sort_key(&nearer, 0) < render_sort_key(&base, 0));
+    TEST_ASSERT(render_sort_key(&base, 0) < render_sort_key(&farther, 0));
+    return 1;
+}
+
+static int test_groups_states(void) {
+    // Interleaved states in push order
+    RenderBatch batches[6] = {
+        make_batch(1, 0, &g_stream_a, 0.0f, 1),
+        make_batch(2, 0, &g_stream_b, 0.0f, 1),
+        make_batch(1, 0, &g_stream_b, 0.0f, 2),
+        make_batch(1, 0, &g_stream_a, 0.0f, 1),
+        make_batch(2, 0, &g_stream_b, 0.0f, 1),
+        make_batch(1, 0, &g_stream_b, 0.0f, 1),
+    };
+    uint32_t order[6];
+    render_sort_batches(batches, 6, 0, order);
+    TEST_ASSERT_INT_EQ(5, count_state_changes(batches, (uint32_t[]){0, 1, 2, 3, 4, 5}, 6));
+    TEST_ASSERT_INT_EQ(2, count_state_changes(batches, order, 6));
+    return 1;
+}
+
+static int test_radix_stable(void) {
+    // Enough keys for the radix path; only the high byte and low bits vary
+    enum { COUNT = 1000 };
+    static RenderSortKey keys[COUNT];
+    static uint32_t order[COUNT];
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        uint64_t group = (i * 7u) % 5u;
+        keys[i] = (group << 56) | ((i * 13u) % 3u);
+    }
+    render_sort_indices(keys, COUNT, order);
+
+    for (uint32_t i = 1; i < COUNT; ++i) {
+        RenderSortKey prev = keys[order[i - 1]];
+        RenderSortKey cur = keys[order[i]];
+        TEST_ASSERT(prev <= cur);
+        if (prev == cur) TEST_ASSERT(order[i - 1] < order[i]); // Push order kept
+    }
+
+    // Every index appears exactly once
+    static uint8_t seen[COUNT];
+    memset(seen, 0, sizeof(seen));
+    for (uint32_t i = 0; i < COUNT; ++i) seen[order[i]]++;
+    for (uint32_t i = 0; i < COUNT; ++i) TEST_ASSERT_INT_EQ(1, seen[i]);
+    return 1;
+}
+
+static int test_draw_list_buckets(void) {
+    Scene* scene = scene_create();
+    TEST_ASSERT(scene != NULL);
+
+    StringId ui = STR_ID("UIBatches");
+    StringId world = STR_ID("SceneBatches");
+
+    // Interleaved pushes, enough to grow a bucket past its first block
+    for (uint32_t i = 0; i < 200; ++i) {
+        scene_push_render_batch(scene, make_batch(i, 0, NULL, 0.0f, (i % 3 == 0) ? world : ui));
+    }
+
+    size_t ui_count = 0, world_count = 0;
+    const RenderBatch* ui_batches = scene_get_draw_list(scene, ui, &ui_count);
+    const RenderBatch* world_batches = scene_get_draw_list(scene, world, &world_count);
+    TEST_ASSERT_INT_EQ(133, (int)ui_count);
+    TEST_ASSERT_INT_EQ(67, (int)world_count);
+
+    // Buckets keep push order
+    TEST_ASSERT_INT_EQ(0, (int)world_batches[0].pipeline_id);
+    TEST_ASSERT_INT_EQ(3, (int)world_batches[1].pipeline_id);
+    TEST_ASSERT_INT_EQ(1, (int)ui_batches[0].pipeline_id);
+    TEST_ASSERT_INT_EQ(199, (int)ui_batches[132].pipeline_id);
+
+    size_t missing = 1;
+    TEST_ASSERT(scene_get_draw_list(scene, STR_ID("Unknown"), &missing) == NULL);
+    TEST_ASSERT_INT_EQ(0, (int)missing);
+
+    // Iteration sees lists in first-push order
+    StringId id = 0;
+    TEST_ASSERT_INT_EQ(2, (int)scene_get_draw_list_count(scene));
+    scene_get_draw_list_at(scene, 0, &id, NULL);
+    TEST_ASSERT(id == world);
+
+    scene_clear(scene);
+    TEST_ASSERT_INT_EQ(0, (int)scene_get_draw_list_count(scene));
+    TEST_ASSERT(scene_get_draw_list(scene, ui, &ui_count) == NULL);
+
+    // The list table grows past its first block instead of dropping batches
+    for (uint32_t i = 0; i < 40; ++i) {
+        scene_push_render_batch(scene, make_batch(i, 0, NULL, 0.0f, (StringId)(1000 + i)));
+    }
+    TEST_ASSERT_INT_EQ(40, (int)scene_get_draw_list_count(scene));
+    for (uint32_t i = 0; i < 40; ++i) {
+        size_t count = 0;
+        const RenderBatch* batches = scene_get_draw_list(scene, (StringId)(1000 + i), &count);
+        TEST_ASSERT_INT_EQ(1, (int)count);
+        TEST_ASSERT_INT_EQ((int)i, (int)batches[0].pipeline_id);
+    }
+
+    scene_destroy(scene);
+    return 1;
+}
+
+static int test_batch_merging(void) {
+    // Glyph-like runs: same state, instance ranges written back to back
+    RenderBatch batches[5];
+    for (int i = 0; i < 5; ++i) {
+        batches[i] = make_batch(1, 0, &g_stream_a, 0.0f, 1);
+        batches[i].index_count = 6;
+        batches[i].first_instance = (uint32_t)i * 10;
+        batches[i].instance_count = 10;
+    }
+    batches[3].first_instance = 100; // Gap breaks the run
+    batches[4].first_instance = 110;
+
+    RenderBatch merged[5];
+    size_t draws = render_batch_merge(batches, NULL, 5, merged);
+    TEST_ASSERT_INT_EQ(2, (int)draws);
+    TEST_ASSERT_INT_EQ(0, (int)merged[0].first_instance);
+    TEST_ASSERT_INT_EQ(30, (int)merged[0].instance_count);
+    TEST_ASSERT_INT_EQ(100, (int)merged[1].first_instance);
+    TEST_ASSERT_INT_EQ(20, (int)merged[1].instance_count);
+
+    // Any state difference keeps batches apart
+    RenderBatch other = batches[1];
+    other.bind_buffers[0] = (Stream*)&g_stream_b;
+    TEST_ASSERT(render_batch_can_merge(&batches[0], &batches[1]));
+    TEST_ASSERT(!render_batch_can_merge(&batches[0], &other));
+    other = batches[1];
+    other.pipeline_id = 2;
+    TEST_ASSERT(!render_batch_can_merge(&batches[0], &other));
+    other = batches[1];
+    other.index_count = 3;
+    TEST_ASSERT(!render_batch_can_merge(&batches[0], &other));
+
+    // Merging after a sort: interleaved pushes still collapse to one draw per state
+    RenderBatch mixed[4] = { batches[0], make_batch(2, 0, &g_stream_b, 0.0f, 1), batches[1], batches[2] };
+    uint32_t order[4];
+    render_sort_batches(mixed, 4, 0, order);
+    TEST_ASSERT_INT_EQ(2, (int)render_batch_merge(mixed, order, 4, merged));
+    return 1;
+}
+
+static int test_scene_capacity_grows(void) {
+    Scene* scene = scene_create();
+    TEST_ASSERT(scene != NULL);
+
+    // Past the initial UiNode and batch block sizes: nothing is dropped
+    const size_t node_target = 20000;
+    for (size_t i = 0; i < node_target; ++i) {
+        scene_push_quad(scene, (Vec3){(float)i, 0.0f, 0.0f}, (Vec2){1.0f, 1.0f}, (Vec4){1, 1, 1, 1}, (Vec4){0, 0, 1e6f, 1e6f});
+    }
+    for (uint32_t i = 0; i < 5000; ++i) {
+        scene_push_render_batch(scene, make_batch(1, 0, NULL, 0.0f, 1));
+    }
+
+    size_t node_count = 0, batch_count = 0;
+    const UiNode* nodes = scene_get_ui_nodes(scene, &node_count);
+    scene_get_draw_list(scene, 1, &batch_count);
+    TEST_ASSERT_INT_EQ((int)node_target, (int)node_count);
+    TEST_ASSERT_INT_EQ(5000, (int)batch_count);
+    TEST_ASSERT_FLOAT_EQ(19999.0f, nodes[node_target - 1].rect.x, 0.0f);
+
+    scene_destroy(scene);
+    return 1;
+}
+
+// The math editor's wires come from the primitive batcher and must draw over its node
+// quads, even though the wire pipeline is created first (lower pipeline id)
+static int test_wires_over_nodes(void) {
+    RenderSystemConfig config = { .window = NULL, .backend_type = "null", .width = 64, .height = 64 };
+    RenderSystem* rs = render_system_create(&config);
+    TEST_ASSERT(rs != NULL);
+    Scene* scene = scene_create();
+    StringId list = STR_ID("SceneBatches");
+
+    RenderBatch nodes = make_batch(2, RENDER_LAYER_WORLD, &g_stream_a, 0.0f, list);
+    scene_push_render_batch(scene, nodes);
+
+    PrimitiveBatcher* wires = primitive_batcher_create(rs);
+    primitive_batcher_set_pipeline(wires, 1);
+    primitive_batcher_set_tag(wires, "SceneBatches");
+    primitive_batcher_begin(wires);
+    primitive_batcher_push_line(wires, (Vec3){0, 0, -5.0f}, (Vec3){10, 10, -5.0f}, (Vec4){1, 1, 1, 1}, 2.0f);
+    primitive_batcher_end(wires, scene);
+
+    size_t count = 0;
+    const RenderBatch* batches = scene_get_draw_list(scene, list, &count);
+    TEST_ASSERT_INT_EQ(2, (int)count);
+    uint32_t order[2];
+    render_sort_batches(batches, count, 0, order);
+    TEST_ASSERT_INT_EQ(2, (int)batches[order[0]].pipeline_id);
+    TEST_ASSERT_INT_EQ(1, (int)batches[order[1]].pipeline_id);
+
+    primitive_batcher_destroy(wires);
+    scene_destroy(scene);
+    render_system_destroy(rs);
+    return 1;
+}
+
+int main(void) {
+    TEST_INIT("Render Batch Sorting & Merging");
+    TEST_RUN(test_key_fields);
+    TEST_RUN(test_groups_states);
+    TEST_RUN(test_radix_stable);
+    TEST_RUN(test_draw_list_buckets);
+    TEST_RUN(test_batch_merging);
+    TEST_RUN(test_scene_capacity_grows);
+    TEST_RUN(test_wires_over_nodes);
+    TEST_REPORT();
+}
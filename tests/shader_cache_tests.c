@@ -0,0 +1,323 @@
+#include "test_framework.h"
+#include "engine/graphics/shader_cache.h"
+#include "foundation/platform/fs.h"
+#include "foundation/thread/thread.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Fake Compiler ---
+// Emits a SPIR-V header followed by the source length. "#error" fails the compile
+// with one diagnostic, and 'gate' holds the workers until the test releases it.
+
+typedef struct FakeCompiler {
+    atomic_int calls;
+    atomic_bool gate;
+    atomic_int active;     // Compiles currently inside the compiler
+    atomic_int max_active;
+    char last_source[256]; // Only written by single-worker caches
+} FakeCompiler;
+
+static bool emit_spirv(size_t size, void** out_spv, size_t* out_spv_size) {
+    uint32_t* words = malloc(6 * sizeof(uint32_t));
+    if (!words) return false;
+    words[0] = 0x07230203u;
+    words[1] = 0x00010000u;
+    words[2] = words[3] = words[4] = 0;
+    words[5] = (uint32_t)size;
+    *out_spv = words;
+    *out_spv_size = 6 * sizeof(uint32_t);
+    return true;
+}
+
+static void hold_at_gate(FakeCompiler* fc) {
+    int active = atomic_fetch_add(&fc->active, 1) + 1;
+    int seen = atomic_load(&fc->max_active);
+    while (active > seen && !atomic_compare_exchange_weak(&fc->max_active, &seen, active)) {}
+    while (atomic_load(&fc->gate)) thread_sleep(1);
+    atomic_fetch_sub(&fc->active, 1);
+    atomic_fetch_add(&fc->calls, 1);
+}
+
+static bool fake_compile(void* user, const char* source, size_t size, const char* stage,
+                         void** out_spv, size_t* out_spv_size, ShaderDiagnostics* diagnostics) {
+    (void)stage;
+    FakeCompiler* fc = (FakeCompiler*)user;
+    hold_at_gate(fc);
+
+    size_t n = size < sizeof(fc->last_source) - 1 ? size : sizeof(fc->last_source) - 1;
+    memcpy(fc->last_source, source, n);
+    fc->last_source[n] = '\0';
+    if (strstr(fc->last_source, "#error")) {
+        shader_diagnostics_parse("compute:2: error: '#error' : broken\n1 error generated.\n", diagnostics);
+        return false;
+    }
+    return emit_spirv(size, out_spv, out_spv_size);
+}
+
+// Same, minus the shared last_source, for caches with several workers
+static bool parallel_compile(void* user, const char* source, size_t size, const char* stage,
+                             void** out_spv, size_t* out_spv_size, ShaderDiagnostics* diagnostics) {
+    (void)source; (void)stage; (void)diagnostics;
+    hold_at_gate((FakeCompiler*)user);
+    return emit_spirv(size, out_spv, out_spv_size);
+}
+
+static ShaderCache* make_cache(FakeCompiler* fc, const char* directory) {
+    memset(fc, 0, sizeof(*fc));
+    ShaderCacheConfig config = { .directory = directory, .compile = fake_compile, .user = fc };
+    return shader_cache_create(&config);
+}
+
+static const char* SOURCE_A = "#version 450\nvoid main() {}\n";
+static const char* SOURCE_B = "#version 450\nvoid main() { }\n";
+
+static int test_memory_hits(void) {
+    FakeCompiler fc;
+    ShaderCache* cache = make_cache(&fc, NULL);
+    TEST_ASSERT(cache != NULL);
+
+    uint64_t key_a = 0, key_b = 0, again = 0;
+    shader_cache_request(cache, SOURCE_A, strlen(SOURCE_A), "compute", NULL, &key_a);
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_wait(cache, key_a));
+    shader_cache_request(cache, SOURCE_B, strlen(SOURCE_B), "compute", NULL, &key_b);
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_wait(cache, key_b));
+    TEST_ASSERT(key_a != key_b);
+    TEST_ASSERT_INT_EQ(2, atomic_load(&fc.calls));
+
+    // Going back to an earlier source resolves without the compiler
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_request(cache, SOURCE_A, strlen(SOURCE_A), "compute", NULL, &again));
+    TEST_ASSERT(again == key_a);
+    TEST_ASSERT_INT_EQ(2, atomic_load(&fc.calls));
+
+    const void* spv = NULL;
+    size_t spv_size = 0;
+    TEST_ASSERT(shader_cache_get(cache, key_a, &spv, &spv_size));
+    TEST_ASSERT_INT_EQ(24, (int)spv_size);
+    TEST_ASSERT_INT_EQ((int)strlen(SOURCE_A), (int)((const uint32_t*)spv)[5]);
+    shader_cache_release(cache, key_a);
+
+    ShaderCacheStats stats = shader_cache_get_stats(cache);
+    TEST_ASSERT_INT_EQ(1, (int)stats.memory_hits);
+    TEST_ASSERT_INT_EQ(2, (int)stats.compiles);
+
+    shader_cache_destroy(cache);
+    return 1;
+}
+
+static int test_key_inputs(void) {
+    FakeCompiler fc;
+    ShaderCache* cache = make_cache(&fc, NULL);
+
+    uint64_t plain = shader_cache_key(SOURCE_A, strlen(SOURCE_A), "compute", NULL);
+    TEST_ASSERT(plain == shader_cache_key(SOURCE_A, strlen(SOURCE_A), "compute", ""));
+    TEST_ASSERT(plain != shader_cache_key(SOURCE_A, strlen(SOURCE_A), "fragment", NULL));
+    TEST_ASSERT(plain != shader_cache_key(SOURCE_A, strlen(SOURCE_A), "compute", "#define FOO 1"));
+
+    // Defines land right after #version
+    uint64_t key = 0;
+    shader_cache_request(cache, SOURCE_A, strlen(SOURCE_A), "compute", "#define FOO 1", &key);
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_wait(cache, key));
+    TEST_ASSERT_STR_EQ("#version 450\n#define FOO 1\nvoid main() {}\n", fc.last_source);
+
+    shader_cache_destroy(cache);
+    return 1;
+}
+
+static int test_pending_and_failure(void) {
+    FakeCompiler fc;
+    ShaderCache* cache = make_cache(&fc, NULL);
+
+    // The request returns while the compiler is still busy
+    atomic_store(&fc.gate, true);
+    uint64_t key = 0;
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_PENDING, shader_cache_request(cache, SOURCE_A, strlen(SOURCE_A), "compute", NULL, &key));
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_PENDING, shader_cache_poll(cache, key));
+    TEST_ASSERT(!shader_cache_get(cache, key, NULL, NULL));
+    atomic_store(&fc.gate, false);
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_wait(cache, key));
+
+    // A broken source fails once and is not recompiled
+    const char* broken = "#version 450\n#error broken\n";
+    uint64_t bad = 0;
+    shader_cache_request(cache, broken, strlen(broken), "compute", NULL, &bad);
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_FAILED, shader_cache_wait(cache, bad));
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_FAILED, shader_cache_request(cache, broken, strlen(broken), "compute", NULL, &bad));
+    TEST_ASSERT_INT_EQ(2, atomic_load(&fc.calls));
+    TEST_ASSERT_INT_EQ(1, (int)shader_cache_get_stats(cache).failures);
+
+    // The compiler's messages stay with the failed entry; clean compiles have none
+    ShaderDiagnostics diagnostics;
+    TEST_ASSERT(shader_cache_get_diagnostics(cache, bad, &diagnostics));
+    TEST_ASSERT_INT_EQ(1, (int)diagnostics.error_count);
+    TEST_ASSERT_INT_EQ(2, (int)diagnostics.items[0].line);
+    TEST_ASSERT(!shader_cache_get_diagnostics(cache, key, &diagnostics));
+
+    shader_cache_destroy(cache);
+    return 1;
+}
+
+// Deletes the files a test cache wrote, then the directory itself
+static void remove_cache_dir(const char* dir) {
+    PlatformDir* handle = platform_dir_open(dir);
+    if (handle) {
+        PlatformDirEntry entry;
+        char path[256];
+        while (platform_dir_read(handle, &entry)) {
+            if (entry.is_dir) continue;
+            snprintf(path, sizeof(path), "%s/%s", dir, entry.name);
+            platform_remove_file(path);
+        }
+        platform_dir_close(handle);
+    }
+    platform_remove_dir(dir);
+}
+
+static int test_eviction(void) {
+    FakeCompiler fc;
+    memset(&fc, 0, sizeof(fc));
+    ShaderCacheConfig config = { .compile = fake_compile, .user = &fc, .max_entries = 2 };
+    ShaderCache* cache = shader_cache_create(&config);
+    TEST_ASSERT(cache != NULL);
+
+    const char* source_c = "#version 450\nvoid main() {  }\n";
+    uint64_t key_a = 0, key_b = 0, key_c = 0;
+    shader_cache_request(cache, SOURCE_A, strlen(SOURCE_A), "compute", NULL, &key_a);
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_wait(cache, key_a));
+    const void* spv = NULL;
+    TEST_ASSERT(shader_cache_get(cache, key_a, &spv, NULL));
+    shader_cache_request(cache, SOURCE_B, strlen(SOURCE_B), "compute", NULL, &key_b);
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_wait(cache, key_b));
+
+    // A is older but borrowed, so B makes room
+    shader_cache_request(cache, source_c, strlen(source_c), "compute", NULL, &key_c);
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_wait(cache, key_c));
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_FAILED, shader_cache_poll(cache, key_b));
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_poll(cache, key_a));
+    TEST_ASSERT_INT_EQ((int)strlen(SOURCE_A), (int)((const uint32_t*)spv)[5]);
+    TEST_ASSERT_INT_EQ(1, (int)shader_cache_get_stats(cache).evictions);
+
+    // Once released, A goes next and an evicted source recompiles
+    shader_cache_release(cache, key_a);
+    shader_cache_poll(cache, key_c);
+    shader_cache_request(cache, SOURCE_B, strlen(SOURCE_B), "compute", NULL, &key_b);
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_wait(cache, key_b));
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_FAILED, shader_cache_poll(cache, key_a));
+    TEST_ASSERT_INT_EQ(4, atomic_load(&fc.calls));
+    shader_cache_destroy(cache);
+
+    // Enough sources to grow the table and remove from the middle of probe chains
+    memset(&fc, 0, sizeof(fc));
+    config.max_entries = 40;
+    cache = shader_cache_create(&config);
+    uint64_t keys[100];
+    char defines[32];
+    for (int i = 0; i < 100; ++i) {
+        snprintf(defines, sizeof(defines), "#define N %d", i);
+        shader_cache_request(cache, SOURCE_A, strlen(SOURCE_A), "compute", defines, &keys[i]);
+        TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_wait(cache, keys[i]));
+    }
+    for (int i = 0; i < 100; ++i) {
+        TEST_ASSERT_INT_EQ(i < 60 ? SHADER_CACHE_FAILED : SHADER_CACHE_READY, shader_cache_poll(cache, keys[i]));
+    }
+    TEST_ASSERT_INT_EQ(60, (int)shader_cache_get_stats(cache).evictions);
+    shader_cache_destroy(cache);
+    return 1;
+}
+
+static int test_disk_persistence(void) {
+    const char* dir = "shader_cache_test";
+    remove_cache_dir(dir); // Leftovers from an aborted run
+    FakeCompiler fc;
+    ShaderCache* cache = make_cache(&fc, dir);
+    uint64_t key = 0;
+    shader_cache_request(cache, SOURCE_A, strlen(SOURCE_A), "compute", NULL, &key);
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_wait(cache, key));
+    shader_cache_destroy(cache);
+
+    // A new cache (next run) finds the SPIR-V on disk
+    cache = make_cache(&fc, dir);
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_request(cache, SOURCE_A, strlen(SOURCE_A), "compute", NULL, &key));
+    TEST_ASSERT_INT_EQ(0, atomic_load(&fc.calls));
+    TEST_ASSERT_INT_EQ(1, (int)shader_cache_get_stats(cache).disk_hits);
+    shader_cache_destroy(cache);
+
+    // A corrupt file is a miss, not a hit
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%016llx.spv", dir, (unsigned long long)key);
+    TEST_ASSERT(fs_write_bin(path, "garbage", 7));
+    cache = make_cache(&fc, dir);
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_PENDING, shader_cache_request(cache, SOURCE_A, strlen(SOURCE_A), "compute", NULL, &key));
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_wait(cache, key));
+    TEST_ASSERT_INT_EQ(1, atomic_load(&fc.calls));
+    shader_cache_destroy(cache);
+
+    remove_cache_dir(dir);
+    return 1;
+}
+
+static int test_parallel_workers(void) {
+    FakeCompiler fc;
+    memset(&fc, 0, sizeof(fc));
+    ShaderCacheConfig config = { .compile = parallel_compile, .user = &fc, .worker_count = 2 };
+    ShaderCache* cache = shader_cache_create(&config);
+    TEST_ASSERT(cache != NULL);
+
+    // Both compiles reach the compiler before either finishes
+    atomic_store(&fc.gate, true);
+    uint64_t key_a = 0, key_b = 0;
+    shader_cache_request(cache, SOURCE_A, strlen(SOURCE_A), "compute", NULL, &key_a);
+    shader_cache_request(cache, SOURCE_B, strlen(SOURCE_B), "compute", NULL, &key_b);
+    for (int i = 0; i < 2000 && atomic_load(&fc.active) < 2; ++i) thread_sleep(1);
+    atomic_store(&fc.gate, false);
+
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_wait(cache, key_a));
+    TEST_ASSERT_INT_EQ(SHADER_CACHE_READY, shader_cache_wait(cache, key_b));
+    TEST_ASSERT_INT_EQ(2, atomic_load(&fc.max_active));
+
+    shader_cache_destroy(cache);
+    return 1;
+}
+
+static int test_diagnostics_parse(void) {
+    const char* log =
+        "graph.comp:12: error: 'x' : undeclared identifier\r\n"
+        "graph.comp:3: warning: unused variable\n"
+        "1 error generated.\n"
+        "ERROR: 0:7: 'foo' : syntax error\n"
+        "ERROR: 1 compilation errors.  No code generated.\n";
+    ShaderDiagnostics d;
+    memset(&d, 0, sizeof(d));
+    shader_diagnostics_parse(log, &d);
+
+    TEST_ASSERT_INT_EQ(2, (int)d.error_count);
+    TEST_ASSERT_INT_EQ(1, (int)d.warning_count);
+    TEST_ASSERT_INT_EQ(3, (int)d.count);
+    TEST_ASSERT_INT_EQ(12, (int)d.items[0].line);
+    TEST_ASSERT_STR_EQ("'x' : undeclared identifier", d.items[0].message);
+    TEST_ASSERT(!d.items[1].is_error);
+    TEST_ASSERT_INT_EQ(3, (int)d.items[1].line);
+    TEST_ASSERT_INT_EQ(7, (int)d.items[2].line);
+    TEST_ASSERT_STR_EQ("'foo' : syntax error", d.items[2].message);
+
+    // Past the array only the counts grow
+    for (int i = 0; i < SHADER_MAX_DIAGNOSTICS; ++i) shader_diagnostics_parse("s:1: warning: w", &d);
+    TEST_ASSERT_INT_EQ(SHADER_MAX_DIAGNOSTICS, (int)d.count);
+    TEST_ASSERT_INT_EQ(1 + SHADER_MAX_DIAGNOSTICS, (int)d.warning_count);
+    TEST_ASSERT(shader_diagnostics_first_error(&d) == &d.items[0]);
+    return 1;
+}
+
+int main(void) {
+    TEST_INIT("Shader Cache");
+    TEST_RUN(test_memory_hits);
+    TEST_RUN(test_key_inputs);
+    TEST_RUN(test_pending_and_failure);
+    TEST_RUN(test_eviction);
+    TEST_RUN(test_disk_persistence);
+    TEST_RUN(test_parallel_workers);
+    TEST_RUN(test_diagnostics_parse);
+    TEST_REPORT();
+}
@@ -1,6 +1,14 @@
 #include "test_framework.h"
 #include "foundation/string/string_id.h"
+#include "foundation/thread/thread.h"
 #include <string.h>
+#include <time.h>
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
 
 int test_string_id_hash(void) {
     StringId id1 = str_id("test_string");
@@ -31,11 +39,121 @@ int test_string_id_lookup(void) {
     return 1;
 }
 
+int test_string_id_literal(void) {
+    // Folded hash must match the runtime hash, including the empty string
+    StringId empty = STR_ID("");
+    StringId single = STR_ID("a");
+    StringId name = STR_ID("canvas_area");
+    StringId pure = STR_ID_HASH("ToggleCompute");
+    ASSERT_TRUE(empty == str_id(""));
+    ASSERT_TRUE(single == str_id("a"));
+    ASSERT_TRUE(name == str_id("canvas_area"));
+    ASSERT_TRUE(pure == str_id("ToggleCompute"));
+
+    // Exactly at the fold limit, and past it (runtime fallback)
+    const char* exact = "0123456789abcdef0123456789abcdef";
+    const char* longer = "0123456789abcdef0123456789abcdef!";
+    ASSERT_EQ_INT(STR_ID_MAX_LITERAL, strlen(exact));
+    StringId exact_id = STR_ID("0123456789abcdef0123456789abcdef");
+    StringId longer_id = STR_ID("0123456789abcdef0123456789abcdef!");
+    ASSERT_TRUE(exact_id == str_id(exact));
+    ASSERT_TRUE(longer_id == str_id(longer));
+
+#ifndef NDEBUG
+    StringId literal_only = STR_ID("literal_only_id");
+    ASSERT_STR_EQ("literal_only_id", str_id_lookup(literal_only));
+#endif
+    return 1;
+}
+
+#ifndef NDEBUG
+#define REGISTRY_THREADS 4
+#define REGISTRY_NAMES 2000
+
+static int register_names(void* arg) {
+    (void)arg;
+    char name[32];
+    for (int i = 0; i < REGISTRY_NAMES; ++i) {
+        snprintf(name, sizeof(name), "concurrent_%d", i);
+        str_id(name);
+    }
+    return 0;
+}
+#endif
+
+int test_string_id_registry_concurrent(void) {
+#ifndef NDEBUG
+    // All threads register the same names; every name must resolve exactly once
+    Thread* threads[REGISTRY_THREADS];
+    for (int t = 0; t < REGISTRY_THREADS; ++t) {
+        threads[t] = thread_create(register_names, NULL);
+        ASSERT_TRUE(threads[t] != NULL);
+    }
+    for (int t = 0; t < REGISTRY_THREADS; ++t) {
+        thread_join(threads[t]);
+    }
+
+    char name[32];
+    for (int i = 0; i < REGISTRY_NAMES; ++i) {
+        snprintf(name, sizeof(name), "concurrent_%d", i);
+        ASSERT_STR_EQ(name, str_id_lookup(str_id(name)));
+    }
+#endif
+    return 1;
+}
+
+// Microbenchmark: find an id in a table the way scene/input lookups do,
+// hashing the key per query vs. using a folded STR_ID constant.
+#define BENCH_TABLE 64
+#define BENCH_QUERIES 2000000
+
+int test_string_id_bench(void) {
+    char names[BENCH_TABLE][24];
+    StringId table[BENCH_TABLE];
+    for (int i = 0; i < BENCH_TABLE; ++i) {
+        snprintf(names[i], sizeof(names[i]), "node_%d", i);
+        table[i] = str_id(names[i]);
+    }
+    table[BENCH_TABLE - 1] = str_id("inspector_area");
+
+    // volatile keeps the compiler from hoisting the hash out of the loop
+    const char* volatile query = "inspector_area";
+    uint32_t hits_runtime = 0;
+    double start = now_seconds();
+    for (int q = 0; q < BENCH_QUERIES; ++q) {
+        StringId id = str_id(query);
+        for (int i = BENCH_TABLE - 4; i < BENCH_TABLE; ++i) {
+            if (table[i] == id) { hits_runtime++; break; }
+        }
+    }
+    double runtime_time = now_seconds() - start;
+
+    uint32_t hits_const = 0;
+    start = now_seconds();
+    for (int q = 0; q < BENCH_QUERIES; ++q) {
+        StringId id = STR_ID_HASH("inspector_area");
+        for (int i = BENCH_TABLE - 4; i < BENCH_TABLE; ++i) {
+            if (table[i] == id) { hits_const++; break; }
+        }
+    }
+    double const_time = now_seconds() - start;
+
+    printf("  %d lookups: str_id=%.2fms STR_ID=%.2fms\n",
+           BENCH_QUERIES, runtime_time * 1000.0, const_time * 1000.0);
+
+    ASSERT_EQ_INT(BENCH_QUERIES, hits_runtime);
+    ASSERT_EQ_INT(BENCH_QUERIES, hits_const);
+    return 1;
+}
+
 int main(void) {
     TEST_INIT("Foundation String");
     
     TEST_RUN(test_string_id_hash);
     TEST_RUN(test_string_id_lookup);
+    TEST_RUN(test_string_id_literal);
+    TEST_RUN(test_string_id_registry_concurrent);
+    TEST_RUN(test_string_id_bench);
     
     TEST_REPORT();
     return 0;
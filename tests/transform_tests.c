@@ -4,6 +4,8 @@
 #include "test_framework.h"
 
 #include "foundation/math/coordinate_systems.h"
+#include "engine/scene/scene.h"
+#include "engine/scene/internal/scene_tree_internal.h"
 
 static int test_coordinate_round_trip(void) {
     CoordinateSystem2D system;
@@ -64,10 +66,200 @@ static int test_3d_projection(void) {
     return 1;
 }
 
+// --- SIMD vs Scalar ---
+
+static unsigned int g_rng = 12345u;
+static float rand_range(float lo, float hi) {
+    g_rng = g_rng * 1664525u + 1013904223u;
+    return lo + (hi - lo) * (float)(g_rng >> 8) / (float)(1u << 24);
+}
+
+static Mat4 random_trs(void) {
+    Vec3 t = {rand_range(-100.0f, 100.0f), rand_range(-100.0f, 100.0f), rand_range(-100.0f, 100.0f)};
+    EulerAngles e = {rand_range(-3.0f, 3.0f), rand_range(-3.0f, 3.0f), rand_range(-3.0f, 3.0f)};
+    Vec3 s = {rand_range(0.1f, 4.0f), rand_range(0.1f, 4.0f), rand_range(0.1f, 4.0f)};
+    return mat4_compose(t, quat_from_euler(e), s);
+}
+
+static int mat4_near(const Mat4* a, const Mat4* b, float rel_eps) {
+    for (int i = 0; i < 16; ++i) {
+        float scale = fmaxf(1.0f, fmaxf(fabsf(a->m[i]), fabsf(b->m[i])));
+        if (fabsf(a->m[i] - b->m[i]) > rel_eps * scale) {
+            fprintf(stderr, "  m[%d]: %f vs %f\n", i, a->m[i], b->m[i]);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int test_simd_matches_scalar(void) {
+    printf("  Math backend: %s\n", math_simd_backend());
+
+    for (int iter = 0; iter < 256; ++iter) {
+        Mat4 a = random_trs();
+        Mat4 b = random_trs();
+
+        Mat4 mul = mat4_multiply(&a, &b);
+        Mat4 mul_ref = mat4_multiply_scalar(&a, &b);
+        TEST_ASSERT(mat4_near(&mul, &mul_ref, 1e-6f));
+
+        // General (non-affine) matrix too
+        Mat4 p = mat4_perspective(rand_range(0.5f, 1.5f), rand_range(0.5f, 2.0f), 0.1f, 100.0f);
+        Mat4 pa = mat4_multiply_scalar(&p, &a);
+        Mat4 mats[2] = {a, pa};
+        for (int k = 0; k < 2; ++k) {
+            Mat4 inv = mat4_inverse(&mats[k]);
+            Mat4 inv_ref = mat4_inverse_scalar(&mats[k]);
+            TEST_ASSERT(mat4_near(&inv, &inv_ref, 1e-4f));
+            Mat4 id = mat4_multiply(&mats[k], &inv);
+            Mat4 identity = mat4_identity();
+            TEST_ASSERT(mat4_near(&id, &identity, 1e-3f));
+        }
+
+        Vec4 v = {rand_range(-10.0f, 10.0f), rand_range(-10.0f, 10.0f), rand_range(-10.0f, 10.0f), 1.0f};
+        Vec4 tv = mat4_transform_vec4(&a, v);
+        Vec4 tv_ref = mat4_transform_vec4_scalar(&a, v);
+        TEST_ASSERT_FLOAT_EQ(tv_ref.x, tv.x, 1e-3f);
+        TEST_ASSERT_FLOAT_EQ(tv_ref.y, tv.y, 1e-3f);
+        TEST_ASSERT_FLOAT_EQ(tv_ref.z, tv.z, 1e-3f);
+        TEST_ASSERT_FLOAT_EQ(tv_ref.w, tv.w, 1e-3f);
+
+        Quat qa = quat_from_euler((EulerAngles){rand_range(-3.0f, 3.0f), rand_range(-3.0f, 3.0f), 0.5f});
+        Quat qb = quat_from_euler((EulerAngles){0.25f, rand_range(-3.0f, 3.0f), rand_range(-3.0f, 3.0f)});
+        Quat qm = quat_multiply(qa, qb);
+        Quat qm_ref = quat_multiply_scalar(qa, qb);
+        TEST_ASSERT_FLOAT_EQ(qm_ref.x, qm.x, 1e-6f);
+        TEST_ASSERT_FLOAT_EQ(qm_ref.y, qm.y, 1e-6f);
+        TEST_ASSERT_FLOAT_EQ(qm_ref.z, qm.z, 1e-6f);
+        TEST_ASSERT_FLOAT_EQ(qm_ref.w, qm.w, 1e-6f);
+
+        Quat raw = {qa.x * 3.0f, qa.y * 3.0f, qa.z * 3.0f, qa.w * 3.0f};
+        Quat qn = quat_normalize(raw);
+        Quat qn_ref = quat_normalize_scalar(raw);
+        TEST_ASSERT_FLOAT_EQ(qn_ref.x, qn.x, 1e-6f);
+        TEST_ASSERT_FLOAT_EQ(qn_ref.w, qn.w, 1e-6f);
+
+        // Quaternion product composes like the matrix product
+        // (mat4_rotation_quat emits the transposed basis, hence rb * ra)
+        Mat4 rq = mat4_rotation_quat(qm);
+        Mat4 ra = mat4_rotation_quat(qa);
+        Mat4 rb = mat4_rotation_quat(qb);
+        Mat4 rab = mat4_multiply_scalar(&rb, &ra);
+        TEST_ASSERT(mat4_near(&rq, &rab, 1e-5f));
+    }
+
+    // Singular input keeps the scalar contract
+    Mat4 zero = {0};
+    Mat4 inv_zero = mat4_inverse(&zero);
+    Mat4 identity = mat4_identity();
+    TEST_ASSERT(mat4_near(&inv_zero, &identity, 0.0f));
+    return 1;
+}
+
+static int test_closed_forms(void) {
+    // Closed forms equal the multiply chains they replace
+    Vec3 t = {3.0f, -2.0f, 0.5f};
+    Vec3 s = {2.0f, 4.0f, 1.0f};
+    Quat q = quat_from_euler((EulerAngles){0.3f, -1.2f, 0.7f});
+    Mat4 mt = mat4_translation(t), ms = mat4_scale(s), mr = mat4_rotation_quat(q);
+    Mat4 ts = mat4_multiply_scalar(&mt, &ms);
+    Mat4 ts_closed = mat4_translation_scale(t, s);
+    TEST_ASSERT(mat4_near(&ts, &ts_closed, 0.0f));
+    Mat4 rs = mat4_multiply_scalar(&mr, &ms);
+    Mat4 trs = mat4_multiply_scalar(&mt, &rs);
+    Mat4 trs_closed = mat4_compose(t, q, s);
+    TEST_ASSERT(mat4_near(&trs, &trs_closed, 1e-6f));
+    return 1;
+}
+
+// --- Incremental Scene Transforms ---
+
+static int test_incremental_transforms(void) {
+    // root -> a -> (a1, a2), root -> b
+    SceneAsset* asset = scene_asset_create(16 * 1024);
+    SceneNodeSpec* specs[5];
+    for (int i = 0; i < 5; ++i) {
+        specs[i] = scene_asset_push_node(asset);
+        specs[i]->transform.local_scale = (Vec3){1.0f, 1.0f, 1.0f};
+    }
+    specs[1]->transform.local_position = (Vec3){10.0f, 0.0f, 0.0f};
+
+    SceneTree* tree = scene_tree_create(asset, 4096);
+    SceneNode* root = scene_node_create(tree, specs[0], NULL, NULL);
+    SceneNode* a = scene_node_create(tree, specs[1], NULL, NULL);
+    SceneNode* a1 = scene_node_create(tree, specs[2], NULL, NULL);
+    SceneNode* a2 = scene_node_create(tree, specs[3], NULL, NULL);
+    SceneNode* b = scene_node_create(tree, specs[4], NULL, NULL);
+    scene_node_add_child(root, a);
+    scene_node_add_child(a, a1);
+    scene_node_add_child(a, a2);
+    scene_node_add_child(root, b);
+    scene_tree_set_root(tree, root);
+
+    // First update computes everything, a second one nothing
+    TEST_ASSERT_INT_EQ(5, scene_node_update_transforms(root, NULL));
+    TEST_ASSERT_INT_EQ(0, scene_node_update_transforms(root, NULL));
+    TEST_ASSERT_FLOAT_EQ(10.0f, scene_node_get_world_matrix(a1)->m[12], 0.0001f);
+
+    // Moving a leaf touches only the leaf
+    uint32_t b_version = scene_node_get_world_version(b);
+    uint32_t a2_version = scene_node_get_world_version(a2);
+    scene_node_set_local_position(a1, (Vec3){1.0f, 2.0f, 0.0f});
+    TEST_ASSERT_INT_EQ(1, scene_node_update_transforms(root, NULL));
+    TEST_ASSERT_FLOAT_EQ(11.0f, scene_node_get_world_matrix(a1)->m[12], 0.0001f);
+    TEST_ASSERT_FLOAT_EQ(2.0f, scene_node_get_world_matrix(a1)->m[13], 0.0001f);
+    TEST_ASSERT_INT_EQ(a2_version, scene_node_get_world_version(a2));
+
+    // Moving an inner node recomputes its subtree, not its sibling
+    scene_node_set_local_scale(a, (Vec3){2.0f, 2.0f, 2.0f});
+    scene_node_set_local_position(a1, (Vec3){1.0f, 0.0f, 0.0f}); // Dirty twice in one frame
+    TEST_ASSERT_INT_EQ(3, scene_node_update_transforms(root, NULL));
+    TEST_ASSERT_FLOAT_EQ(12.0f, scene_node_get_world_matrix(a1)->m[12], 0.0001f);
+    TEST_ASSERT(scene_node_get_world_version(a2) != a2_version);
+    TEST_ASSERT_INT_EQ(b_version, scene_node_get_world_version(b));
+
+    // Incremental result equals a full rebuild
+    Mat4 expected = *scene_node_get_world_matrix(a2);
+    scene_node_mark_transform_dirty(root);
+    TEST_ASSERT_INT_EQ(5, scene_node_update_transforms(root, NULL));
+    for (int i = 0; i < 16; ++i) {
+        TEST_ASSERT_FLOAT_EQ(expected.m[i], scene_node_get_world_matrix(a2)->m[i], 0.0f);
+    }
+
+    scene_tree_destroy(tree);
+    scene_asset_destroy(asset);
+    return 1;
+}
+
+// --- GPU Packing ---
+
+static int test_gpu_packing(void) {
+    // Half floats: exact for small integers and simple fractions
+    const float exact[] = {0.0f, 1.0f, -2.0f, 0.5f, 12.0f, 1024.0f, 65504.0f};
+    for (size_t i = 0; i < sizeof(exact) / sizeof(exact[0]); ++i) {
+        TEST_ASSERT_FLOAT_EQ(exact[i], math_half_to_float(math_float_to_half(exact[i])), 0.0f);
+    }
+    TEST_ASSERT_FLOAT_EQ(3.14159f, math_half_to_float(math_float_to_half(3.14159f)), 0.002f);
+    TEST_ASSERT(math_half_to_float(math_float_to_half(1e6f)) > 65504.0f); // Overflow -> inf
+
+    uint32_t h2 = math_pack_half2(1.0f, -0.5f);
+    TEST_ASSERT_INT_EQ(0x3C00, (int)(h2 & 0xFFFFu));
+    TEST_ASSERT_INT_EQ(0xB800, (int)(h2 >> 16));
+
+    // Unorm: x in the low bits, clamped
+    TEST_ASSERT_INT_EQ((int)0xFFFF0000u, (int)math_pack_unorm2x16(-1.0f, 2.0f));
+    TEST_ASSERT_INT_EQ((int)0x80FF0000u, (int)math_pack_unorm4x8((Vec4){0.0f, 0.0f, 1.0f, 0.5f}));
+    return 1;
+}
+
 int main(void) {
     RUN_TEST(test_coordinate_round_trip);
     RUN_TEST(test_local_to_world);
     RUN_TEST(test_3d_projection);
+    RUN_TEST(test_simd_matches_scalar);
+    RUN_TEST(test_closed_forms);
+    RUN_TEST(test_incremental_transforms);
+    RUN_TEST(test_gpu_packing);
     
     printf("Tests Run: %d, Failed: %d\n", g_tests_run, g_tests_failed);
     return g_tests_failed > 0 ? 1 : 0;
@@ -1,5 +1,6 @@
 #include "test_framework.h"
 #include "engine/ui/internal/ui_internal.h"
+#include "engine/scene/render_packet.h"
 #include "foundation/memory/arena.h"
 #include <stdio.h>
 #include <string.h>
@@ -64,9 +65,122 @@ int test_column_layout(void) {
     return 1;
 }
 
+int test_incremental_layout(void) {
+    SceneAsset* asset = scene_asset_create(4096);
+
+    SceneNodeSpec* root = create_node(asset, SCENE_LAYOUT_FLEX_COLUMN, 200.0f, 200.0f, "root");
+    SceneNodeSpec* panel_a = create_node(asset, SCENE_LAYOUT_FLEX_COLUMN, 100.0f, 80.0f, "panel_a");
+    SceneNodeSpec* panel_b = create_node(asset, SCENE_LAYOUT_FLEX_COLUMN, 100.0f, 80.0f, "panel_b");
+    SceneNodeSpec* leaf_a = create_node(asset, SCENE_LAYOUT_FLEX_COLUMN, 50.0f, 20.0f, "leaf_a");
+    SceneNodeSpec* leaf_b = create_node(asset, SCENE_LAYOUT_FLEX_COLUMN, 50.0f, 20.0f, "leaf_b");
+
+    add_child_spec(asset, root, panel_a);
+    add_child_spec(asset, root, panel_b);
+    add_child_spec(asset, panel_a, leaf_a);
+    add_child_spec(asset, panel_b, leaf_b);
+
+    SceneTree* instance = scene_tree_create(asset, 4096);
+    SceneNode* el = scene_node_create(instance, root, NULL, NULL);
+    instance->root = el;
+
+    // First frame lays out everything, the next one nothing
+    TEST_ASSERT(ui_system_layout(instance, 800, 600, 0, NULL, NULL) == 5);
+    TEST_ASSERT(ui_system_layout(instance, 800, 600, 1, NULL, NULL) == 0);
+
+    // Scrolling a panel re-lays out the path to it (root, panel_b), not its clean leaf
+    SceneNode* a = el->first_child;
+    SceneNode* b = a->next_sibling;
+    SceneNode* leaf = b->first_child;
+    b->scroll_y = 5.0f;
+    scene_node_mark_layout_dirty(b);
+    TEST_ASSERT(ui_system_layout(instance, 800, 600, 2, NULL, NULL) == 2);
+    TEST_ASSERT_FLOAT_EQ(leaf->rect.y, -5.0f, 0.1f);
+    TEST_ASSERT_FLOAT_EQ(ui_node_get_screen_rect(leaf).y, 80.0f - 5.0f, 0.1f);
+
+    // A dirty leaf re-lays out root -> panel_a -> leaf_a; a resize only the root
+    scene_node_mark_layout_dirty(a->first_child);
+    TEST_ASSERT(ui_system_layout(instance, 800, 600, 3, NULL, NULL) == 3);
+    TEST_ASSERT(ui_system_layout(instance, 1024, 768, 4, NULL, NULL) == 1); // Fixed-size children keep their space
+
+    // Full layout matches the incremental result
+    Rect incremental = ui_node_get_screen_rect(leaf);
+    ui_system_set_incremental_layout(false);
+    TEST_ASSERT(ui_system_layout(instance, 1024, 768, 5, NULL, NULL) == 5);
+    ui_system_set_incremental_layout(true);
+    Rect full = ui_node_get_screen_rect(leaf);
+    TEST_ASSERT_FLOAT_EQ(full.x, incremental.x, 0.001f);
+    TEST_ASSERT_FLOAT_EQ(full.y, incremental.y, 0.001f);
+
+    scene_tree_destroy(instance);
+    scene_asset_destroy(asset);
+    return 1;
+}
+
+int test_render_culling(void) {
+    SceneAsset* asset = scene_asset_create(8192);
+
+    // Clipped 200x200 column holding ten 50px rows, each with one child
+    SceneNodeSpec* root = create_node(asset, SCENE_LAYOUT_FLEX_COLUMN, 200.0f, 200.0f, "root");
+    root->flags = SCENE_FLAG_CLIPPED;
+    for (int i = 0; i < 10; ++i) {
+        SceneNodeSpec* row = create_node(asset, SCENE_LAYOUT_FLEX_COLUMN, 200.0f, 50.0f, "row");
+        add_child_spec(asset, row, create_node(asset, SCENE_LAYOUT_FLEX_COLUMN, 10.0f, 10.0f, "dot"));
+        add_child_spec(asset, root, row);
+    }
+
+    SceneTree* instance = scene_tree_create(asset, 8192);
+    SceneNode* el = scene_node_create(instance, root, NULL, NULL);
+    instance->root = el;
+    ui_system_layout(instance, 800, 600, 0, NULL, NULL);
+
+    Scene* scene = scene_create();
+    MemoryArena arena;
+    arena_init(&arena, 64 * 1024);
+
+    // Rows at y = 0..200 touch the clip (5), the rest are culled with their children
+    ui_system_render(instance, scene, NULL, &arena);
+    UiRenderStats stats = ui_renderer_get_stats();
+    TEST_ASSERT(stats.culled == 5);
+    TEST_ASSERT(stats.emitted == 1 + 5 * 2);
+    TEST_ASSERT(stats.visited == stats.emitted + stats.culled);
+
+    size_t ui_count = 0;
+    scene_get_ui_nodes(scene, &ui_count);
+    TEST_ASSERT(ui_count == stats.emitted);
+
+    // Scroll to the end: the last row is drawn, the first ones are culled
+    el->scroll_y = 300.0f;
+    scene_node_mark_layout_dirty(el);
+    ui_system_layout(instance, 800, 600, 1, NULL, NULL);
+    scene_clear(scene);
+    ui_system_render(instance, scene, NULL, &arena);
+    stats = ui_renderer_get_stats();
+    TEST_ASSERT(stats.culled == 5 + 1); // Row 5 touches the top edge, its dot does not
+    TEST_ASSERT(stats.emitted == 1 + 5 + 4);
+    TEST_ASSERT_FLOAT_EQ(el->last_child->screen_rect.y, 150.0f, 0.1f);
+
+    // A viewport smaller than the clip culls too: only the first row and its dot remain
+    el->scroll_y = 0.0f;
+    scene_node_mark_layout_dirty(el);
+    ui_system_layout(instance, 800, 20, 2, NULL, NULL);
+    scene_clear(scene);
+    ui_system_render(instance, scene, NULL, &arena);
+    stats = ui_renderer_get_stats();
+    TEST_ASSERT(stats.emitted == 1 + 2);
+    TEST_ASSERT(stats.culled == 9);
+
+    arena_destroy(&arena);
+    scene_destroy(scene);
+    scene_tree_destroy(instance);
+    scene_asset_destroy(asset);
+    return 1;
+}
+
 int main(void) {
     printf("--- Running UI Tests ---\n");
     RUN_TEST(test_column_layout);
+    RUN_TEST(test_incremental_layout);
+    RUN_TEST(test_render_culling);
     
     if (g_tests_failed > 0) {
         printf(TERM_RED "\n%dTESTS FAILED\n" TERM_RESET, g_tests_failed);
@@ -32,6 +32,19 @@ BASE_TYPES = {
     'Vec4': 'META_TYPE_VEC4',
 }
 
+def str_id(text):
+    """FNV-1a, bit-identical to str_id() in foundation/string/string_id.c."""
+    h = 2166136261
+    for byte in text.encode('utf-8'):
+        if byte >= 0x80:
+            byte |= 0xFFFFFF00  # C 'char' is sign-extended before the XOR
+        h = ((h ^ byte) * 16777619) & 0xFFFFFFFF
+    return h
+
+def sorted_by_id(names):
+    """Indices of 'names' ordered by (str_id, index) for binary search."""
+    return sorted(range(len(names)), key=lambda i: (str_id(names[i]), i))
+
 def parse_enum_body(body_text):
     entries = []
     lines = body_text.split('\n')
@@ -142,9 +155,11 @@ def generate_code(enums, structs, headers, output_path):
     lines.append('// GENERATED FILE - DO NOT EDIT\n')
     lines.append('// Generated by tools/codegen.py\n\n')
     lines.append('#include "foundation/meta/reflection.h"\n')
+    lines.append('#include "foundation/string/string_id.h"\n')
     lines.append('#include <string.h>\n')
     lines.append('#include <strings.h>\n')
     lines.append('#include <stddef.h>\n')
+    lines.append('#include <stdint.h>\n')
     lines.append('#include <stdbool.h>\n')
     lines.append('\n#ifdef _MSC_VER\n')
     lines.append('#define strcasecmp _stricmp\n')
@@ -200,10 +215,18 @@ def generate_code(enums, structs, headers, output_path):
                     meta_kind = 'META_TYPE_POINTER'
                 type_name_str = f'"{f_base}"'
                 
-            lines.append(f'    {{ "{f_name}", {meta_kind}, offsetof({s_name}, {f_name}), {type_name_str} }},\n')
+            lines.append(f'    {{ "{f_name}", {meta_kind}, offsetof({s_name}, {f_name}), {type_name_str}, 0x{str_id(f_name):08X}u }},\n')
         lines.append('};\n\n')
 
+        order = sorted_by_id([f['name'] for f in fields])
+        lines.append(f'static const uint16_t order_{s_name}[] = {{ {", ".join(str(i) for i in order)} }};\n\n')
+
     lines.append('// --- REGISTRY---\n\n')
+    lines.append('// Registry index: entries sorted by name id for binary search\n')
+    lines.append('typedef struct RegistryIndex {\n')
+    lines.append('    StringId id;\n')
+    lines.append('    uint16_t index;\n')
+    lines.append('} RegistryIndex;\n\n')
     lines.append('static const MetaEnum enum_registry[] = {\n')
     for name, values in enums.items():
             lines.append(f'    {{ "{name}", values_{name}, {len(values)} }},\n')
@@ -212,21 +235,57 @@ def generate_code(enums, structs, headers, output_path):
     
     lines.append('static const MetaStruct struct_registry[] = {\n')
     for name, fields in structs.items():
-        lines.append(f'    {{ "{name}", sizeof({name}), fields_{name}, {len(fields)} }},\n')
-    lines.append('    { NULL, 0, NULL, 0 }\n')
+        lines.append(f'    {{ "{name}", sizeof({name}), fields_{name}, {len(fields)}, order_{name}, 0x{str_id(name):08X}u }},\n')
+    lines.append('    { NULL, 0, NULL, 0, NULL, 0 }\n')
     lines.append('};\n\n')
 
+    for reg_name, names in (('enum', list(enums.keys())), ('struct', list(structs.keys()))):
+        lines.append(f'static const RegistryIndex {reg_name}_index[] = {{\n')
+        for i in sorted_by_id(names):
+            lines.append(f'    {{ 0x{str_id(names[i]):08X}u, {i} }}, // {names[i]}\n')
+        lines.append(f'    {{ 0, 0 }}\n')
+        lines.append('};\n')
+        lines.append(f'#define {reg_name.upper()}_INDEX_COUNT {len(names)}\n\n')
+
+    lines.append('// First position in index[0..count) whose id is >= id\n')
+    lines.append('static size_t registry_lower_bound(const RegistryIndex* index, size_t count, StringId id) {\n')
+    lines.append('    size_t lo = 0;\n')
+    lines.append('    size_t hi = count;\n')
+    lines.append('    while (lo < hi) {\n')
+    lines.append('        size_t mid = lo + (hi - lo) / 2;\n')
+    lines.append('        if (index[mid].id < id) lo = mid + 1;\n')
+    lines.append('        else hi = mid;\n')
+    lines.append('    }\n')
+    lines.append('    return lo;\n')
+    lines.append('}\n\n')
+
+    lines.append('const MetaStruct* meta_get_struct_by_id(StringId name_id) {\n')
+    lines.append('    size_t i = registry_lower_bound(struct_index, STRUCT_INDEX_COUNT, name_id);\n')
+    lines.append('    if (i < STRUCT_INDEX_COUNT && struct_index[i].id == name_id) return &struct_registry[struct_index[i].index];\n')
+    lines.append('    return NULL;\n')
+    lines.append('}\n\n')
+
     lines.append('const MetaStruct* meta_get_struct(const char* name) {\n')
     lines.append('    if (!name) return NULL;\n')
-    lines.append('    for (const MetaStruct* s = struct_registry; s->name; ++s) {\n')
+    lines.append('    StringId id = str_id(name);\n')
+    lines.append('    for (size_t i = registry_lower_bound(struct_index, STRUCT_INDEX_COUNT, id); i < STRUCT_INDEX_COUNT && struct_index[i].id == id; ++i) {\n')
+    lines.append('        const MetaStruct* s = &struct_registry[struct_index[i].index];\n')
     lines.append('        if (strcmp(s->name, name) == 0) return s;\n')
     lines.append('    }\n')
     lines.append('    return NULL;\n')
     lines.append('}\n\n')
 
+    lines.append('const MetaEnum* meta_get_enum_by_id(StringId name_id) {\n')
+    lines.append('    size_t i = registry_lower_bound(enum_index, ENUM_INDEX_COUNT, name_id);\n')
+    lines.append('    if (i < ENUM_INDEX_COUNT && enum_index[i].id == name_id) return &enum_registry[enum_index[i].index];\n')
+    lines.append('    return NULL;\n')
+    lines.append('}\n\n')
+
     lines.append('const MetaEnum* meta_get_enum(const char* name) {\n')
     lines.append('    if (!name) return NULL;\n')
-    lines.append('    for (const MetaEnum* e = enum_registry; e->name; ++e) {\n')
+    lines.append('    StringId id = str_id(name);\n')
+    lines.append('    for (size_t i = registry_lower_bound(enum_index, ENUM_INDEX_COUNT, id); i < ENUM_INDEX_COUNT && enum_index[i].id == id; ++i) {\n')
+    lines.append('        const MetaEnum* e = &enum_registry[enum_index[i].index];\n')
     lines.append('        if (strcmp(e->name, name) == 0) return e;\n')
     lines.append('    }\n')
     lines.append('    return NULL;\n')